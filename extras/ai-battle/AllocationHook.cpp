@@ -0,0 +1,27 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AllocationStatistics.h"
+#include <cstdlib>
+#include <new>
+
+// Report all allocations to the statistics which count them only when enabled.
+// All other allocation functions (array, nothrow) forward to these by default
+void* operator new(std::size_t size)
+{
+    AllocationStatistics::onAllocation(size);
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
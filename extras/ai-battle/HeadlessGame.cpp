@@ -1,18 +1,23 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "HeadlessGame.h"
+#include "AllocationStatistics.h"
 #include "EventManager.h"
+#include "EventStatistics.h"
 #include "GlobalGameSettings.h"
 #include "PlayerInfo.h"
 #include "Savegame.h"
+#include "StatisticExport.h"
 #include "factories/AIFactory.h"
+#include "helpers/EnumRange.h"
 #include "network/PlayerGameCommands.h"
 #include "world/GameWorld.h"
 #include "world/MapLoader.h"
 #include "gameTypes/MapInfo.h"
 #include "gameData/GameConsts.h"
+#include <boost/nowide/fstream.hpp>
 #include <boost/nowide/iostream.hpp>
 #include <chrono>
 #include <cstdio>
@@ -59,6 +64,9 @@ HeadlessGame::HeadlessGame(const GlobalGameSettings& ggs, const bfs::path& map,
 HeadlessGame::~HeadlessGame()
 {
     Close();
+    // Don't write to the file after it is closed
+    if(allocStatsFile_.is_open())
+        AllocationStatistics::enable(false);
 }
 
 void HeadlessGame::Run(unsigned maxGF)
@@ -98,6 +106,8 @@ void HeadlessGame::Run(unsigned maxGF)
 
         for(auto& player : players_)
             player->RunGF(em_.GetCurrentGF(), isnfw);
+        // The AI runs after the events of its GF
+        AllocationStatistics::onGFFinished(em_.GetCurrentGF());
 
         game_.RunGF();
 
@@ -110,7 +120,14 @@ void HeadlessGame::Run(unsigned maxGF)
             PrintState();
         }
     }
+    // The AI does not run anymore after the last GF
+    AllocationStatistics::onGFFinished(em_.GetCurrentGF());
     PrintState();
+    if(const uint64_t peakRSS = AllocationStatistics::getPeakRSS())
+    {
+        printConsole("Peak memory usage: %s KiB\n",
+                     HumanReadableNumber(static_cast<unsigned>(peakRSS / 1024u)).c_str());
+    }
 }
 
 void HeadlessGame::Close()
@@ -162,6 +179,62 @@ void HeadlessGame::SaveGame(const bfs::path& path) const
     bnw::cout << "Savegame written to " << canonical(path) << '\n';
 }
 
+void HeadlessGame::EnableEventStatistics()
+{
+    em_.EnableStatistics(true);
+}
+
+void HeadlessGame::WriteEventStatistics(const bfs::path& path) const
+{
+    const EventStatistics* statistics = em_.GetStatistics();
+    if(!statistics)
+        throw std::runtime_error("Event statistics were not enabled");
+    bnw::ofstream file(path);
+    if(!file)
+        throw std::runtime_error("Could not open " + path.string());
+    statistics->print(file, std::numeric_limits<unsigned>::max());
+
+    bnw::cout << "Event statistics written to " << canonical(path) << '\n';
+}
+
+void HeadlessGame::EnableAllocationStatistics(const bfs::path& path)
+{
+    allocStatsFile_.open(path);
+    if(!allocStatsFile_)
+        throw std::runtime_error("Could not open " + path.string());
+    allocStatsPath_ = path;
+    AllocationStatistics::enable(true, &allocStatsFile_);
+}
+
+void HeadlessGame::FinishAllocationStatistics()
+{
+    if(!allocStatsFile_.is_open())
+        throw std::runtime_error("Allocation statistics were not enabled");
+    const auto total = AllocationStatistics::getTotal();
+    AllocationStatistics::enable(false);
+    allocStatsFile_.close();
+
+    for(const auto tag : helpers::EnumRange<AllocationTag>{})
+    {
+        bnw::cout << AllocationStatistics::getTagName(tag) << ": " << total[tag].numAllocations << " allocations, "
+                  << total[tag].numBytes << " bytes\n";
+    }
+    bnw::cout << "Allocation statistics written to " << canonical(allocStatsPath_) << '\n';
+}
+
+void HeadlessGame::WriteStatistics(const bfs::path& path) const
+{
+    bnw::ofstream file(path);
+    if(!file)
+        throw std::runtime_error("Could not open " + path.string());
+    if(path.extension() == ".json")
+        statisticExport::writeJSON(file, world_);
+    else
+        statisticExport::writeCSV(file, world_);
+
+    bnw::cout << "Player statistics written to " << canonical(path) << '\n';
+}
+
 std::string ToString(const std::chrono::milliseconds& time)
 {
     char buffer[90];
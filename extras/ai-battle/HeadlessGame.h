@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -9,6 +9,7 @@
 #include "ai/AIPlayer.h"
 #include "gameTypes/AIInfo.h"
 #include <boost/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
 #include <chrono>
 #include <limits>
 #include <vector>
@@ -29,6 +30,15 @@ public:
 
     void RecordReplay(const boost::filesystem::path& path, unsigned random_init);
     void SaveGame(const boost::filesystem::path& path) const;
+    /// Collect statistics about the events to be written by WriteEventStatistics
+    void EnableEventStatistics();
+    void WriteEventStatistics(const boost::filesystem::path& path) const;
+    /// Count the heap allocations and write them for each GF as CSV to the file while running
+    void EnableAllocationStatistics(const boost::filesystem::path& path);
+    /// Stop counting the allocations and print the total
+    void FinishAllocationStatistics();
+    /// Write the statistics of all players as JSON if the extension is .json, else as CSV
+    void WriteStatistics(const boost::filesystem::path& path) const;
 
 private:
     void PrintState();
@@ -41,6 +51,8 @@ private:
 
     Replay replay_;
     boost::filesystem::path replayPath_;
+    boost::nowide::ofstream allocStatsFile_;
+    boost::filesystem::path allocStatsPath_;
 
     unsigned lastReportGf_ = 0;
     std::chrono::steady_clock::time_point gameStartTime_;
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -30,6 +30,9 @@ int main(int argc, char** argv)
 
     boost::optional<std::string> replay_path;
     boost::optional<std::string> savegame_path;
+    boost::optional<std::string> event_stats_path;
+    boost::optional<std::string> alloc_stats_path;
+    boost::optional<std::string> stats_path;
     unsigned random_init = static_cast<unsigned>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
     unsigned random_ai_init = random_init;
 
@@ -42,6 +45,9 @@ int main(int argc, char** argv)
         ("objective", po::value<std::string>()->default_value("domination"),"domination(default)|conquer")
         ("replay", po::value(&replay_path),"Filename to write replay to (optional)")
         ("save", po::value(&savegame_path),"Filename to write savegame to (optional)")
+        ("event_stats", po::value(&event_stats_path),"Filename to write statistics about the game events to (optional)")
+        ("alloc_stats", po::value(&alloc_stats_path),"Filename to write the heap allocations per GF to as CSV, game objects only with the blocks of their pool (optional)")
+        ("stats", po::value(&stats_path),"Filename to write the player statistics to as CSV or JSON (*.json) (optional)")
         ("random_init", po::value(&random_init),"Seed value for the random number generator (optional)")
         ("random_ai_init", po::value(&random_ai_init),"Seed value for the AI random number generator (optional)")
         ("maxGF", po::value<unsigned>()->default_value(std::numeric_limits<unsigned>::max()),"Maximum number of game frames to run (optional)")
@@ -114,11 +120,21 @@ int main(int argc, char** argv)
         HeadlessGame game(ggs, mapPath, ais);
         if(replay_path)
             game.RecordReplay(*replay_path, random_init);
+        if(event_stats_path)
+            game.EnableEventStatistics();
+        if(alloc_stats_path)
+            game.EnableAllocationStatistics(*alloc_stats_path);
 
         game.Run(options["maxGF"].as<unsigned>());
         game.Close();
         if(savegame_path)
             game.SaveGame(*savegame_path);
+        if(event_stats_path)
+            game.WriteEventStatistics(*event_stats_path);
+        if(alloc_stats_path)
+            game.FinishAllocationStatistics();
+        if(stats_path)
+            game.WriteStatistics(*stats_path);
     } catch(const std::exception& e)
     {
         bnw::cerr << e.what() << std::endl;
@@ -0,0 +1,181 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "RTTR_Version.h"
+#include "RttrConfig.h"
+#include "network/CreateServerInfo.h"
+#include "network/GameServer.h"
+#include "gameTypes/MapDescription.h"
+#include "s25util/Log.h"
+#include "s25util/Socket.h"
+#include "s25util/System.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/nowide/args.hpp>
+#include <boost/nowide/filesystem.hpp>
+#include <boost/nowide/iostream.hpp>
+#include <boost/optional.hpp>
+#include <boost/program_options.hpp>
+#include <csignal>
+
+namespace bnw = boost::nowide;
+namespace bfs = boost::filesystem;
+namespace po = boost::program_options;
+
+namespace {
+volatile std::sig_atomic_t stopRequested = 0;
+
+void requestStop(int /*sig*/)
+{
+    stopRequested = 1;
+}
+
+/// Run the server in its own loop until it stops, a stop is requested or the game is over
+void runServer(bool exitWhenEmpty)
+{
+    bool hadPlayers = false;
+    while(GAMESERVER.IsRunning() && !stopRequested)
+    {
+        GAMESERVER.WaitForEvents(std::chrono::milliseconds(100));
+        GAMESERVER.Run();
+        if(GAMESERVER.GetNumConnectedPlayers() > 0u)
+            hadPlayers = true;
+        else if(hadPlayers && (exitWhenEmpty || GAMESERVER.IsInGame()))
+        {
+            LOG.write("All players left. Stopping server\n");
+            break;
+        }
+    }
+    GAMESERVER.Stop();
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    bnw::nowide_filesystem();
+    bnw::args _(argc, argv);
+
+    boost::optional<std::string> lua_path;
+
+    po::options_description desc("Allowed options");
+    // clang-format off
+    desc.add_options()
+        ("help,h", "Show help")
+        ("map,m", po::value<std::string>()->required(),"Map or savegame to host")
+        ("lua", po::value(&lua_path),"Lua script to use instead of the one next to the map (optional)")
+        ("savegame", "Map is a savegame")
+        ("name", po::value<std::string>()->default_value("Dedicated server"),"Name of the game")
+        ("port", po::value<uint16_t>()->default_value(3665),"Port to listen on")
+        ("type", po::value<std::string>()->default_value("direct"),"direct(default)|lan")
+        ("password", po::value<std::string>()->default_value(""),"Password required to join (optional)")
+        ("host-password", po::value<std::string>()->required(),"Password identifying the player that controls the game")
+        ("ipv6", "Use IPv6")
+        ("upnp", "Forward the port via UPnP")
+        ("min-nwf-length", po::value<unsigned>()->default_value(0),"Minimum duration of a network frame in ms")
+        ("cmd-delay", po::value<unsigned>()->default_value(3),"Number of network frames commands are sent in advance")
+        ("max-msgs", po::value<int>()->default_value(-1),"Maximum messages sent per player and iteration (-1 = unlimited)")
+        ("exit-when-empty", "Stop the server when the last player left (also during configuration)")
+        ("version", "Show version information and exit")
+        ;
+    // clang-format on
+
+    if(argc == 1)
+    {
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    po::variables_map options;
+    try
+    {
+        po::store(po::command_line_parser(argc, argv).options(desc).run(), options);
+
+        if(options.count("help"))
+        {
+            bnw::cout << desc << std::endl;
+            return 0;
+        }
+        if(options.count("version"))
+        {
+            bnw::cout << rttr::version::GetTitle() << " v" << rttr::version::GetVersion() << "-"
+                      << rttr::version::GetRevision() << std::endl
+                      << "Compiled with " << System::getCompilerName() << " for " << System::getOSName() << std::endl;
+            return 0;
+        }
+
+        po::notify(options);
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << "Error: " << e.what() << std::endl;
+        bnw::cerr << desc << std::endl;
+        return 1;
+    }
+
+    ServerType serverType;
+    const auto type = options["type"].as<std::string>();
+    if(type == "direct")
+        serverType = ServerType::Direct;
+    else if(type == "lan")
+        serverType = ServerType::LAN;
+    else
+    {
+        bnw::cerr << "unknown server type: " << type << std::endl;
+        return 1;
+    }
+    if(options["cmd-delay"].as<unsigned>() == 0u)
+    {
+        bnw::cerr << "cmd-delay must be at least 1" << std::endl;
+        return 1;
+    }
+
+    try
+    {
+        if(!RTTRCONFIG.Init())
+            return 1;
+        if(!Socket::Initialize())
+        {
+            bnw::cerr << "Could not init sockets!" << std::endl;
+            return 1;
+        }
+
+        std::signal(SIGINT, requestStop);
+        std::signal(SIGTERM, requestStop);
+#ifdef SIGPIPE
+        std::signal(SIGPIPE, SIG_IGN);
+#endif
+
+        GameServer::RunSettings runSettings;
+        runSettings.maxMsgsPerRun = options["max-msgs"].as<int>();
+        runSettings.cmdDelay = options["cmd-delay"].as<unsigned>();
+        runSettings.minNWFDuration = FramesInfo::milliseconds32_t(options["min-nwf-length"].as<unsigned>());
+        // Not limited by any framerate
+        runSettings.mapBytesPerSecond = 1024 * 1024;
+        GAMESERVER.SetRunSettings(runSettings);
+
+        const bfs::path mapPath = RTTRCONFIG.ExpandPath(options["map"].as<std::string>());
+        boost::optional<bfs::path> luaPath;
+        if(lua_path)
+            luaPath = RTTRCONFIG.ExpandPath(*lua_path);
+        const MapDescription map(mapPath, options.count("savegame") ? MapType::Savegame : MapType::OldMap, luaPath);
+        const CreateServerInfo csi(serverType, options["port"].as<uint16_t>(), options["name"].as<std::string>(),
+                                   options["password"].as<std::string>(), options.count("ipv6") > 0,
+                                   options.count("upnp") > 0);
+        if(!GAMESERVER.Start(csi, map, options["host-password"].as<std::string>()))
+        {
+            bnw::cerr << "Failed to start the server" << std::endl;
+            Socket::Shutdown();
+            return 1;
+        }
+        LOG.write("Server %1% listening on port %2%\n") % csi.gameName % csi.port;
+
+        runServer(options.count("exit-when-empty") > 0);
+        Socket::Shutdown();
+    } catch(const std::exception& e)
+    {
+        bnw::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
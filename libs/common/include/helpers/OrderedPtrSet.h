@@ -0,0 +1,177 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "RTTR_Assert.h"
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <unordered_map>
+#include <vector>
+
+namespace helpers {
+
+/// Set of (non-NULL) pointers iterated in insertion order with O(1) insertion, lookup and removal.
+/// Drop-in replacement for a std::list<T*> of unique elements:
+/// The elements are stored in a contiguous array of slots linked by index, freed slots are reused.
+/// Iterators refer to slots, so they stay valid when elements are added or other elements are removed and
+/// elements added during an iteration are visited at its end. Hence the iteration order only depends on the sequence
+/// of insertions and removals and not on memory addresses.
+template<class T>
+class OrderedPtrSet
+{
+    using Index = uint32_t;
+    /// Index of the sentinel slot which is the "end" of the linked slots
+    static constexpr Index sentinel = 0;
+
+    struct Slot
+    {
+        T* value;
+        Index prev, next;
+    };
+    /// Slot 0 is the sentinel, following slots are either used or in freeSlots_
+    std::vector<Slot> slots_;
+    std::vector<Index> freeSlots_;
+    std::unordered_map<const T*, Index> indices_;
+
+public:
+    using value_type = T*;
+    using size_type = std::size_t;
+
+    class const_iterator
+    {
+        const OrderedPtrSet* set_;
+        Index idx_;
+
+        friend class OrderedPtrSet;
+        const_iterator(const OrderedPtrSet* set, Index idx) : set_(set), idx_(idx) {}
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T*;
+
+        const_iterator() : set_(nullptr), idx_(sentinel) {}
+
+        bool operator==(const const_iterator& other) const { return idx_ == other.idx_; }
+        bool operator!=(const const_iterator& other) const { return idx_ != other.idx_; }
+        reference operator*() const
+        {
+            RTTR_Assert(idx_ != sentinel);
+            return set_->slots_[idx_].value;
+        }
+        const_iterator& operator++()
+        {
+            idx_ = set_->slots_[idx_].next;
+            return *this;
+        }
+        const_iterator operator++(int)
+        {
+            const_iterator result = *this;
+            ++*this;
+            return result;
+        }
+        const_iterator& operator--()
+        {
+            idx_ = set_->slots_[idx_].prev;
+            return *this;
+        }
+        const_iterator operator--(int)
+        {
+            const_iterator result = *this;
+            --*this;
+            return result;
+        }
+    };
+    using iterator = const_iterator;
+
+    OrderedPtrSet() : slots_{{nullptr, sentinel, sentinel}} {}
+
+    size_type size() const { return indices_.size(); }
+    bool empty() const { return indices_.empty(); }
+
+    const_iterator begin() const { return const_iterator(this, slots_[sentinel].next); }
+    const_iterator end() const { return const_iterator(this, sentinel); }
+    T* front() const
+    {
+        RTTR_Assert(!empty());
+        return slots_[slots_[sentinel].next].value;
+    }
+    T* back() const
+    {
+        RTTR_Assert(!empty());
+        return slots_[slots_[sentinel].prev].value;
+    }
+
+    const_iterator find(const T* value) const
+    {
+        const auto it = indices_.find(value);
+        return const_iterator(this, it == indices_.end() ? sentinel : it->second);
+    }
+    bool contains(const T* value) const { return indices_.find(value) != indices_.end(); }
+
+    void reserve(size_type numElements)
+    {
+        slots_.reserve(numElements + 1);
+        indices_.reserve(numElements);
+    }
+
+    /// Add the element at the end. It must not be contained yet
+    void push_back(T* value)
+    {
+        RTTR_Assert(value && !contains(value));
+        Index idx;
+        if(freeSlots_.empty())
+        {
+            idx = static_cast<Index>(slots_.size());
+            slots_.emplace_back();
+        } else
+        {
+            idx = freeSlots_.back();
+            freeSlots_.pop_back();
+        }
+        const Index last = slots_[sentinel].prev;
+        slots_[idx] = {value, last, sentinel};
+        slots_[last].next = idx;
+        slots_[sentinel].prev = idx;
+        indices_.emplace(value, idx);
+    }
+
+    /// Remove the element if it is contained
+    void remove(const T* value)
+    {
+        const auto it = indices_.find(value);
+        if(it != indices_.end())
+            erase(const_iterator(this, it->second));
+    }
+
+    /// Remove the element at the position and return an iterator to the following one
+    const_iterator erase(const_iterator pos)
+    {
+        RTTR_Assert(pos.set_ == this && pos.idx_ != sentinel);
+        const Index idx = pos.idx_;
+        Slot& slot = slots_[idx];
+        RTTR_Assert(slot.value);
+        indices_.erase(slot.value);
+        slots_[slot.prev].next = slot.next;
+        slots_[slot.next].prev = slot.prev;
+        // Keep the links of the freed slot so an iterator pointing to it can still advance
+        slot.value = nullptr;
+        freeSlots_.push_back(idx);
+        return const_iterator(this, slot.next);
+    }
+
+    void clear()
+    {
+        slots_.resize(1);
+        slots_[sentinel] = {nullptr, sentinel, sentinel};
+        freeSlots_.clear();
+        indices_.clear();
+    }
+};
+
+} // namespace helpers
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -77,19 +77,22 @@ bool LuaInterfaceBase::loadScriptString(const std::string& script, bool rethrowE
     script_.clear();
     if(!validateUTF8(script))
         return false;
+    bool success;
     try
     {
-        if(!lua.dostring(script))
-            return false;
-        else
-            script_ = script;
+        success = lua.dostring(script);
     } catch(const LuaExecutionError&)
     {
+        // Parts of the script might have been executed
+        onScriptLoaded();
         if(rethrowError)
             throw;
         return false;
     }
-    return true;
+    onScriptLoaded();
+    if(success)
+        script_ = script;
+    return success;
 }
 
 void LuaInterfaceBase::setThrowOnError(bool doThrow)
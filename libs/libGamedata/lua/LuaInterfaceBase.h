@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2025 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -48,6 +48,8 @@ protected:
     std::string script_;
 
     bool validateUTF8(const std::string& scriptTxt);
+    /// Called after a script was (possibly partially) executed, e.g. to refresh references to functions defined in it
+    virtual void onScriptLoaded() {}
 
     /// Write a string to log and stdout
     void log(const std::string& msg);
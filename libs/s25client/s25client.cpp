@@ -12,6 +12,7 @@
 #include "SignalHandler.h"
 #include "WindowManager.h"
 #include "commands.h"
+#include "network/GameClient.h"
 #include "drivers/AudioDriverWrapper.h"
 #include "drivers/VideoDriverWrapper.h"
 #include "files.h"
@@ -449,6 +450,8 @@ int RunProgram(po::variables_map& options)
         if(!InitGame(gameManager))
             return 2;
 
+        if(options.count("state-hash-interval"))
+            GAMECLIENT.SetStateHashInterval(options["state-hash-interval"].as<unsigned>());
         if(options.count("map"))
         {
             std::vector<std::string> aiPlayers;
@@ -508,6 +511,8 @@ int main(int argc, char** argv)
         ("ai", po::value<std::vector<std::string>>(),"AI player(s) to add")
         ("version", "Show version information and exit")
         ("convert-sounds", "Convert sounds and exit")
+        ("state-hash-interval", po::value<unsigned>(),
+         "Send a detailed hash of the game state every N network frames to locate asyncs (default 0 = disabled)")
         ;
     // clang-format on
     po::positional_options_description positionalOptions;
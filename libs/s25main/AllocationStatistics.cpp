@@ -0,0 +1,137 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AllocationStatistics.h"
+#include "helpers/EnumRange.h"
+#include <ostream>
+#ifdef _WIN32
+#    include <windows.h>
+// Must be included after windows.h
+#    include <psapi.h>
+#else
+#    include <sys/resource.h>
+#endif
+
+namespace {
+constexpr helpers::EnumArray<const char*, AllocationTag> TAG_NAMES = {
+  {"Other", "Events", "Pathfinding", "AI", "Serialization"}};
+
+/// Allocations since the last finished GF. Atomic as other threads might allocate too
+helpers::EnumArray<std::atomic<uint64_t>, AllocationTag> curNumAllocations;
+helpers::EnumArray<std::atomic<uint64_t>, AllocationTag> curNumBytes;
+thread_local AllocationTag curTag = AllocationTag::Other;
+
+void writeCSVHeader(std::ostream& os)
+{
+    os << "GF,PeakRSS";
+    for(const auto tag : helpers::EnumRange<AllocationTag>{})
+    {
+        const char* name = AllocationStatistics::getTagName(tag);
+        os << ',' << name << "Allocations," << name << "Bytes";
+    }
+    os << '\n';
+}
+
+void writeCSVLine(std::ostream& os, const AllocationStatistics::GFEntry& entry)
+{
+    os << entry.gf << ',' << entry.peakRSS;
+    for(const AllocationStatistics::Counters& counters : entry.counters)
+        os << ',' << counters.numAllocations << ',' << counters.numBytes;
+    os << '\n';
+}
+} // namespace
+
+std::atomic<bool> AllocationStatistics::enabled_(false);
+std::ostream* AllocationStatistics::csvOutput_ = nullptr;
+AllocationStatistics::GFEntry AllocationStatistics::lastGFEntry_;
+helpers::EnumArray<AllocationStatistics::Counters, AllocationTag> AllocationStatistics::total_;
+
+AllocationStatistics::Counters& AllocationStatistics::Counters::operator+=(const Counters& rhs)
+{
+    numAllocations += rhs.numAllocations;
+    numBytes += rhs.numBytes;
+    return *this;
+}
+
+void AllocationStatistics::enable(const bool enable, std::ostream* const csvOutput)
+{
+    enabled_ = false;
+    lastGFEntry_ = GFEntry();
+    for(const auto tag : helpers::EnumRange<AllocationTag>{})
+    {
+        curNumAllocations[tag] = 0;
+        curNumBytes[tag] = 0;
+        total_[tag] = Counters();
+    }
+    csvOutput_ = enable ? csvOutput : nullptr;
+    if(csvOutput_)
+        writeCSVHeader(*csvOutput_);
+    enabled_ = enable;
+}
+
+void AllocationStatistics::countAllocation(const size_t size)
+{
+    curNumAllocations[curTag].fetch_add(1, std::memory_order_relaxed);
+    curNumBytes[curTag].fetch_add(size, std::memory_order_relaxed);
+}
+
+helpers::EnumArray<AllocationStatistics::Counters, AllocationTag> AllocationStatistics::getCurrentCounters()
+{
+    helpers::EnumArray<Counters, AllocationTag> result;
+    for(const auto tag : helpers::EnumRange<AllocationTag>{})
+    {
+        result[tag].numAllocations = curNumAllocations[tag].exchange(0, std::memory_order_relaxed);
+        result[tag].numBytes = curNumBytes[tag].exchange(0, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+void AllocationStatistics::onGFFinished(const unsigned gf)
+{
+    if(!isEnabled())
+        return;
+    // Take the counters first, so writing the line is counted for the next GF
+    lastGFEntry_.gf = gf;
+    lastGFEntry_.counters = getCurrentCounters();
+    lastGFEntry_.peakRSS = getPeakRSS();
+    for(const auto tag : helpers::EnumRange<AllocationTag>{})
+        total_[tag] += lastGFEntry_.counters[tag];
+    if(csvOutput_)
+        writeCSVLine(*csvOutput_, lastGFEntry_);
+}
+
+const char* AllocationStatistics::getTagName(const AllocationTag tag)
+{
+    return TAG_NAMES[tag];
+}
+
+uint64_t AllocationStatistics::getPeakRSS()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    if(getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#    ifdef __APPLE__
+    // Already in bytes
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#    else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#    endif
+#endif
+}
+
+AllocationScope::AllocationScope(const AllocationTag tag) : prevTag_(curTag)
+{
+    curTag = tag;
+}
+
+AllocationScope::~AllocationScope()
+{
+    curTag = prevTag_;
+}
@@ -0,0 +1,100 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "helpers/EnumArray.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/// Parts of the game the heap allocations are counted for
+enum class AllocationTag : uint8_t
+{
+    /// Everything not in one of the other parts
+    Other,
+    /// Executing the events of a GF, i.e. the simulation
+    Events,
+    Pathfinding,
+    AI,
+    Serialization
+};
+constexpr auto maxEnumValue(AllocationTag)
+{
+    return AllocationTag::Serialization;
+}
+
+/// Optional statistics about the heap allocations of the game.
+/// The library can't see the allocations itself, so the program has to report them via onAllocation, e.g. from a
+/// replaced global operator new. They are counted for the part of the game set by the innermost AllocationScope.
+/// Game objects are taken from the GameObjectPool, so only the blocks it allocates for them are counted.
+/// While enabled, the allocations of each GF can be written as CSV together with the peak memory usage of the process.
+/// The rows are written when the GF is finished, so nothing is kept in memory for long games.
+class AllocationStatistics
+{
+public:
+    struct Counters
+    {
+        uint64_t numAllocations = 0;
+        uint64_t numBytes = 0;
+
+        Counters& operator+=(const Counters& rhs);
+    };
+    struct GFEntry
+    {
+        unsigned gf = 0;
+        helpers::EnumArray<Counters, AllocationTag> counters;
+        /// Peak resident memory of the process in bytes at the end of the GF
+        uint64_t peakRSS = 0;
+    };
+
+    static bool isEnabled() { return enabled_.load(std::memory_order_relaxed); }
+    /// Enable or disable counting of the allocations. Enabling resets the counters.
+    /// If csvOutput is set, a header line is written to it and a line for each finished GF
+    static void enable(bool enable, std::ostream* csvOutput = nullptr);
+    /// Count an allocation of the given size if enabled
+    static void onAllocation(size_t size)
+    {
+        if(isEnabled())
+            countAllocation(size);
+    }
+    /// Record the allocations since the previous GF for the given GF.
+    /// Call it when everything belonging to the GF is done, i.e. after the AI has run for it
+    static void onGFFinished(unsigned gf);
+
+    /// Allocations of the last finished GF
+    static const GFEntry& getLastGFEntry() { return lastGFEntry_; }
+    /// Counters of the allocations of all finished GFs since enabling the statistics
+    static const helpers::EnumArray<Counters, AllocationTag>& getTotal() { return total_; }
+    static const char* getTagName(AllocationTag tag);
+
+    /// Return the peak resident memory of the process in bytes or 0 if it is unknown
+    static uint64_t getPeakRSS();
+
+private:
+    friend class AllocationScope;
+
+    static void countAllocation(size_t size);
+    /// Counters since the last finished GF
+    static helpers::EnumArray<Counters, AllocationTag> getCurrentCounters();
+
+    static std::atomic<bool> enabled_;
+    static std::ostream* csvOutput_;
+    static GFEntry lastGFEntry_;
+    static helpers::EnumArray<Counters, AllocationTag> total_;
+};
+
+/// Count all allocations of the current thread for the given part of the game while this object exists
+class AllocationScope
+{
+public:
+    explicit AllocationScope(AllocationTag tag);
+    ~AllocationScope();
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+
+private:
+    AllocationTag prevTag_;
+};
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "StateHash.h"
 #include <iosfwd>
 
 class Game;
@@ -15,6 +16,10 @@ struct AsyncChecksum
     unsigned randChecksum;
     unsigned objCt, objIdCt;
     unsigned eventCt, evInstanceCt;
+    /// Detailed hash which is only created every few NWFs (may be empty).
+    /// Only used by the server for the commands of the network players, taken from their GameMessage_GameCommandBatch.
+    /// Not part of Serialize or the comparison operators
+    StateHash stateHash;
     AsyncChecksum();
     AsyncChecksum(unsigned randChecksum, unsigned objCt, unsigned objIdCt, unsigned eventCt, unsigned evInstanceCt);
     void Serialize(Serializer& ser) const;
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -13,7 +13,6 @@
 #include "buildings/nobUsual.h"
 #include "enum_cast.hpp"
 #include "helpers/EnumRange.h"
-#include "helpers/containerUtils.h"
 #include "gameData/BuildingConsts.h"
 #include "gameData/BuildingProperties.h"
 
@@ -52,6 +51,14 @@ void BuildingRegister::Deserialize(SerializedGameData& sgd)
         sgd.PopObjectContainer(military_buildings, GO_Type::NobMilitary);
     } else if(sgd.GetGameDataVersion() >= 2)
         Deserialize2(sgd);
+
+    for(auto& clients : wareClients)
+        clients.clear();
+    for(const auto& blds : buildings)
+    {
+        for(nobUsual* bld : blds)
+            UpdateWareNeeds(*bld);
+    }
 }
 
 void BuildingRegister::Deserialize2(SerializedGameData& sgd)
@@ -65,62 +72,76 @@ void BuildingRegister::Deserialize2(SerializedGameData& sgd)
 
 void BuildingRegister::Add(noBuildingSite* building_site)
 {
-    RTTR_Assert(!helpers::contains(building_sites, building_site));
     building_sites.push_back(building_site);
 }
 
 void BuildingRegister::Remove(noBuildingSite* building_site)
 {
-    RTTR_Assert(helpers::contains(building_sites, building_site));
+    RTTR_Assert(building_sites.contains(building_site));
     building_sites.remove(building_site);
 }
 
 void BuildingRegister::Add(noBuilding* bld, BuildingType bldType)
 {
     if(BuildingProperties::IsMilitary(bldType))
-    {
-        RTTR_Assert(!helpers::contains(military_buildings, bld));
         military_buildings.push_back(static_cast<nobMilitary*>(bld));
-    } else if(BuildingProperties::IsWareHouse(bldType))
-    {
-        RTTR_Assert(!helpers::contains(warehouses, bld));
+    else if(BuildingProperties::IsWareHouse(bldType))
         warehouses.push_back(static_cast<nobBaseWarehouse*>(bld));
-    } else
+    else
     {
-        RTTR_Assert(!helpers::contains(buildings[bldType], bld));
         buildings[bldType].push_back(static_cast<nobUsual*>(bld));
+        UpdateWareNeeds(*static_cast<nobUsual*>(bld));
     }
     if(bldType == BuildingType::HarborBuilding)
-    {
-        RTTR_Assert(!helpers::contains(harbors, bld));
         harbors.push_back(static_cast<nobHarborBuilding*>(bld));
-    }
 }
 
 void BuildingRegister::Remove(noBuilding* bld, BuildingType bldType)
 {
     if(BuildingProperties::IsMilitary(bldType))
     {
-        RTTR_Assert(helpers::contains(military_buildings, bld));
+        RTTR_Assert(military_buildings.contains(static_cast<nobMilitary*>(bld)));
         military_buildings.remove(static_cast<nobMilitary*>(bld));
     } else if(BuildingProperties::IsWareHouse(bldType))
     {
-        RTTR_Assert(helpers::contains(warehouses, bld));
+        RTTR_Assert(warehouses.contains(static_cast<nobBaseWarehouse*>(bld)));
         warehouses.remove(static_cast<nobBaseWarehouse*>(bld));
     } else
     {
-        RTTR_Assert(helpers::contains(buildings[bldType], bld));
+        RTTR_Assert(buildings[bldType].contains(static_cast<nobUsual*>(bld)));
         buildings[bldType].remove(static_cast<nobUsual*>(bld));
+        RemoveWareNeeds(*static_cast<nobUsual*>(bld));
     }
     if(bldType == BuildingType::HarborBuilding)
     {
-        RTTR_Assert(helpers::contains(harbors, bld));
+        RTTR_Assert(harbors.contains(static_cast<nobHarborBuilding*>(bld)));
         harbors.remove(static_cast<nobHarborBuilding*>(bld));
     }
 }
 
+void BuildingRegister::UpdateWareNeeds(nobUsual& bld)
+{
+    // Buildings not (or no longer) registered don't request anything
+    if(!buildings[bld.GetBuildingType()].contains(&bld))
+        return;
+    for(const GoodType ware : BLD_WORK_DESC[bld.GetBuildingType()].waresNeeded)
+    {
+        helpers::OrderedPtrSet<nobUsual>& clients = wareClients[ware];
+        if(bld.CalcDistributionPoints(ware) == 0)
+            clients.remove(&bld);
+        else if(!clients.contains(&bld))
+            clients.push_back(&bld);
+    }
+}
+
+void BuildingRegister::RemoveWareNeeds(nobUsual& bld)
+{
+    for(const GoodType ware : BLD_WORK_DESC[bld.GetBuildingType()].waresNeeded)
+        wareClients[ware].remove(&bld);
+}
+
 /// Gibt Liste von Gebäuden des Spieler zurück
-const std::list<nobUsual*>& BuildingRegister::GetBuildings(const BuildingType type) const
+const helpers::OrderedPtrSet<nobUsual>& BuildingRegister::GetBuildings(const BuildingType type) const
 {
     RTTR_Assert(BuildingProperties::IsUsual(type));
     return buildings[type];
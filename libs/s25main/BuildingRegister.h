@@ -1,12 +1,12 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include "helpers/OrderedPtrSet.h"
 #include "gameTypes/BuildingCount.h"
-#include <list>
-#include <vector>
+#include "gameTypes/GoodTypes.h"
 
 class noBuilding;
 class noBuildingSite;
@@ -31,11 +31,15 @@ public:
     void Add(noBuilding* bld, BuildingType bldType);
     void Remove(noBuilding* bld, BuildingType bldType);
 
-    const std::list<noBuildingSite*>& GetBuildingSites() const { return building_sites; }
-    const std::list<nobUsual*>& GetBuildings(BuildingType type) const;
-    const std::list<nobMilitary*>& GetMilitaryBuildings() const { return military_buildings; }
-    const std::list<nobHarborBuilding*>& GetHarbors() const { return harbors; }
-    const std::list<nobBaseWarehouse*>& GetStorehouses() const { return warehouses; }
+    const helpers::OrderedPtrSet<noBuildingSite>& GetBuildingSites() const { return building_sites; }
+    const helpers::OrderedPtrSet<nobUsual>& GetBuildings(BuildingType type) const;
+    const helpers::OrderedPtrSet<nobMilitary>& GetMilitaryBuildings() const { return military_buildings; }
+    const helpers::OrderedPtrSet<nobHarborBuilding>& GetHarbors() const { return harbors; }
+    const helpers::OrderedPtrSet<nobBaseWarehouse>& GetStorehouses() const { return warehouses; }
+    /// Usual buildings which currently request the ware, i.e. have a non-zero CalcDistributionPoints
+    const helpers::OrderedPtrSet<nobUsual>& GetWareClients(GoodType ware) const { return wareClients[ware]; }
+    /// Update whether the building requests each of the wares it needs. Must be called whenever that might change
+    void UpdateWareNeeds(nobUsual& bld);
 
     /// Liefert die Anzahl aller Gebäude einzeln
     BuildingCount GetBuildingNums() const;
@@ -47,10 +51,14 @@ public:
     unsigned short CalcAverageProductivity() const;
 
 private:
-    std::list<noBuildingSite*> building_sites;
+    helpers::OrderedPtrSet<noBuildingSite> building_sites;
     // Only "usual" buildings
-    helpers::EnumArray<std::list<nobUsual*>, BuildingType> buildings;
-    std::list<nobMilitary*> military_buildings;
-    std::list<nobHarborBuilding*> harbors;
-    std::list<nobBaseWarehouse*> warehouses;
+    helpers::EnumArray<helpers::OrderedPtrSet<nobUsual>, BuildingType> buildings;
+    helpers::OrderedPtrSet<nobMilitary> military_buildings;
+    helpers::OrderedPtrSet<nobHarborBuilding> harbors;
+    helpers::OrderedPtrSet<nobBaseWarehouse> warehouses;
+    /// Index of buildings requesting each ware. Not serialized but recreated from the buildings
+    helpers::EnumArray<helpers::OrderedPtrSet<nobUsual>, GoodType> wareClients;
+
+    void RemoveWareNeeds(nobUsual& bld);
 };
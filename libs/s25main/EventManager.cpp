@@ -1,14 +1,17 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "EventManager.h"
+#include "AllocationStatistics.h"
+#include "EventStatistics.h"
 #include "GameEvent.h"
 #include "GameObject.h"
 #include "SerializedGameData.h"
 #include "helpers/containerUtils.h"
 #include "s25util/Log.h"
 #include <mygettext/mygettext.h>
+#include <new>
 
 EventManager::EventManager(unsigned startGF)
     : numActiveEvents(0), eventInstanceCtr(1), currentGF(startGF), curActiveEvent(nullptr)
@@ -25,7 +28,7 @@ void EventManager::Clear()
     {
         for(const GameEvent* ev : event.second)
         {
-            delete ev;
+            DestroyEvent(ev);
             RTTR_Assert(numActiveEvents > 0u);
             numActiveEvents--;
         }
@@ -40,6 +43,7 @@ void EventManager::Clear()
         delete obj;
     }
     killList.clear();
+    FreeUnusedStorage();
 
     // Reset counters (next should already be 0 but just to be sure)
     numActiveEvents = 0u;
@@ -51,17 +55,72 @@ const GameEvent* EventManager::AddEventToQueue(const GameEvent* event)
 {
     // Should be in the future!
     RTTR_Assert(event->GetTargetGF() > currentGF);
-    events[event->GetTargetGF()].push_back(event);
+    EventList& eventList = GetEventList(event->GetTargetGF());
+    if(unusedListNodes.empty())
+        eventList.push_back(event);
+    else
+    {
+        eventList.splice(eventList.end(), unusedListNodes, unusedListNodes.begin());
+        eventList.back() = event;
+    }
     ++numActiveEvents;
     return event;
 }
 
+const GameEvent* EventManager::CreateEvent(GameObject* obj, unsigned startGF, unsigned length, unsigned id)
+{
+    const unsigned instanceId = GetNextEventInstanceId();
+    if(unusedEventStorage.empty())
+        return new GameEvent(instanceId, obj, startGF, length, id);
+    void* storage = unusedEventStorage.back();
+    unusedEventStorage.pop_back();
+    return new(storage) GameEvent(instanceId, obj, startGF, length, id);
+}
+
+void EventManager::DestroyEvent(const GameEvent* event)
+{
+    // Storage of all events (also the deserialized ones) is allocated by the default new, so it can be freed later
+    event->~GameEvent();
+    unusedEventStorage.push_back(const_cast<GameEvent*>(event));
+}
+
+EventManager::EventList& EventManager::GetEventList(unsigned gf)
+{
+    const auto it = events.lower_bound(gf);
+    if(it != events.end() && it->first == gf)
+        return it->second;
+    if(unusedMapNodes.empty())
+        return events.emplace_hint(it, gf, EventList())->second;
+    EventMap::node_type node = std::move(unusedMapNodes.back());
+    unusedMapNodes.pop_back();
+    RTTR_Assert(node.mapped().empty());
+    node.key() = gf;
+    return events.insert(it, std::move(node))->second;
+}
+
+void EventManager::RemoveEventList(const EventMap::iterator& itEvents)
+{
+    RTTR_Assert(itEvents->second.empty());
+    unusedMapNodes.push_back(events.extract(itEvents));
+}
+
+void EventManager::FreeUnusedStorage()
+{
+    for(void* storage : unusedEventStorage)
+        ::operator delete(storage);
+    unusedEventStorage.clear();
+    unusedListNodes.clear();
+    unusedMapNodes.clear();
+}
+
 const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, unsigned id)
 {
     RTTR_Assert(obj);
     RTTR_Assert(gf_length);
 
-    return AddEventToQueue(new GameEvent(GetNextEventInstanceId(), obj, currentGF, gf_length, id));
+    if(statistics_)
+        statistics_->onAdded(obj->GetGOT(), id);
+    return AddEventToQueue(CreateEvent(obj, currentGF, gf_length, id));
 }
 
 const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, unsigned id, unsigned gf_elapsed)
@@ -69,7 +128,9 @@ const GameEvent* EventManager::AddEvent(GameObject* obj, unsigned gf_length, uns
     RTTR_Assert(gf_length > gf_elapsed);
     // Anfang des Events in die Vergangenheit zurückverlegen
     RTTR_Assert(currentGF >= gf_elapsed);
-    return AddEventToQueue(new GameEvent(GetNextEventInstanceId(), obj, currentGF - gf_elapsed, gf_length, id));
+    if(statistics_)
+        statistics_->onAdded(obj->GetGOT(), id);
+    return AddEventToQueue(CreateEvent(obj, currentGF - gf_elapsed, gf_length, id));
 }
 
 unsigned EventManager::GetNextEventInstanceId()
@@ -84,8 +145,13 @@ void EventManager::ExecuteNextGF()
 {
     currentGF++;
 
-    ExecuteCurrentEvents();
-    DestroyCurrentObjects();
+    {
+        const AllocationScope allocationScope(AllocationTag::Events);
+        ExecuteCurrentEvents();
+        DestroyCurrentObjects();
+    }
+    if(statistics_)
+        statistics_->onGFFinished();
 }
 
 void EventManager::DestroyCurrentObjects()
@@ -131,20 +197,24 @@ void EventManager::ExecuteEvents(const EventMap::iterator& itEvents)
     // We have to allow 2 cases:
     // 1) Adding of events to current GF -> std::list allows this without invalidating any iterators
     // 2) Checking for events -> Remove all deleted events so only valid ones are in the list
-    for(auto e_it = curEvents.begin(); e_it != curEvents.end(); e_it = curEvents.erase(e_it))
+    // The nodes of executed events are kept for new events
+    for(auto e_it = curEvents.begin(); e_it != curEvents.end();)
     {
         const GameEvent* ev = *e_it;
         RTTR_Assert(ev->obj);
         RTTR_Assert(ev->obj->GetObjId() <= GameObject::GetObjIDCounter());
 
         curActiveEvent = ev;
+        if(statistics_)
+            statistics_->onExecuted(ev->obj->GetGOT(), ev->id, ev->length);
         ev->obj->HandleEvent(ev->id);
 
-        delete ev;
+        DestroyEvent(ev);
         --numActiveEvents;
+        unusedListNodes.splice(unusedListNodes.end(), curEvents, e_it++);
     }
     curActiveEvent = nullptr;
-    events.erase(itEvents);
+    RemoveEventList(itEvents);
 }
 
 void EventManager::Serialize(SerializedGameData& sgd) const
@@ -227,7 +297,10 @@ void EventManager::RemoveEvent(const GameEvent*& ep)
         return;
     }
     RemoveEventFromQueue(*ep);
-    deletePtr(ep);
+    if(statistics_)
+        statistics_->onRemoved(ep->obj->GetGOT(), ep->id, currentGF - ep->startGF);
+    DestroyEvent(ep);
+    ep = nullptr;
 }
 
 void EventManager::RemoveEventFromQueue(const GameEvent& event)
@@ -240,7 +313,7 @@ void EventManager::RemoveEventFromQueue(const GameEvent& event)
         auto e_it = helpers::find(eventsAtTime, &event);
         if(e_it != eventsAtTime.end())
         {
-            eventsAtTime.erase(e_it);
+            unusedListNodes.splice(unusedListNodes.end(), eventsAtTime, e_it);
             --numActiveEvents;
             RTTR_Assert(!helpers::contains(eventsAtTime, &event)); // Event existed multiple times?
         } else
@@ -252,7 +325,7 @@ void EventManager::RemoveEventFromQueue(const GameEvent& event)
         // Note: Removing this is possible, as it cannot be the currently processed list
         //       because there is always the curActiveEvent left, which cannot be removed (check above)
         if(eventsAtTime.empty())
-            events.erase(itEventsAtTime);
+            RemoveEventList(itEventsAtTime);
     } else
     {
         RTTR_Assert(false);
@@ -271,3 +344,17 @@ void EventManager::AddToKillList(std::unique_ptr<GameObject> obj)
 {
     AddToKillList(obj.release());
 }
+
+void EventManager::EnableStatistics(bool enable)
+{
+    if(!enable)
+        statistics_.reset();
+    else if(!statistics_)
+        statistics_ = std::make_unique<EventStatistics>();
+}
+
+void EventManager::ResetStatistics()
+{
+    if(statistics_)
+        statistics_->reset();
+}
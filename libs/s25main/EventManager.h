@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+class EventStatistics;
 class SerializedGameData;
 class GameEvent;
 class GameObject;
@@ -53,6 +54,12 @@ public:
     /// Return true if the object will be destroyed after the current GF
     bool IsObjectInKillList(const GameObject& obj);
 
+    /// Enable or disable collecting statistics about the events. Disabling discards the collected statistics
+    void EnableStatistics(bool enable);
+    /// Return the collected statistics or nullptr if disabled
+    const EventStatistics* GetStatistics() const { return statistics_.get(); }
+    void ResetStatistics();
+
 protected:
     // Use list to allow removing of events while iterating (Event A can cause Event B in the same GF to be removed)
     using EventList = std::list<const GameEvent*>;
@@ -66,8 +73,24 @@ protected:
     EventMap events;      /// Mapping of GF to Events to be executed in this GF
     GameObjList killList; /// Objects that will be killed after current GF
     const GameEvent* curActiveEvent;
+    std::unique_ptr<EventStatistics> statistics_;
+    /// Storage of executed and removed events, list nodes and map nodes which is reused for new events.
+    /// Walking figures add and execute an event for each step, so this avoids allocations for most of them
+    std::vector<void*> unusedEventStorage;
+    EventList unusedListNodes;
+    std::vector<EventMap::node_type> unusedMapNodes;
 
     const GameEvent* AddEventToQueue(const GameEvent* event);
+    /// Create a new event reusing the storage of a previous event if possible
+    const GameEvent* CreateEvent(GameObject* obj, unsigned startGF, unsigned length, unsigned id);
+    /// Destroy the event keeping its storage for new events
+    void DestroyEvent(const GameEvent* event);
+    /// Return the list of events to be executed in the given GF, adding it if it does not exist
+    EventList& GetEventList(unsigned gf);
+    /// Remove the (empty) list of events to be executed in the GF of the iterator
+    void RemoveEventList(const EventMap::iterator& itEvents);
+    /// Free the storage kept for new events
+    void FreeUnusedStorage();
     void RemoveEventFromQueue(const GameEvent& event);
     /// Execute all events of the current GF
     void ExecuteCurrentEvents();
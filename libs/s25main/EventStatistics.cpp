@@ -0,0 +1,164 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "EventStatistics.h"
+#include "helpers/EnumRange.h"
+#include "helpers/containerUtils.h"
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace {
+constexpr std::array GO_TYPE_NAMES = {
+  "Nothing", "NobHq", "NobMilitary", "NobStorehouse", "NobUsual", "NobShipyard", "NobHarborbuilding", "Buildingsite",
+  "NofAggressivedefender", "NofAttacker", "NofDefender", "NofPassivesoldier", "NofWellguy", "NofCarrier",
+  "NofWoodcutter", "NofFisher", "NofForester", "NofCarpenter", "NofStonemason", "NofHunter", "NofFarmer",
+  "NofMiller", "NofBaker", "NofButcher", "NofMiner", "NofBrewer", "NofPigbreeder", "NofDonkeybreeder",
+  "NofIronfounder", "NofMinter", "NofMetalworker", "NofArmorer", "NofBuilder", "NofPlaner", "NofGeologist",
+  "NofShipwright", "NofScoutFree", "NofScoutLookouttower", "NofWarehouseworker", "NofCatapultman",
+  "NofPassiveworker", "NofCharburner", "Extension", "Envobject", "Fire", "Flag", "Grainfield", "Granite", "Sign",
+  "Skeleton", "Staticobject", "Disappearingmapenvobject", "Tree", "Animal", "Fighting", "Roadsegment", "Ware",
+  "Catapultstone", "Burnedwarehouse", "Shipbuildingsite", "Ship", "Charburnerpile", "NofTradeleader",
+  "NofTradedonkey", "Economymodehandler", "NofWinegrower", "NofVintner", "NofTempleservant", "Grapefield",
+  "NobTemple", "NofSkinner", "NofTanner", "NofLeatherWorker"};
+// GO_Type starts at 1, so the max value is the number of values. Add the names of new types above
+static_assert(GO_TYPE_NAMES.size() == helpers::MaxEnumValue_v<GO_Type>);
+} // namespace
+
+const char* getGOTypeName(GO_Type type)
+{
+    // GO_Type starts at 1
+    return GO_TYPE_NAMES[rttr::enum_cast(type) - 1u];
+}
+
+double EventStatistics::Counters::getAvgLifetime() const
+{
+    const uint64_t numFinished = getNumFinished();
+    return numFinished ? static_cast<double>(totalLifetime) / numFinished : 0.;
+}
+
+EventStatistics::Counters& EventStatistics::Counters::operator+=(const Counters& rhs)
+{
+    added += rhs.added;
+    executed += rhs.executed;
+    removed += rhs.removed;
+    totalLifetime += rhs.totalLifetime;
+    return *this;
+}
+
+EventStatistics::Counters& EventStatistics::getCounters(GO_Type type, unsigned eventId)
+{
+    std::vector<Counters>& typeCounters = counters_[type];
+    if(eventId >= typeCounters.size())
+        typeCounters.resize(eventId + 1u);
+    return typeCounters[eventId];
+}
+
+void EventStatistics::onExecuted(GO_Type type, unsigned eventId, unsigned lifetime)
+{
+    Counters& counters = getCounters(type, eventId);
+    counters.executed++;
+    counters.totalLifetime += lifetime;
+    numExecutedInCurGF_++;
+}
+
+void EventStatistics::onRemoved(GO_Type type, unsigned eventId, unsigned lifetime)
+{
+    Counters& counters = getCounters(type, eventId);
+    counters.removed++;
+    counters.totalLifetime += lifetime;
+}
+
+void EventStatistics::onGFFinished()
+{
+    unsigned bucket = 0;
+    while(bucket + 1u < NUM_EVENTS_PER_GF_BUCKETS && getBucketStart(bucket + 1u) <= numExecutedInCurGF_)
+        bucket++;
+    eventsPerGF_[bucket]++;
+    maxEventsPerGF_ = std::max(maxEventsPerGF_, numExecutedInCurGF_);
+    numExecutedInCurGF_ = 0;
+    numGFs_++;
+}
+
+void EventStatistics::reset()
+{
+    *this = EventStatistics();
+}
+
+EventStatistics::Counters EventStatistics::getCounters(GO_Type type) const
+{
+    Counters result;
+    for(const Counters& counters : counters_[type])
+        result += counters;
+    return result;
+}
+
+EventStatistics::Counters EventStatistics::getTotal() const
+{
+    Counters result;
+    for(const auto type : helpers::enumRange<GO_Type>())
+        result += getCounters(type);
+    return result;
+}
+
+std::vector<EventStatistics::Entry> EventStatistics::getEntries() const
+{
+    std::vector<Entry> entries;
+    for(const auto type : helpers::enumRange<GO_Type>())
+    {
+        const std::vector<Counters>& typeCounters = counters_[type];
+        for(unsigned eventId = 0; eventId < typeCounters.size(); eventId++)
+        {
+            if(typeCounters[eventId].added > 0 || typeCounters[eventId].getNumFinished() > 0)
+                entries.push_back(Entry{type, eventId, typeCounters[eventId]});
+        }
+    }
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& lhs, const Entry& rhs) {
+        return lhs.counters.executed > rhs.counters.executed;
+    });
+    return entries;
+}
+
+void EventStatistics::print(std::ostream& os, unsigned maxEntries) const
+{
+    const Counters total = getTotal();
+    os << "Event statistics over " << numGFs_ << " GFs: " << total.added << " added, " << total.executed
+       << " executed, " << total.removed << " removed\n";
+    if(numGFs_ > 0)
+    {
+        os << "Executed events per GF: " << std::fixed << std::setprecision(2)
+           << static_cast<double>(total.executed) / numGFs_ << " on average, " << maxEventsPerGF_ << " at most\n";
+    }
+
+    os << std::left << std::setw(26) << "Object type" << std::right << std::setw(6) << "Event" << std::setw(12)
+       << "Added" << std::setw(12) << "Executed" << std::setw(12) << "Removed" << std::setw(14) << "Avg. lifetime"
+       << '\n';
+    const std::vector<Entry> entries = getEntries();
+    for(unsigned i = 0; i < std::min<size_t>(maxEntries, entries.size()); i++)
+    {
+        const Entry& entry = entries[i];
+        os << std::left << std::setw(26) << getGOTypeName(entry.type) << std::right << std::setw(6) << entry.eventId
+           << std::setw(12) << entry.counters.added << std::setw(12) << entry.counters.executed << std::setw(12)
+           << entry.counters.removed << std::setw(14) << std::fixed << std::setprecision(1)
+           << entry.counters.getAvgLifetime() << '\n';
+    }
+    if(entries.size() > maxEntries)
+        os << "... and " << entries.size() - maxEntries << " more\n";
+
+    os << "Distribution of executed events per GF:\n";
+    for(unsigned bucket = 0; bucket < NUM_EVENTS_PER_GF_BUCKETS; bucket++)
+    {
+        if(!eventsPerGF_[bucket])
+            continue;
+        const unsigned start = getBucketStart(bucket);
+        os << std::right << std::setw(6) << start;
+        if(bucket + 1u == NUM_EVENTS_PER_GF_BUCKETS)
+            os << "+      ";
+        else if(getBucketStart(bucket + 1u) - 1u > start)
+            os << '-' << std::left << std::setw(6) << getBucketStart(bucket + 1u) - 1u;
+        else
+            os << "       ";
+        os << std::right << std::setw(12) << eventsPerGF_[bucket] << " GFs\n";
+    }
+}
@@ -0,0 +1,76 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "helpers/EnumArray.h"
+#include "gameTypes/GO_Type.h"
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+/// Statistics about the events handled by the EventManager.
+/// Used to find the object types causing most of the work in slow games
+class EventStatistics
+{
+public:
+    struct Counters
+    {
+        uint64_t added = 0;
+        uint64_t executed = 0;
+        /// Events removed before they were executed
+        uint64_t removed = 0;
+        /// Sum of the number of GFs between adding and executing or removing of all finished events
+        uint64_t totalLifetime = 0;
+
+        uint64_t getNumFinished() const { return executed + removed; }
+        /// Average number of GFs an event existed
+        double getAvgLifetime() const;
+        Counters& operator+=(const Counters& rhs);
+    };
+    struct Entry
+    {
+        GO_Type type;
+        unsigned eventId;
+        Counters counters;
+    };
+    /// Number of buckets for the events per GF: 0, 1, 2-3, 4-7, ..., >= 2^(numBuckets-2)
+    static constexpr unsigned NUM_EVENTS_PER_GF_BUCKETS = 16;
+
+    void onAdded(GO_Type type, unsigned eventId) { getCounters(type, eventId).added++; }
+    void onExecuted(GO_Type type, unsigned eventId, unsigned lifetime);
+    void onRemoved(GO_Type type, unsigned eventId, unsigned lifetime);
+    /// Called after all events of a GF have been executed
+    void onGFFinished();
+    void reset();
+
+    /// Counters of all events of the given type
+    Counters getCounters(GO_Type type) const;
+    Counters getTotal() const;
+    /// Counters for each used combination of object type and event id, most executed first
+    std::vector<Entry> getEntries() const;
+    uint64_t getNumGFs() const { return numGFs_; }
+    unsigned getMaxEventsPerGF() const { return maxEventsPerGF_; }
+    /// Number of GFs per bucket of executed events, see NUM_EVENTS_PER_GF_BUCKETS
+    const std::array<uint64_t, NUM_EVENTS_PER_GF_BUCKETS>& getEventsPerGF() const { return eventsPerGF_; }
+    /// Get the lowest number of events in the given bucket of getEventsPerGF
+    static unsigned getBucketStart(unsigned bucket) { return bucket == 0 ? 0 : 1u << (bucket - 1); }
+
+    /// Write a human readable report containing at most maxEntries entries per object type and event id
+    void print(std::ostream& os, unsigned maxEntries = 50) const;
+
+private:
+    Counters& getCounters(GO_Type type, unsigned eventId);
+
+    /// Counters per object type indexed by event id
+    helpers::EnumArray<std::vector<Counters>, GO_Type> counters_;
+    std::array<uint64_t, NUM_EVENTS_PER_GF_BUCKETS> eventsPerGF_{};
+    unsigned numExecutedInCurGF_ = 0;
+    unsigned maxEventsPerGF_ = 0;
+    uint64_t numGFs_ = 0;
+};
+
+/// Name of the object type for debug output
+const char* getGOTypeName(GO_Type type);
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -90,6 +90,8 @@ public:
         return *this;
     }
 
+    GCType GetType() const { return gcType; }
+
     /// Builds a GameCommand depending on Type
     static GameCommandPtr Deserialize(Deserializer& ser);
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2025 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -436,4 +436,33 @@ void TradeOverLand::Execute(GameWorld& world, uint8_t playerId)
         world.GetPlayer(playerId).Trade(bld, what, count);
 }
 
+void removeRedundantCommands(std::vector<GameCommandPtr>& gcs)
+{
+    std::vector<GameCommandPtr> result;
+    result.reserve(gcs.size());
+    // Start of the current sequence of SetInventorySetting commands in result
+    size_t sequenceStart = 0;
+    for(GameCommandPtr& gc : gcs)
+    {
+        const bool isSetting = gc->GetType() == GCType::SetInventorySetting;
+        if(isSetting)
+        {
+            const auto& setting = static_cast<const SetInventorySetting&>(*gc);
+            const auto itSequenceStart = result.rbegin() + (result.size() - sequenceStart);
+            const auto itPrevious =
+              std::find_if(result.rbegin(), itSequenceStart, [&setting](const GameCommandPtr& other) {
+                  return setting.isSameSetting(static_cast<const SetInventorySetting&>(*other));
+              });
+            // Setting the state the setting already has does nothing
+            if(itPrevious != itSequenceStart
+               && setting.isSameChange(static_cast<const SetInventorySetting&>(**itPrevious)))
+                continue;
+        }
+        result.push_back(std::move(gc));
+        if(!isSetting)
+            sequenceStart = result.size();
+    }
+    gcs = std::move(result);
+}
+
 } // namespace gc
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -485,6 +485,16 @@ public:
     }
 
     void Execute(GameWorld& world, uint8_t playerId) override;
+    /// True if both commands change the same setting of the same warehouse
+    bool isSameSetting(const SetInventorySetting& other) const { return pt_ == other.pt_ && what == other.what; }
+    /// True if both commands change the same setting of the same warehouse to the same state
+    bool isSameChange(const SetInventorySetting& other) const
+    {
+        InventorySetting validState = state, otherValidState = other.state;
+        validState.MakeValid();
+        otherValidState.MakeValid();
+        return isSameSetting(other) && validState == otherValidState;
+    }
 };
 
 /// Alle Einlagerungseinstellungen (für alle Menschen oder Waren) von einem Lagerhaus verändern
@@ -839,4 +849,9 @@ public:
     void Execute(GameWorld& world, uint8_t playerId) override;
 };
 
+/// Remove commands which don't change anything as an earlier command in the list already did the same without any
+/// other command in between, i.e. repeated SetInventorySetting to the same state.
+/// Other commands for the same setting are kept, as each change of it can have side effects, e.g. adding events
+void removeRedundantCommands(std::vector<GameCommandPtr>& gcs);
+
 } // namespace gc
@@ -1,9 +1,10 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GameObject.h"
 #include "EventManager.h"
+#include "GameObjectPool.h"
 #include "SerializedGameData.h"
 #include "postSystem/PostMsg.h"
 #include "world/GameWorld.h"
@@ -36,6 +37,16 @@ GameObject::GameObject(const GameObject& go) : objId(go.objId)
     ++objCounter_;
 }
 
+void* GameObject::operator new(const size_t size)
+{
+    return GameObjectPool::allocate(size);
+}
+
+void GameObject::operator delete(void* ptr, const size_t size) noexcept
+{
+    GameObjectPool::deallocate(ptr, size);
+}
+
 void GameObject::Destroy() {}
 
 GameObject::~GameObject()
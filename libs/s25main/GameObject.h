@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
@@ -30,6 +30,10 @@ protected:
 public:
     GameObject& operator=(const GameObject&) = delete;
 
+    /// Game objects are allocated from the GameObjectPool
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size) noexcept;
+
     /// Handle destruction before deleting the instance
     virtual void Destroy() = 0;
 
@@ -0,0 +1,87 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GameObjectPool.h"
+#include "RTTR_Assert.h"
+#include <algorithm>
+#include <new>
+
+namespace {
+/// Object sizes are rounded up to this, so all objects are suitably aligned
+constexpr size_t granularity = alignof(std::max_align_t);
+constexpr size_t slabSize = 64 * 1024;
+constexpr size_t minObjectsPerSlab = 8;
+} // namespace
+
+size_t GameObjectPool::numObjects_ = 0;
+
+std::vector<GameObjectPool::Pool>& GameObjectPool::getPools()
+{
+    // Index is the object size divided by the granularity
+    static std::vector<Pool> pools;
+    return pools;
+}
+
+size_t GameObjectPool::getObjectSize(const size_t size)
+{
+    return std::max((size + granularity - 1) / granularity, size_t(1)) * granularity;
+}
+
+void* GameObjectPool::allocate(const size_t size)
+{
+    const size_t objSize = getObjectSize(size);
+    std::vector<Pool>& pools = getPools();
+    const size_t poolIdx = objSize / granularity;
+    if(poolIdx >= pools.size())
+        pools.resize(poolIdx + 1);
+    Pool& pool = pools[poolIdx];
+
+    void* result;
+    if(pool.freeObjects)
+    {
+        result = pool.freeObjects;
+        pool.freeObjects = pool.freeObjects->next;
+    } else
+    {
+        if(pool.unusedBegin == pool.unusedEnd)
+        {
+            const size_t curSlabSize = std::max(slabSize / objSize, minObjectsPerSlab) * objSize;
+            // Uses the global allocation functions, so only the slabs are seen by the AllocationStatistics
+            pool.slabs.emplace_back(new std::byte[curSlabSize]);
+            pool.unusedBegin = pool.slabs.back().get();
+            pool.unusedEnd = pool.unusedBegin + curSlabSize;
+        }
+        result = pool.unusedBegin;
+        pool.unusedBegin += objSize;
+    }
+    ++numObjects_;
+    return result;
+}
+
+void GameObjectPool::deallocate(void* ptr, const size_t size) noexcept
+{
+    if(!ptr)
+        return;
+    const size_t poolIdx = getObjectSize(size) / granularity;
+    RTTR_Assert(poolIdx < getPools().size());
+    RTTR_Assert(numObjects_ > 0u);
+    Pool& pool = getPools()[poolIdx];
+    pool.freeObjects = new(ptr) FreeObject{pool.freeObjects};
+    if(--numObjects_ == 0u)
+        release();
+}
+
+size_t GameObjectPool::getNumSlabs()
+{
+    size_t numSlabs = 0;
+    for(const Pool& pool : getPools())
+        numSlabs += pool.slabs.size();
+    return numSlabs;
+}
+
+void GameObjectPool::release()
+{
+    RTTR_Assert(numObjects_ == 0u);
+    getPools().clear();
+}
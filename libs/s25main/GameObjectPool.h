@@ -0,0 +1,48 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/// Memory for all game objects.
+/// Objects are placed in slabs holding only objects of the same size, so all objects of one type are next to each other
+/// instead of being scattered over the heap. Memory of destroyed objects is reused for the next object of that size.
+/// The slabs are freed all at once when the last game object is destroyed, e.g. when a game ends.
+/// Like the game objects themselves this must only be used by one thread.
+class GameObjectPool
+{
+public:
+    static void* allocate(size_t size);
+    static void deallocate(void* ptr, size_t size) noexcept;
+
+    /// Number of objects currently allocated from the pools
+    static size_t getNumObjects() { return numObjects_; }
+    /// Number of slabs currently used by all pools
+    static size_t getNumSlabs();
+
+private:
+    struct FreeObject
+    {
+        FreeObject* next;
+    };
+    struct Pool
+    {
+        std::vector<std::unique_ptr<std::byte[]>> slabs;
+        /// Memory of destroyed objects
+        FreeObject* freeObjects = nullptr;
+        /// Part of the last slab that was never used
+        std::byte* unusedBegin = nullptr;
+        std::byte* unusedEnd = nullptr;
+    };
+
+    static std::vector<Pool>& getPools();
+    static size_t getObjectSize(size_t size);
+    /// Free the slabs of all pools
+    static void release();
+
+    static size_t numObjects_;
+};
@@ -47,11 +47,13 @@
 #include "gameData/ShieldConsts.h"
 #include "gameData/ToolConsts.h"
 #include "s25util/Log.h"
+#include <iterator>
 #include <limits>
 #include <numeric>
 
 GamePlayer::GamePlayer(unsigned playerId, const PlayerInfo& playerInfo, GameWorld& world)
-    : GamePlayerInfo(playerId, playerInfo), world(world), hqPos(MapPoint::Invalid()), emergency(false)
+    : GamePlayerInfo(playerId, playerInfo), world(world), numRoadNodeIndices(0), hqPos(MapPoint::Invalid()),
+      emergency(false)
 {
     std::fill(building_enabled.begin(), building_enabled.end(), true);
 
@@ -249,10 +251,13 @@ void GamePlayer::Deserialize(SerializedGameData& sgd)
     sgd.PopObjectContainer(roads, GO_Type::Roadsegment);
 
     jobs_wanted.resize(sgd.PopUnsignedInt());
-    for(JobNeeded& job : jobs_wanted)
+    for(auto& jobEntries : jobsWantedPerJob_)
+        jobEntries.clear();
+    for(auto it = jobs_wanted.begin(); it != jobs_wanted.end(); ++it)
     {
-        job.job = sgd.Pop<Job>();
-        job.workplace = sgd.PopObject<noRoadNode>();
+        it->job = sgd.Pop<Job>();
+        it->workplace = sgd.PopObject<noRoadNode>();
+        jobsWantedPerJob_[it->job].push_back(it);
     }
 
     if(sgd.GetGameDataVersion() < 2)
@@ -471,6 +476,9 @@ void GamePlayer::AddBuilding(noBuilding* bld, BuildingType bldType)
     RTTR_Assert(bld->GetPlayer() == GetPlayerId());
     buildings.Add(bld, bldType);
     ChangeStatisticValue(StatisticType::Buildings, 1);
+    // Harbors add ship connections
+    if(bldType == BuildingType::HarborBuilding)
+        world.GetRoadPathFinder().RoadNetworkChanged();
 
     // Order a worker if needed
     const auto& description = BLD_WORK_DESC[bldType];
@@ -504,7 +512,9 @@ void GamePlayer::RemoveBuilding(noBuilding* bld, BuildingType bldType)
     buildings.Remove(bld, bldType);
     ChangeStatisticValue(StatisticType::Buildings, -1);
     if(bldType == BuildingType::HarborBuilding)
-    { // Schiffen Bescheid sagen
+    {
+        world.GetRoadPathFinder().RoadNetworkChanged();
+        // Schiffen Bescheid sagen
         for(noShip* ship : ships)
             ship->HarborDestroyed(static_cast<nobHarborBuilding*>(bld));
     } else if(bldType == BuildingType::Headquarters && bld->GetPos() == hqPos)
@@ -561,10 +571,25 @@ void GamePlayer::AddRoad(RoadSegment* rs)
 
 void GamePlayer::DeleteRoad(RoadSegment* rs)
 {
-    RTTR_Assert(helpers::contains(roads, rs));
+    RTTR_Assert(roads.contains(rs));
     roads.remove(rs);
 }
 
+unsigned GamePlayer::AddRoadNode()
+{
+    if(freeRoadNodeIndices.empty())
+        return numRoadNodeIndices++;
+    const unsigned idx = freeRoadNodeIndices.back();
+    freeRoadNodeIndices.pop_back();
+    return idx;
+}
+
+void GamePlayer::RemoveRoadNode(const unsigned idx)
+{
+    RTTR_Assert(idx < numRoadNodeIndices);
+    freeRoadNodeIndices.push_back(idx);
+}
+
 void GamePlayer::FindClientForLostWares()
 {
     // Alle Lost-Wares müssen gucken, ob sie ein Lagerhaus finden
@@ -775,16 +800,26 @@ void GamePlayer::AddJobWanted(const Job job, noRoadNode* workplace)
     {
         JobNeeded jn = {job, workplace};
         jobs_wanted.push_back(jn);
+        jobsWantedPerJob_[job].push_back(std::prev(jobs_wanted.end()));
     }
 }
 
+std::list<GamePlayer::JobNeeded>::iterator GamePlayer::EraseJobWanted(const std::list<JobNeeded>::iterator it)
+{
+    auto& jobEntries = jobsWantedPerJob_[it->job];
+    const auto itEntry = helpers::find(jobEntries, it);
+    RTTR_Assert(itEntry != jobEntries.end());
+    jobEntries.erase(itEntry);
+    return jobs_wanted.erase(it);
+}
+
 void GamePlayer::JobNotWanted(noRoadNode* workplace, bool all)
 {
     for(auto it = jobs_wanted.begin(); it != jobs_wanted.end();)
     {
         if(it->workplace == workplace)
         {
-            it = jobs_wanted.erase(it);
+            it = EraseJobWanted(it);
             if(!all)
                 return;
         } else
@@ -796,10 +831,14 @@ void GamePlayer::JobNotWanted(noRoadNode* workplace, bool all)
 
 void GamePlayer::OneJobNotWanted(const Job job, noRoadNode* workplace)
 {
-    const auto it = helpers::find_if(
-      jobs_wanted, [workplace, job](const auto& it) { return it.workplace == workplace && it.job == job; });
-    if(it != jobs_wanted.end())
-        jobs_wanted.erase(it);
+    // The first entry of that job is also the first one in jobs_wanted
+    auto& jobEntries = jobsWantedPerJob_[job];
+    const auto it = helpers::find_if(jobEntries, [workplace](const auto& it) { return it->workplace == workplace; });
+    if(it != jobEntries.end())
+    {
+        jobs_wanted.erase(*it);
+        jobEntries.erase(it);
+    }
 }
 
 void GamePlayer::SendPostMessage(std::unique_ptr<PostMsg> msg)
@@ -863,12 +902,24 @@ bool GamePlayer::FindWarehouseForJob(const Job job, noRoadNode& goal) const
     return false;
 }
 
+bool GamePlayer::IsJobAvailable(const Job job) const
+{
+    const FW::HasFigure hasFigure(job, true);
+    return helpers::contains_if(buildings.GetStorehouses(),
+                                [&hasFigure](const nobBaseWarehouse* wh) { return hasFigure(*wh); });
+}
+
 void GamePlayer::FindWarehouseForAllJobs()
 {
+    // Ordering a job only ever removes figures and tools from the warehouses.
+    // So jobs which are not available now won't become available during the loop and can be skipped.
+    helpers::EnumArray<bool, Job> isJobAvailable{};
+    for(const auto job : helpers::EnumRange<Job>{})
+        isJobAvailable[job] = !jobsWantedPerJob_[job].empty() && IsJobAvailable(job);
     for(auto it = jobs_wanted.begin(); it != jobs_wanted.end();)
     {
-        if(FindWarehouseForJob(it->job, *it->workplace))
-            it = jobs_wanted.erase(it);
+        if(isJobAvailable[it->job] && FindWarehouseForJob(it->job, *it->workplace))
+            it = EraseJobWanted(it);
         else
             ++it;
     }
@@ -876,14 +927,15 @@ void GamePlayer::FindWarehouseForAllJobs()
 
 void GamePlayer::FindWarehouseForAllJobs(const Job job)
 {
-    for(auto it = jobs_wanted.begin(); it != jobs_wanted.end();)
+    if(!IsJobAvailable(job))
+        return;
+    auto& jobEntries = jobsWantedPerJob_[job];
+    for(auto it = jobEntries.begin(); it != jobEntries.end();)
     {
-        if(it->job == job)
+        if(FindWarehouseForJob(job, *(*it)->workplace))
         {
-            if(FindWarehouseForJob(it->job, *it->workplace))
-                it = jobs_wanted.erase(it);
-            else
-                ++it;
+            jobs_wanted.erase(*it);
+            it = jobEntries.erase(it);
         } else
             ++it;
     }
@@ -1012,27 +1064,16 @@ RoadSegment* GamePlayer::FindRoadForDonkey(noRoadNode& start, noRoadNode** goal)
     return best_road;
 }
 
-struct ClientForWare
+bool GamePlayer::ClientForWare::operator<(const ClientForWare& b) const noexcept
 {
-    noBaseBuilding* bld;
-    unsigned estimate; // points minus half the optimal distance
-    unsigned points;
-
-    ClientForWare(noBaseBuilding* bld, unsigned estimate, unsigned points)
-        : bld(bld), estimate(estimate), points(points)
-    {}
-
-    bool operator<(const ClientForWare& b) const noexcept
-    {
-        // use estimate, points and object id (as tie breaker) for sorting
-        if(estimate != b.estimate)
-            return estimate > b.estimate;
-        else if(points != b.points)
-            return points > b.points;
-        else
-            return bld->GetObjId() > b.bld->GetObjId();
-    }
-};
+    // use estimate, points and object id (as tie breaker) for sorting
+    if(estimate != b.estimate)
+        return estimate > b.estimate;
+    else if(points != b.points)
+        return points > b.points;
+    else
+        return bld->GetObjId() > b.bld->GetObjId();
+}
 
 noBaseBuilding* GamePlayer::FindClientForWare(const Ware& ware)
 {
@@ -1048,7 +1089,8 @@ noBaseBuilding* GamePlayer::FindClientForWare(const Ware& ware)
     Distribution& wareDistribution =
       (gt == GoodType::Bread || gt == GoodType::Meat) ? distribution[GoodType::Fish] : distribution[gt];
 
-    std::vector<ClientForWare> possibleClients;
+    std::vector<ClientForWare>& possibleClients = clientsForWare_;
+    possibleClients.clear();
 
     const noRoadNode* start = ware.GetLocation();
 
@@ -1067,54 +1109,56 @@ noBaseBuilding* GamePlayer::FindClientForWare(const Ware& ware)
         }
     }
 
+    // BuildingType::Headquarters sind Baustellen!!, da HQs ja sowieso nicht gebaut werden können
+    helpers::EnumArray<bool, BuildingType> isClientBldType{};
     for(const auto bldType : wareDistribution.client_buildings)
+        isClientBldType[bldType] = true;
+
+    if(isClientBldType[BuildingType::Headquarters])
     {
-        // BuildingType::Headquarters sind Baustellen!!, da HQs ja sowieso nicht gebaut werden können
-        if(bldType == BuildingType::Headquarters)
+        // Bei Baustellen die Extraliste abfragen
+        for(noBuildingSite* bldSite : buildings.GetBuildingSites())
         {
-            // Bei Baustellen die Extraliste abfragen
-            for(noBuildingSite* bldSite : buildings.GetBuildingSites())
-            {
-                // Optimization: Ignore if unconnected
-                if(!bldSite->IsConnected())
-                    continue;
+            // Optimization: Ignore if unconnected
+            if(!bldSite->IsConnected())
+                continue;
 
-                unsigned points = bldSite->CalcDistributionPoints(gt);
-                if(!points)
-                    continue;
+            unsigned points = bldSite->CalcDistributionPoints(gt);
+            if(!points)
+                continue;
 
-                points += wareDistribution.percent_buildings[BuildingType::Headquarters] * 30;
-                unsigned distance = world.CalcDistance(start->GetPos(), bldSite->GetPos()) / 2;
-                possibleClients.push_back(ClientForWare(bldSite, points > distance ? points - distance : 0, points));
-            }
-        } else
-        {
-            // Für übrige Gebäude
-            for(nobUsual* bld : buildings.GetBuildings(bldType))
-            {
-                // Optimization: Ignore if unconnected
-                if(!bld->IsConnected())
-                    continue;
+            points += wareDistribution.percent_buildings[BuildingType::Headquarters] * 30;
+            unsigned distance = world.CalcDistance(start->GetPos(), bldSite->GetPos()) / 2;
+            possibleClients.push_back(ClientForWare(bldSite, points > distance ? points - distance : 0, points));
+        }
+    }
 
-                unsigned points = bld->CalcDistributionPoints(gt);
-                if(!points)
-                    continue; // Ware not needed
+    // Für übrige Gebäude: Only those requesting this ware.
+    // The order doesn't matter as the candidates get sorted by a strict order
+    for(nobUsual* bld : buildings.GetWareClients(gt))
+    {
+        if(!isClientBldType[bld->GetBuildingType()])
+            continue;
+        // Optimization: Ignore if unconnected
+        if(!bld->IsConnected())
+            continue;
 
-                if(!wareDistribution.goals.empty())
-                {
-                    if(bld->GetBuildingType()
-                       == static_cast<BuildingType>(wareDistribution.goals[wareDistribution.selected_goal]))
-                        points += 300;
-                    else if(points >= 300) // avoid overflows (async!)
-                        points -= 300;
-                    else
-                        points = 0;
-                }
+        unsigned points = bld->CalcDistributionPoints(gt);
+        RTTR_Assert(points); // Otherwise it would not be in the list
 
-                unsigned distance = world.CalcDistance(start->GetPos(), bld->GetPos()) / 2;
-                possibleClients.push_back(ClientForWare(bld, points > distance ? points - distance : 0, points));
-            }
+        if(!wareDistribution.goals.empty())
+        {
+            if(bld->GetBuildingType()
+               == static_cast<BuildingType>(wareDistribution.goals[wareDistribution.selected_goal]))
+                points += 300;
+            else if(points >= 300) // avoid overflows (async!)
+                points -= 300;
+            else
+                points = 0;
         }
+
+        unsigned distance = world.CalcDistance(start->GetPos(), bld->GetPos()) / 2;
+        possibleClients.push_back(ClientForWare(bld, points > distance ? points - distance : 0, points));
     }
 
     // sort our clients, highest score first
@@ -1395,7 +1439,7 @@ void GamePlayer::CallFlagWorker(const MapPoint pt, const Job job)
 
 bool GamePlayer::IsFlagWorker(const nofFlagWorker* flagworker)
 {
-    return helpers::contains(flagworkers, flagworker);
+    return flagworkers.contains(flagworker);
 }
 
 void GamePlayer::FlagDestroyed(noFlag* flag)
@@ -1864,7 +1908,7 @@ void GamePlayer::MakeStartPacts()
 
 bool GamePlayer::IsWareRegistred(const Ware& ware)
 {
-    return helpers::contains(ware_list, &ware);
+    return ware_list.contains(&ware);
 }
 
 bool GamePlayer::IsWareDependent(const Ware& ware)
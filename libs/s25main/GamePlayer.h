@@ -34,6 +34,7 @@ class nobBaseWarehouse;
 class nobHarborBuilding;
 class nobHQ;
 class nobMilitary;
+class nobUsual;
 class nofCarrier;
 class nofFlagWorker;
 class PostMsg;
@@ -66,6 +67,18 @@ public:
         uint16_t currentIndex;
         // Counter, bei jedem vierten Update jeweils Daten zu den längerfristigen Statistiken kopieren
         uint16_t counter;
+
+        /// Index of the value recorded the given number of steps before the latest one
+        unsigned GetIdx(unsigned stepsAgo) const
+        {
+            RTTR_Assert(stepsAgo < NUM_STAT_STEPS);
+            return (currentIndex >= stepsAgo) ? currentIndex - stepsAgo : NUM_STAT_STEPS - stepsAgo + currentIndex;
+        }
+        uint32_t GetValue(StatisticType type, unsigned stepsAgo) const { return data[type][GetIdx(stepsAgo)]; }
+        uint16_t GetMerchandiseValue(unsigned merchandiseType, unsigned stepsAgo) const
+        {
+            return merchandiseData[merchandiseType][GetIdx(stepsAgo)];
+        }
     };
 
     // Informationen über die Verteilung
@@ -103,6 +116,8 @@ public:
     void AddBuildingSite(noBuildingSite* bldSite);
     void RemoveBuildingSite(noBuildingSite* bldSite);
     const BuildingRegister& GetBuildingRegister() const { return buildings; }
+    /// Notify that the wares requested by the building might have changed
+    void WareNeedsChanged(nobUsual& bld) { buildings.UpdateWareNeeds(bld); }
 
     /// Notify that a new road connection exists (not only an existing road splitted)
     void NewRoadConnection(RoadSegment* rs);
@@ -114,6 +129,13 @@ public:
     void DeleteRoad(RoadSegment* rs);
     /// Sucht einen Träger für die Straße und ruft ggf den Träger aus dem jeweiligen nächsten Lagerhaus
     bool FindCarrierForRoad(RoadSegment& rs) const;
+    /// Get an index for a new road node (flag or building) of this player.
+    /// Indices of removed nodes are reused, so they stay below the number of road nodes ever alive at the same time
+    unsigned AddRoadNode();
+    /// Release the index of a road node which was removed or changed its owner
+    void RemoveRoadNode(unsigned idx);
+    /// Upper bound of all road node indices of this player
+    unsigned GetNumRoadNodeIndices() const { return numRoadNodeIndices; }
     /// Returns true if the given wh does still exist and hence the ptr is valid
     bool IsWarehouseValid(nobBaseWarehouse* wh) const;
     /// Gibt erstes Lagerhaus zurück
@@ -181,6 +203,8 @@ public:
         ware_list.remove(&ware);
     }
     bool IsWareRegistred(const Ware& ware);
+    /// Number of existing wares, i.e. goods of the player not stored in a warehouse
+    unsigned GetNumWares() const { return static_cast<unsigned>(ware_list.size()); }
     bool IsWareDependent(const Ware& ware);
 
     /// Fügt Waren zur Inventur hinzu
@@ -346,13 +370,30 @@ public:
     static BuildOrders GetStandardBuildOrder();
 
 private:
+    /// Possible goal of a ware with the points it would get
+    struct ClientForWare
+    {
+        noBaseBuilding* bld;
+        unsigned estimate; // points minus half the optimal distance
+        unsigned points;
+
+        ClientForWare(noBaseBuilding* bld, unsigned estimate, unsigned points)
+            : bld(bld), estimate(estimate), points(points)
+        {}
+
+        bool operator<(const ClientForWare& b) const noexcept;
+    };
+
     /// Access to the world
     GameWorld& world;
     /// List of all buildings
     BuildingRegister buildings; //-V730_NOINIT
 
     /// Lister aller Straßen von dem Spieler
-    std::list<RoadSegment*> roads;
+    helpers::OrderedPtrSet<RoadSegment> roads;
+    /// Dense indices of the road nodes for the path finding. Not part of the game state, reassigned on load
+    unsigned numRoadNodeIndices;
+    std::vector<unsigned> freeRoadNodeIndices;
 
     struct JobNeeded
     {
@@ -362,13 +403,17 @@ private:
 
     /// Liste von Baustellen/Gebäuden, die bestimmten Beruf wollen
     std::list<JobNeeded> jobs_wanted;
+    /// Entries of jobs_wanted per job in the same order. Not serialized but recreated from jobs_wanted
+    helpers::EnumArray<std::list<std::list<JobNeeded>::iterator>, Job> jobsWantedPerJob_;
 
     /// Liste von sämtlichen Waren, die herumgetragen werden und an Fahnen liegen
-    std::list<Ware*> ware_list;
+    helpers::OrderedPtrSet<Ware> ware_list;
     /// Liste von Geologen und Spähern, die an eine Flagge gebunden sind
-    std::list<nofFlagWorker*> flagworkers;
+    helpers::OrderedPtrSet<nofFlagWorker> flagworkers;
     /// Liste von Schiffen dieses Spielers
     std::vector<noShip*> ships;
+    /// Reused buffer for the candidates in FindClientForWare. Not part of the game state
+    std::vector<ClientForWare> clientsForWare_;
 
     /// Liste mit Punkten, die schon von Schiffen entdeckt wurden
     std::vector<MapPoint> enemies_discovered_by_ships;
@@ -435,6 +480,10 @@ private:
     void PactChanged(PactType pt);
     // Sucht Weg für Job zu entsprechenden noRoadNode
     bool FindWarehouseForJob(Job job, noRoadNode& goal) const;
+    /// Return true if any warehouse has a figure of that job or can recruit one
+    bool IsJobAvailable(Job job) const;
+    /// Remove the entry from jobs_wanted and return the following one
+    std::list<JobNeeded>::iterator EraseJobWanted(std::list<JobNeeded>::iterator it);
 
     /// Find best building for the ware according to the priority reduced by the distance.
     /// T_GetPriority must be a functor taking a "const noBaseBuilding&" and returning an unsigned priority.
@@ -18,6 +18,7 @@
 #include "helpers/EnumRange.h"
 #include "helpers/Range.h"
 #include "helpers/containerUtils.h"
+#include "helpers/format.hpp"
 #include "ogl/MusicItem.h"
 #include "ogl/SoundEffectItem.h"
 #include "ogl/glArchivItem_Bitmap_Player.h"
@@ -30,6 +31,7 @@
 #include "ogl/glTexturePacker.h"
 #include "resources/ArchiveLoader.h"
 #include "resources/ArchiveLocator.h"
+#include "resources/AssetCache.h"
 #include "resources/ResolvedFile.h"
 #include "gameTypes/Direction.h"
 #include "gameTypes/DirectionToImgDir.h"
@@ -39,6 +41,7 @@
 #include "libsiedler2/ArchivItem_Font.h"
 #include "libsiedler2/ArchivItem_Palette.h"
 #include "libsiedler2/ArchivItem_PaletteAnimation.h"
+#include "libsiedler2/ArchivItem_Sound_Wave.h"
 #include "libsiedler2/ArchivItem_Text.h"
 #include "libsiedler2/ErrorCodes.h"
 #include "libsiedler2/PixelBufferBGRA.h"
@@ -52,12 +55,16 @@
 #include <boost/pointer_cast.hpp>
 #include <boost/range/adaptor/map.hpp>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdio>
 #include <iomanip>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
 
 struct Loader::FileEntry
 {
@@ -66,6 +73,55 @@ struct Loader::FileEntry
     ResolvedFile resolvedFile;
 };
 
+struct Loader::PendingLoad
+{
+    ResourceId resId;
+    ResolvedFile resolvedFile;
+    const libsiedler2::ArchivItem_Palette* palette;
+};
+
+/// Replace the sounds by the converted ones from the cache. Returns false if the entry does not match the sounds
+static bool loadConvertedSounds(libsiedler2::Archiv& sounds, AssetCache::Reader cachedSounds)
+{
+    std::vector<std::pair<libsiedler2::ArchivItem_Sound_Wave*, std::vector<uint8_t>>> convertedSounds;
+    try
+    {
+        const auto numSounds = cachedSounds.pop<uint32_t>();
+        convertedSounds.reserve(numSounds);
+        for(unsigned i = 0; i < numSounds; i++)
+        {
+            auto* sound = dynamic_cast<libsiedler2::ArchivItem_Sound_Wave*>(sounds[cachedSounds.pop<uint32_t>()]);
+            if(!sound)
+                return false;
+            const auto dataSize = cachedSounds.pop<uint32_t>();
+            const uint8_t* data = cachedSounds.popRaw(dataSize);
+            convertedSounds.emplace_back(sound, std::vector<uint8_t>(data, data + dataSize));
+        }
+    } catch(const std::runtime_error&)
+    {
+        return false;
+    }
+    // Only modify the sounds after the entry was read completely so they are still usable on failure
+    for(auto& soundAndData : convertedSounds)
+        setConvertedSoundData(*soundAndData.first, std::move(soundAndData.second));
+    return true;
+}
+
+static AssetCache::Writer writeConvertedSounds(const libsiedler2::Archiv& sounds,
+                                               const std::vector<unsigned>& convertedIndices)
+{
+    AssetCache::Writer writer;
+    writer.push<uint32_t>(convertedIndices.size());
+    for(const unsigned idx : convertedIndices)
+    {
+        const auto& data = dynamic_cast<const libsiedler2::ArchivItem_Sound_Wave*>(sounds[idx])->getData();
+        writer.push<uint32_t>(idx);
+        writer.push<uint32_t>(data.size());
+        writer.pushRaw(data.data(), data.size());
+    }
+    return writer;
+}
+
 template<typename T>
 static T convertChecked(libsiedler2::ArchivItem* item)
 {
@@ -272,18 +328,33 @@ bool Loader::LoadSounds()
 {
     if(!Load(config_.ExpandPath(s25::files::soundOrig)))
         return false;
+    using namespace std::chrono;
     const Timer timer(true);
-    logger_.write(_("Starting sound conversion: "));
-    try
+    libsiedler2::Archiv& sounds = GetArchive("sound");
+    const bfs::path scriptPath = config_.ExpandPath(s25::files::soundScript);
+    const AssetCache cache(config_.ExpandPath(s25::folders::cache));
+    const uint64_t cacheKey = AssetCache::Key().addFiles(files_["sound"].resolvedFile).addFile(scriptPath).get();
+    const auto cachedSounds = cache.read("sounds", cacheKey);
+    if(cachedSounds && loadConvertedSounds(sounds, cachedSounds->getReader()))
     {
-        convertSounds(GetArchive("sound"), config_.ExpandPath(s25::files::soundScript));
-    } catch(const std::runtime_error& e)
+        logger_.write(_("Loaded converted sounds from cache in %ums\n"))
+          % duration_cast<milliseconds>(timer.getElapsed()).count();
+    } else
     {
-        logger_.write(_("failed: %1%\n")) % e.what();
-        return false;
+        logger_.write(_("Starting sound conversion: "));
+        std::vector<unsigned> convertedIndices;
+        try
+        {
+            convertedIndices = convertSounds(sounds, scriptPath);
+        } catch(const std::runtime_error& e)
+        {
+            logger_.write(_("failed: %1%\n")) % e.what();
+            return false;
+        }
+        logger_.write(_("done in %ums\n")) % duration_cast<milliseconds>(timer.getElapsed()).count();
+        if(!cache.write("sounds", cacheKey, writeConvertedSounds(sounds, convertedIndices)))
+            logger_.write(_("WARNING: Could not write the converted sounds to the cache\n"));
     }
-    using namespace std::chrono;
-    logger_.write(_("done in %ums\n")) % duration_cast<milliseconds>(timer.getElapsed()).count();
 
     const bfs::path oggPath = config_.ExpandPath(s25::folders::sng);
     std::vector<bfs::path> oggFiles = ListDir(oggPath, "ogg");
@@ -501,83 +572,87 @@ NationResourcesSource getNationResourcesSource(const Nation nation, bool isWinte
 bool Loader::LoadFilesAtGame(const std::string& mapGfxPath, bool isWinterGFX, const std::vector<Nation>& nations,
                              const std::vector<AddonId>& enabledAddons)
 {
+    const Timer timer(true);
     initResourceFolders(nations, enabledAddons);
 
     namespace res = s25::resources;
-    std::vector<std::string> files = {res::rom_bobs, res::carrier,  res::jobs,     res::boat,
-                                      res::boot_z,   res::mis0bobs, res::mis1bobs, res::mis2bobs,
-                                      res::mis3bobs, res::mis4bobs, res::mis5bobs};
+    const std::vector<std::string> files = {res::rom_bobs, res::carrier,  res::jobs,     res::boat,
+                                            res::boot_z,   res::mis0bobs, res::mis1bobs, res::mis2bobs,
+                                            res::mis3bobs, res::mis4bobs, res::mis5bobs};
 
     const libsiedler2::ArchivItem_Palette* pal5 = GetPaletteN("pal5");
 
-    if(!LoadFiles(files) || !Load(ResourceId("map_new"), pal5))
-        return false;
+    std::vector<PendingLoad> loads;
+    for(const std::string& curFile : files)
+    {
+        if(!AddPendingLoad(loads, config_.ExpandPath(curFile), pal5))
+            return false;
+    }
+    // TODO: Move charburner to addon folder and make it overwrite existing file
+    for(const ResourceId& resId : {ResourceId("map_new"), ResourceId("charburner"), ResourceId("charburner_bobs"),
+                                   ResourceId("wine_bobs"), ResourceId("leather_bobs")})
+    {
+        if(!AddPendingLoad(loads, resId, pal5))
+            return false;
+    }
 
-    // Load nation building and icon graphics
-    nation_gfx = nationIcons_ = {};
+    // Nation building and icon graphics
     for(Nation nation : nations)
     {
         const auto resourceSource = getNationResourcesSource(nation, isWinterGFX, config_);
-        if(!Load(resourceSource.buildingsFilePath, pal5) || !Load(resourceSource.iconsFilePath, pal5))
+        if(!AddPendingLoad(loads, resourceSource.buildingsFilePath, pal5)
+           || !AddPendingLoad(loads, resourceSource.iconsFilePath, pal5))
             return false;
-        nation_gfx[nation] = &files_[ResourceId::make(resourceSource.buildingsFilePath)].archive;
-        nationIcons_[nation] = &files_[ResourceId::make(resourceSource.iconsFilePath)].archive;
     }
 
-    // TODO: Move to addon folder and make it overwrite existing file
-    if(!LoadResources({"charburner", "charburner_bobs"}))
-        return false;
-
-    if(!LoadResources({"wine_bobs"}))
-        return false;
-
-    if(!LoadResources({"leather_bobs"}))
-        return false;
-
     const bfs::path mapGFXFile = config_.ExpandPath(mapGfxPath);
-    if(!Load(mapGFXFile, pal5))
+    if(!AddPendingLoad(loads, mapGFXFile, pal5) || !LoadPending(loads))
         return false;
+
+    nation_gfx = nationIcons_ = {};
+    for(Nation nation : nations)
+    {
+        const auto resourceSource = getNationResourcesSource(nation, isWinterGFX, config_);
+        nation_gfx[nation] = &files_[ResourceId::make(resourceSource.buildingsFilePath)].archive;
+        nationIcons_[nation] = &files_[ResourceId::make(resourceSource.iconsFilePath)].archive;
+    }
     map_gfx = &GetArchive(ResourceId::make(mapGFXFile));
 
     isWinterGFX_ = isWinterGFX;
 
+    using namespace std::chrono;
+    logger_.write(_("Loaded game files in %ums\n")) % duration_cast<milliseconds>(timer.getElapsed()).count();
     return true;
 }
 
 bool Loader::LoadFiles(const std::vector<std::string>& files)
 {
     const libsiedler2::ArchivItem_Palette* pal5 = GetPaletteN("pal5");
-    // load the files
+    std::vector<PendingLoad> loads;
     for(const std::string& curFile : files)
     {
-        const bfs::path filePath = config_.ExpandPath(curFile);
-        if(!Load(filePath, pal5))
-        {
-            logger_.write(_("Failed to load %s\n")) % filePath;
+        if(!AddPendingLoad(loads, config_.ExpandPath(curFile), pal5))
             return false;
-        }
     }
-
-    return true;
+    return LoadPending(loads);
 }
 
 bool Loader::LoadResources(const std::vector<ResourceId>& resources)
 {
     const libsiedler2::ArchivItem_Palette* pal5 = GetPaletteN("pal5");
+    std::vector<PendingLoad> loads;
     for(const ResourceId& curResource : resources)
     {
-        if(!Load(curResource, pal5))
-        {
-            logger_.write(_("Failed to load %s\n")) % curResource;
+        if(!AddPendingLoad(loads, curResource, pal5))
             return false;
-        }
     }
-
-    return true;
+    return LoadPending(loads);
 }
 
 void Loader::fillCaches()
 {
+    using namespace std::chrono;
+    Timer timer(true);
     stp = std::make_unique<glTexturePacker>();
 
     // Animals
@@ -1009,10 +1084,34 @@ void Loader::fillCaches()
         }
     }
 
+    logger_.write(_("Filled sprite caches in %ums\n")) % duration_cast<milliseconds>(timer.getElapsed()).count();
+
     if(SETTINGS.video.sharedTextures)
     {
-        // generate mega texture
-        stp->pack();
+        timer.restart();
+        // The packed textures only depend on the loaded files and the nations
+        AssetCache::Key cacheKey;
+        for(const FileEntry& entry : files_ | boost::adaptors::map_values)
+            cacheKey.addFiles(entry.resolvedFile);
+        cacheKey.addValue(isWinterGFX_);
+        for(const auto nation : helpers::enumRange<Nation>())
+            cacheKey.addValue(nation_gfx[nation] != nullptr);
+        const AssetCache cache(config_.ExpandPath(s25::folders::cache));
+        const auto packedTextures = cache.read("textures", cacheKey.get());
+        if(packedTextures && stp->loadPacked(packedTextures->getReader()))
+        {
+            logger_.write(_("Loaded %1% shared textures from cache in %2%ms\n")) % stp->getTextures().size()
+              % duration_cast<milliseconds>(timer.getElapsed()).count();
+        } else
+        {
+            // generate mega texture
+            AssetCache::Writer packedData;
+            const bool packed = stp->pack(&packedData);
+            logger_.write(_("Packed %1% shared textures in %2%ms\n")) % stp->getTextures().size()
+              % duration_cast<milliseconds>(timer.getElapsed()).count();
+            if(packed && !cache.write("textures", cacheKey.get(), packedData))
+                logger_.write(_("WARNING: Could not write the packed textures to the cache\n"));
+        }
     } else
         stp.reset();
 }
@@ -1132,6 +1231,76 @@ bool Loader::LoadImpl(const T& resIdOrPath, const libsiedler2::ArchivItem_Palett
     return true;
 }
 
+template<typename T>
+bool Loader::AddPendingLoad(std::vector<PendingLoad>& loads, const T& resIdOrPath,
+                            const libsiedler2::ArchivItem_Palette* palette)
+{
+    auto resolvedFile = archiveLocator_->resolve(resIdOrPath);
+    if(!resolvedFile)
+    {
+        logger_.write(_("Failed to resolve resource %1%\n")) % resIdOrPath;
+        return false;
+    }
+    const ResourceId resId = ResourceId::make(resIdOrPath);
+    // Can we reuse the loaded version?
+    const auto itFile = files_.find(resId);
+    if(itFile != files_.end() && itFile->second.resolvedFile == resolvedFile)
+        return true;
+    if(!helpers::contains_if(loads, [&resId](const PendingLoad& load) { return load.resId == resId; }))
+        loads.push_back(PendingLoad{resId, std::move(resolvedFile), palette});
+    return true;
+}
+
+bool Loader::LoadPending(const std::vector<PendingLoad>& loads)
+{
+    std::vector<libsiedler2::Archiv> archives(loads.size());
+    // Messages are only collected in the workers, translating them needs to be done here
+    std::vector<std::vector<LoadMessage>> logMessages(loads.size());
+    std::vector<char> failed(loads.size(), false);
+
+    // Decoding (incl. palette conversion) is independent per archive, so distribute it to workers
+    std::atomic<size_t> nextLoad(0);
+    const auto loadArchives = [&]() {
+        for(size_t i = nextLoad++; i < loads.size(); i = nextLoad++)
+        {
+            try
+            {
+                archives[i] = archiveLoader_->load(loads[i].resolvedFile, loads[i].palette, &logMessages[i]);
+            } catch(const LoadError&)
+            {
+                failed[i] = true;
+            } catch(const std::exception& e)
+            {
+                logMessages[i].emplace_back(std::string(e.what()) + '\n');
+                failed[i] = true;
+            }
+        }
+    };
+    const size_t numThreads = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), loads.size());
+    std::vector<std::thread> workers;
+    for(size_t i = 1; i < numThreads; i++)
+        workers.emplace_back(loadArchives);
+    loadArchives();
+    for(std::thread& worker : workers)
+        worker.join();
+
+    // Log and store in the original order
+    for(size_t i = 0; i < loads.size(); i++)
+    {
+        archiveLoader_->writeLog(logMessages[i]);
+        if(failed[i])
+        {
+            logger_.write("%1%\n") % helpers::format(_("Failed to load %1%"), loads[i].resId);
+            return false;
+        }
+        RTTR_Assert(!archives[i].empty());
+        FileEntry& entry = files_[loads[i].resId];
+        entry.archive = std::move(archives[i]);
+        entry.resolvedFile = loads[i].resolvedFile;
+    }
+    return true;
+}
+
 bool Loader::Load(const bfs::path& path, const libsiedler2::ArchivItem_Palette* palette)
 {
     return LoadImpl(path, palette);
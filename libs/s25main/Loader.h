@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -66,6 +66,8 @@ class Loader
 {
     /// Struct for storing loaded file entries
     struct FileEntry;
+    /// Resolved archive which still needs to be loaded
+    struct PendingLoad;
 
 public:
     Loader(Log&, const RttrConfig&);
@@ -220,6 +222,12 @@ private:
 
     template<typename T>
     bool LoadImpl(const T& resIdOrPath, const libsiedler2::ArchivItem_Palette* palette);
+    /// Resolve the archive and add it to the pending loads unless it is already loaded. Return false on error
+    template<typename T>
+    bool AddPendingLoad(std::vector<PendingLoad>& loads, const T& resIdOrPath,
+                        const libsiedler2::ArchivItem_Palette* palette);
+    /// Load the pending archives using multiple threads. Only decodes the files, textures are created on first use
+    bool LoadPending(const std::vector<PendingLoad>& loads);
 
     Log& logger_;
     const RttrConfig& config_;
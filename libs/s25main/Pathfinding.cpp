@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -84,8 +84,28 @@ bool GameWorldBase::FindShipPathToHarbor(const MapPoint start, HarborId harborId
 bool GameWorldBase::FindShipPath(const MapPoint start, const MapPoint dest, unsigned maxDistance,
                                  std::vector<Direction>* route, unsigned* length)
 {
-    return GetFreePathFinder().FindPath(start, dest, true, maxDistance, route, length, nullptr,
-                                        PathConditionShip(*this));
+    if(!shipRouteTable.IsStored(start, dest))
+    {
+        return GetFreePathFinder().FindPath(start, dest, true, maxDistance, route, length, nullptr,
+                                            PathConditionShip(*this));
+    }
+    // Use the same start direction as the path finder so the route is exactly the one it would find
+    const Direction startDir = GetFreePathFinder().GetStartDir(start, true);
+    const ShipRouteTable::Route* storedRoute = shipRouteTable.Find(start, dest, maxDistance, startDir);
+    if(!storedRoute)
+    {
+        ShipRouteTable::Route newRoute{maxDistance, startDir, false, {}};
+        newRoute.found = GetFreePathFinder().FindPath(start, dest, true, maxDistance, &newRoute.dirs, nullptr,
+                                                      nullptr, PathConditionShip(*this));
+        storedRoute = &shipRouteTable.Add(start, dest, std::move(newRoute));
+    }
+    if(!storedRoute->found)
+        return false;
+    if(route)
+        *route = storedRoute->dirs;
+    if(length)
+        *length = static_cast<unsigned>(storedRoute->dirs.size());
+    return true;
 }
 
 /// Prüft, ob eine Schiffsroute noch Gültigkeit hat
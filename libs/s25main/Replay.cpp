@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Replay.h"
+#include "EventManager.h"
+#include "Game.h"
 #include "Savegame.h"
 #include "enum_cast.hpp"
 #include "helpers/format.hpp"
@@ -10,6 +12,7 @@
 #include "gameTypes/MapInfo.h"
 #include <s25util/tmpFile.h>
 #include <boost/filesystem.hpp>
+#include <algorithm>
 #include <memory>
 #include <mygettext/mygettext.h>
 
@@ -31,7 +34,8 @@ std::string Replay::GetSignature() const
 ///
 /// Changelog:
 /// 1: Unused first CommandType (End) removed, GameCommand version added
-static const uint8_t currentReplayDataVersion = 1;
+/// 2: Snapshots and position of the snapshot index added
+static const uint8_t currentReplayDataVersion = 2;
 // clang-format on
 
 /// Format version of replay files
@@ -62,6 +66,8 @@ void Replay::Close()
     uncompressedDataFile_.reset();
     isRecording_ = false;
     filepath_.clear();
+    snapshotIndexPos_ = 0;
+    snapshots_.clear();
     ClearPlayers();
 }
 
@@ -69,6 +75,7 @@ bool Replay::StopRecording()
 {
     if(!isRecording_)
         return true;
+    WriteSnapshotIndex();
     const auto replayDataSize = file_.Tell();
     isRecording_ = false;
     file_.Close();
@@ -100,6 +107,8 @@ bool Replay::StopRecording()
         const auto lastGF = file.ReadUnsignedInt();
         RTTR_Assert(lastGF == lastGF_);
         compressedReplay.WriteUnsignedInt(lastGF);
+        // Snapshot index position is relative to the game data so it stays valid
+        compressedReplay.WriteUnsignedInt(file.ReadUnsignedInt());
         file.ReadUnsignedChar(); // Ignore compressed flag (always zero for the temporary file)
 
         // Read and compress remaining data
@@ -157,7 +166,10 @@ bool Replay::StartRecording(const boost::filesystem::path& filepath, const MapIn
     // store position to update it later
     lastGfFilePos_ = file_.Tell();
     file_.WriteUnsignedInt(lastGF_);
-    file_.WriteUnsignedChar(0); // Compressed flag
+    file_.WriteUnsignedInt(snapshotIndexPos_ = 0); // Updated when stopping
+    file_.WriteUnsignedChar(0);                    // Compressed flag
+    dataStartPos_ = file_.Tell();
+    snapshots_.clear();
 
     WritePlayerData(file_);
     WriteGGS(file_);
@@ -245,6 +257,7 @@ bool Replay::LoadHeader(const boost::filesystem::path& filepath)
         }
 
         lastGF_ = file_.ReadUnsignedInt();
+        snapshotIndexPos_ = (subVersion_ >= 2) ? file_.ReadUnsignedInt() : 0;
     } catch(const std::runtime_error& e)
     {
         lastErrorMsg = e.what();
@@ -272,6 +285,7 @@ bool Replay::LoadGameData(MapInfo& mapInfo)
             file_.Close();
             file_.Open(uncompressedDataFile_->filePath, OpenFileMode::Read);
         }
+        dataStartPos_ = file_.Tell();
 
         ReadPlayerData(file_);
         ReadGGS(file_);
@@ -302,6 +316,8 @@ bool Replay::LoadGameData(MapInfo& mapInfo)
                 }
                 break;
         }
+        if(snapshotIndexPos_)
+            ReadSnapshotIndex();
     } catch(const std::runtime_error& e)
     {
         lastErrorMsg = e.what();
@@ -345,12 +361,128 @@ void Replay::AddGameCommand(unsigned gf, uint8_t player, const PlayerGameCommand
     file_.Flush();
 }
 
+void Replay::AddSnapshot(const Game& game)
+{
+    RTTR_Assert(IsRecording());
+    if(!file_.IsOpen())
+        return;
+
+    // Serialize first so nothing is written on failure
+    SerializedGameData sgd;
+    sgd.MakeSnapshot(game);
+    std::vector<char> data(sgd.GetData(), sgd.GetData() + sgd.GetLength());
+    const unsigned uncompressedLength = data.size();
+    data = CompressedData::compress(data);
+
+    const unsigned gf = game.em_->GetCurrentGF();
+    RTTR_Assert(snapshots_.empty() || snapshots_.back().gf < gf);
+    snapshots_.push_back(SnapshotPos{gf, static_cast<unsigned>(file_.Tell()) - dataStartPos_});
+
+    file_.WriteUnsignedInt(gf);
+    file_.WriteUnsignedChar(rttr::enum_cast(CommandType::Snapshot));
+    Serializer ser;
+    RANDOM.GetCurrentState().serialize(ser);
+    ser.WriteToFile(file_);
+    file_.WriteUnsignedInt(uncompressedLength);
+    file_.WriteUnsignedInt(data.size());
+    file_.WriteRawData(data.data(), data.size());
+
+    file_.Flush();
+}
+
+void Replay::WriteSnapshotIndex()
+{
+    if(snapshots_.empty() || !file_.IsOpen())
+        return;
+    snapshotIndexPos_ = static_cast<unsigned>(file_.Tell()) - dataStartPos_;
+    file_.WriteUnsignedInt(snapshots_.size());
+    for(const SnapshotPos& snapshot : snapshots_)
+    {
+        file_.WriteUnsignedInt(snapshot.gf);
+        file_.WriteUnsignedInt(snapshot.offset);
+    }
+    // Index position follows the last GF in the header
+    file_.Seek(lastGfFilePos_ + 4, SEEK_SET);
+    file_.WriteUnsignedInt(snapshotIndexPos_);
+    file_.Seek(0, SEEK_END);
+}
+
+void Replay::ReadSnapshotIndex()
+{
+    const auto curPos = file_.Tell();
+    file_.Seek(dataStartPos_ + snapshotIndexPos_, SEEK_SET);
+    snapshots_.resize(file_.ReadUnsignedInt());
+    for(SnapshotPos& snapshot : snapshots_)
+    {
+        snapshot.gf = file_.ReadUnsignedInt();
+        snapshot.offset = file_.ReadUnsignedInt();
+    }
+    file_.Seek(curPos, SEEK_SET);
+}
+
+std::vector<unsigned> Replay::GetSnapshotGFs() const
+{
+    std::vector<unsigned> gfs;
+    gfs.reserve(snapshots_.size());
+    for(const SnapshotPos& snapshot : snapshots_)
+        gfs.push_back(snapshot.gf);
+    return gfs;
+}
+
+bool Replay::ReadSnapshot(const unsigned gf, Snapshot& snapshot)
+{
+    RTTR_Assert(IsReplaying());
+    const auto it = std::upper_bound(snapshots_.begin(), snapshots_.end(), gf,
+                                     [](unsigned gf, const SnapshotPos& snapshot) { return gf < snapshot.gf; });
+    if(it == snapshots_.begin())
+        return false;
+    const SnapshotPos& snapshotPos = *std::prev(it);
+    try
+    {
+        file_.Seek(dataStartPos_ + snapshotPos.offset, SEEK_SET);
+        snapshot.gf = file_.ReadUnsignedInt();
+        if(snapshot.gf != snapshotPos.gf || ReadCommandType() != CommandType::Snapshot)
+            throw std::runtime_error(helpers::format(_("Invalid snapshot index at GF %1%"), snapshotPos.gf));
+        Serializer ser;
+        ser.ReadFromFile(file_);
+        snapshot.rngState.deserialize(ser);
+        const auto uncompressedLength = file_.ReadUnsignedInt();
+        std::vector<char> data(file_.ReadUnsignedInt());
+        file_.ReadRawData(data.data(), data.size());
+        data = CompressedData::decompress(data, uncompressedLength);
+        snapshot.sgd.Clear();
+        snapshot.sgd.PushRawData(data.data(), data.size());
+    } catch(const std::runtime_error& e)
+    {
+        lastErrorMsg = e.what();
+        return false;
+    }
+    return true;
+}
+
 std::optional<unsigned> Replay::ReadGF()
 {
     RTTR_Assert(IsReplaying());
     try
     {
-        return file_.ReadUnsignedInt();
+        while(true)
+        {
+            // The commands end where the snapshot index starts
+            if(snapshotIndexPos_ && static_cast<unsigned>(file_.Tell()) >= dataStartPos_ + snapshotIndexPos_)
+                return std::nullopt;
+            const unsigned gf = file_.ReadUnsignedInt();
+            if(subVersion_ < 2 || ReadCommandType() != CommandType::Snapshot)
+            {
+                if(subVersion_ >= 2)
+                    file_.Seek(-1, SEEK_CUR); // Command type is read by ReadCommand
+                return gf;
+            }
+            // Skip snapshots when playing linearly
+            Serializer ser;
+            ser.ReadFromFile(file_);
+            file_.ReadUnsignedInt(); // Uncompressed length
+            file_.Seek(file_.ReadUnsignedInt(), SEEK_CUR);
+        }
     } catch(const std::runtime_error&)
     {
         if(file_.IsEndOfFile())
@@ -359,10 +491,15 @@ std::optional<unsigned> Replay::ReadGF()
     }
 }
 
+Replay::CommandType Replay::ReadCommandType()
+{
+    return static_cast<CommandType>(file_.ReadUnsignedChar() - (subVersion_ == 0 ? 1 : 0));
+}
+
 boost_variant2<Replay::ChatCommand, Replay::GameCommand> Replay::ReadCommand()
 {
     RTTR_Assert(IsReplaying());
-    const auto type = static_cast<CommandType>(file_.ReadUnsignedChar() - (subVersion_ == 0 ? 1 : 0));
+    const auto type = ReadCommandType();
     switch(type)
     {
         case CommandType::Chat: return ChatCommand(file_);
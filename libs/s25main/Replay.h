@@ -5,7 +5,9 @@
 #pragma once
 
 #include "SavedFile.h"
+#include "SerializedGameData.h"
 #include "network/PlayerGameCommands.h"
+#include "random/Random.h"
 #include "variant.h"
 #include "gameTypes/ChatDestination.h"
 #include "gameTypes/MapType.h"
@@ -13,7 +15,9 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
+class Game;
 class MapInfo;
 struct PlayerGameCommands;
 class TmpFile;
@@ -23,6 +27,8 @@ class TmpFile;
 ///     File header (version etc.), record time, map name, player names, length (last GF), savegame header (if
 ///     applicable)
 /// All game relevant data is stored afterwards
+/// Optionally it contains snapshots of the game state and an index to them at the end which allows starting the replay
+/// from a later GF without simulating all GFs before
 class Replay : public SavedFile
 {
 public:
@@ -30,6 +36,7 @@ public:
     {
         Chat,
         Game,
+        Snapshot,
     };
     struct ChatCommand
     {
@@ -44,6 +51,13 @@ public:
         uint8_t player;
         PlayerGameCommands cmds;
     };
+    /// State of the game at the start of a GF (before executing commands for that GF)
+    struct Snapshot
+    {
+        unsigned gf = 0;
+        UsedPRNG rngState;
+        SerializedGameData sgd;
+    };
 
     Replay();
     ~Replay() override;
@@ -74,10 +88,18 @@ public:
     void AddChatCommand(unsigned gf, uint8_t player, ChatDestination dest, const std::string& str);
     /// Record game commands (player actions)
     void AddGameCommand(unsigned gf, uint8_t player, const PlayerGameCommands& cmds);
+    /// Record the current state of the game for its current GF. Must be called before adding commands for that GF.
+    /// Throws SerializedGameData::Error if the game could not be serialized
+    void AddSnapshot(const Game& game);
 
     /// Read the next GameFrame to which the following replay command applies if there are any left
     std::optional<unsigned> ReadGF();
     boost_variant2<ChatCommand, GameCommand> ReadCommand();
+    /// GFs of all snapshots in the index. Empty if there is no index, e.g. for older replays
+    std::vector<unsigned> GetSnapshotGFs() const;
+    /// Read the last snapshot at or before the given GF. Reading commands continues after that snapshot.
+    /// Return false if there is none
+    bool ReadSnapshot(unsigned gf, Snapshot& snapshot);
 
     /// Update the (currently) last GameFrame in the file
     void UpdateLastGF(unsigned last_gf);
@@ -86,6 +108,17 @@ public:
     unsigned GetLastGF() const { return lastGF_; }
 
 protected:
+    struct SnapshotPos
+    {
+        unsigned gf;
+        /// Position relative to the start of the game data
+        unsigned offset;
+    };
+
+    CommandType ReadCommandType();
+    void WriteSnapshotIndex();
+    void ReadSnapshotIndex();
+
     BinaryFile file_;
     std::unique_ptr<TmpFile> uncompressedDataFile_; /// Used when reading a compressed replay
     boost::filesystem::path filepath_;              /// Path to current file
@@ -97,6 +130,11 @@ protected:
     unsigned lastGF_ = 0;
     /// Position of the last GF value in the file
     unsigned lastGfFilePos_ = 0;
+    /// Position of the game data (after the header) in the file
+    unsigned dataStartPos_ = 0;
+    /// Position of the snapshot index relative to dataStartPos_ or 0 if there is none
+    unsigned snapshotIndexPos_ = 0;
+    std::vector<SnapshotPos> snapshots_;
     MapType mapType_ = MapType(0);
 
     /// Sub version for backwards compatibility (i.e. allow loading older files with same file version)
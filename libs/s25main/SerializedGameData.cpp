@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "SerializedGameData.h"
+#include "AllocationStatistics.h"
 #include "CatapultStone.h"
 #include "EventManager.h"
 #include "FOWObjects.h"
@@ -108,7 +109,8 @@
 /// 12: leatheraddon added, three new building types and three new goods
 /// 13: SeaId & HarborId: World::harborData w/o dummy entry at 0
 /// 14: Remove "age" field in nobBaseMilitary
-static const unsigned currentGameDataVersion = 14;
+/// 15: Explored/occupied points pending for the Lua batch events
+static const unsigned currentGameDataVersion = 15;
 // clang-format on
 
 std::unique_ptr<GameObject> SerializedGameData::Create_GameObject(const GO_Type got, const unsigned obj_id)
@@ -239,6 +241,7 @@ void SerializedGameData::Prepare(bool reading)
 
 void SerializedGameData::MakeSnapshot(const Game& game)
 {
+    const AllocationScope allocationScope(AllocationTag::Serialization);
     Prepare(false);
 
     const GameWorldBase& gw = game.world_;
@@ -285,6 +288,7 @@ void SerializedGameData::MakeSnapshot(const Game& game)
 
 void SerializedGameData::ReadSnapshot(Game& game, ILocalGameState& localGameState)
 {
+    const AllocationScope allocationScope(AllocationTag::Serialization);
     Prepare(true);
 
     GameWorld& gw = game.world_;
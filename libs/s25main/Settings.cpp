@@ -14,6 +14,7 @@
 #include "helpers/MaxEnumValue.h"
 #include "helpers/strUtils.h"
 #include "languages.h"
+#include "gameData/GameConsts.h"
 #include "gameData/PortraitConsts.h"
 #include "gameData/const_gui_ids.h"
 #include "libsiedler2/ArchivItem_Ini.h"
@@ -32,6 +33,8 @@ constexpr MapScrollMode MAP_SCROLL_MODE_DEFAULT = MapScrollMode::GrabAndDrag;
 constexpr bool SHARED_TEXTURES_DEFAULT = true;
 constexpr MapScrollMode MAP_SCROLL_MODE_DEFAULT = MapScrollMode::ScrollOpposite;
 #endif
+/// Snapshot in replays every 10 minutes
+constexpr unsigned REPLAY_SNAPSHOT_INTERVAL = duration_to_gfs(std::chrono::minutes(10));
 } // namespace
 
 const int Settings::VERSION = 13;
@@ -156,6 +159,7 @@ void Settings::LoadDefaults()
     // interface
     // {
     interface.autosaveInterval = 0;
+    interface.replaySnapshotInterval = REPLAY_SNAPSHOT_INTERVAL;
     interface.mapScrollMode = MAP_SCROLL_MODE_DEFAULT;
     interface.enableWindowPinning = false;
     interface.windowSnapDistance = 8;
@@ -336,6 +340,8 @@ void Settings::Load()
         // interface
         // {
         interface.autosaveInterval = iniInterface->getIntValue("autosave_interval");
+        interface.replaySnapshotInterval =
+          iniInterface->getValue("replay_snapshot_interval", static_cast<int>(REPLAY_SNAPSHOT_INTERVAL));
         try
         {
             interface.mapScrollMode = static_cast<MapScrollMode>(iniInterface->getIntValue("map_scroll_mode"));
@@ -512,6 +518,7 @@ void Settings::Save()
     // interface
     // {
     iniInterface->setValue("autosave_interval", interface.autosaveInterval);
+    iniInterface->setValue("replay_snapshot_interval", interface.replaySnapshotInterval);
     iniInterface->setValue("map_scroll_mode", static_cast<int>(interface.mapScrollMode));
     iniInterface->setValue("enable_window_pinning", interface.enableWindowPinning);
     iniInterface->setValue("window_snap_distance", interface.windowSnapDistance);
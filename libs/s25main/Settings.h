@@ -126,6 +126,8 @@ public:
     struct
     {
         unsigned autosaveInterval;
+        /// GFs between snapshots in recorded replays (0 = none)
+        unsigned replaySnapshotInterval;
         MapScrollMode mapScrollMode;
         bool enableWindowPinning;
         unsigned windowSnapDistance;
@@ -0,0 +1,114 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "StateHash.h"
+#include "GamePlayer.h"
+#include "RttrForeachPt.h"
+#include "helpers/EnumRange.h"
+#include "helpers/format.hpp"
+#include "helpers/serializeContainers.h"
+#include "world/GameWorldBase.h"
+#include "nodeObjs/noBase.h"
+#include "gameTypes/BuildingCount.h"
+#include "s25util/Serializer.h"
+
+namespace {
+/// FNV-1a like hash over 32 bit values. Fast and good enough to detect differences
+class Hasher
+{
+    uint32_t hash_ = 2166136261u;
+
+public:
+    void add(uint32_t value) { hash_ = (hash_ ^ value) * 16777619u; }
+    uint32_t get() const { return hash_; }
+};
+} // namespace
+
+StateHash StateHash::create(const GameWorldBase& world)
+{
+    StateHash result;
+
+    result.playerHashes.reserve(world.GetNumPlayers());
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+    {
+        const GamePlayer& player = world.GetPlayer(i);
+        Hasher hasher;
+        hasher.add(player.IsDefeated() ? 1 : 0);
+        const Inventory& inventory = player.GetInventory();
+        for(const auto good : helpers::enumRange<GoodType>())
+            hasher.add(inventory[good]);
+        for(const auto job : helpers::enumRange<Job>())
+            hasher.add(inventory[job]);
+        const BuildingCount buildingNums = player.GetBuildingRegister().GetBuildingNums();
+        for(const auto bld : helpers::enumRange<BuildingType>())
+        {
+            hasher.add(buildingNums.buildings[bld]);
+            hasher.add(buildingNums.buildingSites[bld]);
+        }
+        result.playerHashes.push_back(hasher.get());
+    }
+
+    const MapExtent size = world.GetSize();
+    result.numRegionsX = static_cast<uint16_t>((size.x + REGION_SIZE - 1) / REGION_SIZE);
+    const unsigned numRegionsY = (size.y + REGION_SIZE - 1) / REGION_SIZE;
+    std::vector<Hasher> regionHashers(result.numRegionsX * numRegionsY);
+    RTTR_FOREACH_PT(MapPoint, size)
+    {
+        const MapNode& node = world.GetNode(pt);
+        Hasher& hasher = regionHashers[(pt.y / REGION_SIZE) * result.numRegionsX + pt.x / REGION_SIZE];
+        hasher.add(node.owner | (node.altitude << 8) | (node.resources.getValue() << 16));
+        uint32_t roads = 0;
+        for(const PointRoad road : node.roads)
+            roads = (roads << 8) | static_cast<uint32_t>(road);
+        hasher.add(roads);
+        // Object IDs are assigned in creation order, so they differ as soon as anything was created differently
+        if(node.obj)
+            hasher.add(node.obj->GetObjId());
+        for(const auto& figure : node.figures)
+            hasher.add(figure->GetObjId());
+    }
+    result.regionHashes.reserve(regionHashers.size());
+    for(const Hasher& hasher : regionHashers)
+        result.regionHashes.push_back(hasher.get());
+    return result;
+}
+
+void StateHash::Serialize(Serializer& ser) const
+{
+    helpers::pushContainer(ser, playerHashes);
+    ser.PushUnsignedShort(numRegionsX);
+    helpers::pushContainer(ser, regionHashes);
+}
+
+void StateHash::Deserialize(Serializer& ser)
+{
+    helpers::popContainer(ser, playerHashes);
+    numRegionsX = ser.PopUnsignedShort();
+    helpers::popContainer(ser, regionHashes);
+}
+
+std::string StateHash::describeDifference(const StateHash& other) const
+{
+    if(empty() || other.empty())
+        return "";
+    if(playerHashes.size() != other.playerHashes.size() || regionHashes.size() != other.regionHashes.size()
+       || numRegionsX != other.numRegionsX || numRegionsX == 0)
+        return "Number of players or map size";
+    for(unsigned i = 0; i < playerHashes.size(); i++)
+    {
+        if(playerHashes[i] != other.playerHashes[i])
+            return helpers::format("Inventory or buildings of player %1%", i);
+    }
+    for(unsigned i = 0; i < regionHashes.size(); i++)
+    {
+        if(regionHashes[i] != other.regionHashes[i])
+        {
+            const unsigned x = (i % numRegionsX) * REGION_SIZE;
+            const unsigned y = (i / numRegionsX) * REGION_SIZE;
+            return helpers::format("Map nodes in (%1%, %2%) - (%3%, %4%)", x, y, x + REGION_SIZE - 1,
+                                   y + REGION_SIZE - 1);
+        }
+    }
+    return "";
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class GameWorldBase;
+class Serializer;
+
+/// Hashes of parts of the game state used to find where an async happened.
+/// Requires a pass over the whole map, so it is only created every few NWFs
+struct StateHash
+{
+    /// Width and height (in nodes) of the map regions having their own hash
+    static constexpr unsigned REGION_SIZE = 32;
+
+    /// Hash of inventory and buildings per player
+    std::vector<uint32_t> playerHashes;
+    /// Hash of the nodes (owner, roads, objects, figures, ...) per region, row by row
+    std::vector<uint32_t> regionHashes;
+    /// Number of regions per row
+    uint16_t numRegionsX = 0;
+
+    static StateHash create(const GameWorldBase& world);
+
+    bool empty() const { return playerHashes.empty() && regionHashes.empty(); }
+    void Serialize(Serializer& ser) const;
+    void Deserialize(Serializer& ser);
+
+    /// Describe the first difference to the other hash.
+    /// Returns an empty string if they are equal or any of them is empty
+    std::string describeDifference(const StateHash& other) const;
+
+    bool operator==(const StateHash& rhs) const
+    {
+        return playerHashes == rhs.playerHashes && regionHashes == rhs.regionHashes && numRegionsX == rhs.numRegionsX;
+    }
+    bool operator!=(const StateHash& rhs) const { return !(*this == rhs); }
+};
@@ -0,0 +1,146 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "StatisticExport.h"
+#include "GamePlayer.h"
+#include "enum_cast.hpp"
+#include "helpers/EnumArray.h"
+#include "helpers/EnumRange.h"
+#include "world/GameWorldBase.h"
+#include "gameTypes/StatisticTypes.h"
+#include <array>
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+namespace {
+// Sizes are deduced from the names and checked, so a new value without a name fails to compile
+constexpr std::array STATISTIC_NAMES_LIST = {
+  "Country", "Buildings", "Inhabitants", "Merchandise", "Military", "Gold", "Productivity", "Vanquished", "Tournament"};
+static_assert(STATISTIC_NAMES_LIST.size() == helpers::NumEnumValues_v<StatisticType>);
+constexpr auto STATISTIC_NAMES = helpers::toEnumArray<StatisticType>(STATISTIC_NAMES_LIST);
+constexpr std::array MERCHANDISE_NAMES = {
+  "Wood", "Boards", "Stones", "Food", "Water", "Beer", "Coal", "IronOre", "Gold", "Iron", "Coins", "Tools", "Weapons",
+  "Boats"};
+static_assert(MERCHANDISE_NAMES.size() == NUM_STAT_MERCHANDISE_TYPES);
+constexpr std::array TIME_NAMES_LIST = {"15m", "1h", "4h", "16h"};
+static_assert(TIME_NAMES_LIST.size() == helpers::NumEnumValues_v<StatisticTime>);
+constexpr auto TIME_NAMES = helpers::toEnumArray<StatisticTime>(TIME_NAMES_LIST);
+
+/// Game time in seconds between two values of the time range.
+/// The values of the shortest range are recorded every 30s, each longer range uses every 4th of the shorter one
+unsigned getStepDuration(const StatisticTime time)
+{
+    return 30u << (2u * rttr::enum_cast(time));
+}
+
+std::string escapeJSON(const std::string& str)
+{
+    std::string result;
+    for(const char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        } else if(static_cast<unsigned char>(c) < 0x20)
+        {
+            std::array<char, 7> escaped;
+            std::snprintf(escaped.data(), escaped.size(), "\\u%04x", static_cast<unsigned>(c));
+            result += escaped.data();
+        } else
+            result += c;
+    }
+    return result;
+}
+
+/// Write the values as a JSON list, the oldest first
+template<class T_GetValue>
+void writeJSONValues(std::ostream& os, const T_GetValue& getValue)
+{
+    os << '[';
+    for(unsigned stepsAgo = NUM_STAT_STEPS; stepsAgo-- > 0;)
+    {
+        os << getValue(stepsAgo);
+        if(stepsAgo > 0)
+            os << ',';
+    }
+    os << ']';
+}
+} // namespace
+
+namespace statisticExport {
+
+void writeCSV(std::ostream& os, const GameWorldBase& world)
+{
+    os << "Player,TimeRange,StepDuration,StepsAgo";
+    for(const auto type : helpers::enumRange<StatisticType>())
+        os << ',' << STATISTIC_NAMES[type];
+    for(const char* name : MERCHANDISE_NAMES)
+        os << ",Merchandise" << name;
+    os << '\n';
+
+    for(unsigned playerIdx = 0; playerIdx < world.GetNumPlayers(); playerIdx++)
+    {
+        const GamePlayer& player = world.GetPlayer(playerIdx);
+        if(!player.isUsed())
+            continue;
+        for(const auto time : helpers::enumRange<StatisticTime>())
+        {
+            const GamePlayer::Statistic& stat = player.GetStatistic(time);
+            for(unsigned stepsAgo = NUM_STAT_STEPS; stepsAgo-- > 0;)
+            {
+                os << playerIdx << ',' << TIME_NAMES[time] << ',' << getStepDuration(time) << ',' << stepsAgo;
+                for(const auto type : helpers::enumRange<StatisticType>())
+                    os << ',' << stat.GetValue(type, stepsAgo);
+                for(unsigned i = 0; i < NUM_STAT_MERCHANDISE_TYPES; i++)
+                    os << ',' << stat.GetMerchandiseValue(i, stepsAgo);
+                os << '\n';
+            }
+        }
+    }
+}
+
+void writeJSON(std::ostream& os, const GameWorldBase& world)
+{
+    os << "{\"players\":[";
+    bool isFirstPlayer = true;
+    for(unsigned playerIdx = 0; playerIdx < world.GetNumPlayers(); playerIdx++)
+    {
+        const GamePlayer& player = world.GetPlayer(playerIdx);
+        if(!player.isUsed())
+            continue;
+        if(!isFirstPlayer)
+            os << ',';
+        isFirstPlayer = false;
+        os << "\n{\"id\":" << playerIdx << ",\"name\":\"" << escapeJSON(player.name) << "\",\"statistics\":{";
+        for(const auto time : helpers::enumRange<StatisticTime>())
+        {
+            const GamePlayer::Statistic& stat = player.GetStatistic(time);
+            if(time != StatisticTime::T15Minutes)
+                os << ',';
+            os << "\n\"" << TIME_NAMES[time] << "\":{\"stepDuration\":" << getStepDuration(time) << ",\"values\":{";
+            for(const auto type : helpers::enumRange<StatisticType>())
+            {
+                if(type != StatisticType::Country)
+                    os << ',';
+                os << '"' << STATISTIC_NAMES[type] << "\":";
+                writeJSONValues(os, [&stat, type](unsigned stepsAgo) { return stat.GetValue(type, stepsAgo); });
+            }
+            os << "},\"merchandise\":{";
+            for(unsigned i = 0; i < NUM_STAT_MERCHANDISE_TYPES; i++)
+            {
+                if(i > 0)
+                    os << ',';
+                os << '"' << MERCHANDISE_NAMES[i] << "\":";
+                writeJSONValues(os, [&stat, i](unsigned stepsAgo) { return stat.GetMerchandiseValue(i, stepsAgo); });
+            }
+            os << "}}";
+        }
+        os << "}}";
+    }
+    os << "\n]}\n";
+}
+
+} // namespace statisticExport
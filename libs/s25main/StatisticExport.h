@@ -0,0 +1,18 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <iosfwd>
+
+class GameWorldBase;
+
+/// Export of the statistics shown in the statistics windows to be analyzed by other programs.
+/// Contains the recorded values of all players for every time range, the oldest value first
+namespace statisticExport {
+/// Write one line per player, time range and step
+void writeCSV(std::ostream& os, const GameWorldBase& world);
+/// Write an object with a list of players each holding a list of values per statistic and time range
+void writeJSON(std::ostream& os, const GameWorldBase& world);
+} // namespace statisticExport
@@ -1,35 +1,73 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "TradePathCache.h"
-#include "EventManager.h"
 #include "GamePlayer.h"
 #include "world/GameWorld.h"
-#include "gameData/GameConsts.h"
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace {
+bool isLess(const MapPoint lhs, const MapPoint rhs)
+{
+    return lhs.y < rhs.y || (lhs.y == rhs.y && lhs.x < rhs.x);
+}
+} // namespace
+
+double TradePathCache::Statistics::getHitRate() const
+{
+    const uint64_t numLookups = hits + misses + invalidPaths;
+    return numLookups ? static_cast<double>(hits) / numLookups : 0.;
+}
+
+TradePathCache::TradePathCache(const GameWorld& world, unsigned maxSize) : world(world), maxSize(maxSize)
+{
+    RTTR_Assert(maxSize > 0u);
+}
+
+void TradePathCache::clear()
+{
+    entries.clear();
+    for(auto& playerEntries : entriesByKey)
+        playerEntries.clear();
+}
+
+void TradePathCache::setMaxSize(const unsigned newMaxSize)
+{
+    RTTR_Assert(newMaxSize > 0u);
+    maxSize = newMaxSize;
+    while(entries.size() > maxSize)
+    {
+        erase(std::prev(entries.end()));
+        stats.evictions++;
+    }
+}
 
 bool TradePathCache::pathExists(const MapPoint start, const MapPoint goal, const unsigned char player)
 {
     RTTR_Assert(start != goal);
 
-    int entryIdx = findEntry(start, goal, player);
-    if(entryIdx >= 0)
+    const auto itEntry = findEntry(start, goal, player);
+    if(itEntry != entries.end())
     {
         // Found an entry --> Check if the route is still valid
         MapPoint checkedGoal;
-        if(world.CheckTradeRoute(paths[entryIdx].path.start, paths[entryIdx].path.route, 0, player, &checkedGoal))
+        if(world.CheckTradeRoute(itEntry->path.start, itEntry->path.route, 0, player, &checkedGoal))
         {
             RTTR_Assert(checkedGoal == start || checkedGoal == goal);
-            paths[entryIdx].lastUse = world.GetEvMgr().GetCurrentGF();
+            entries.splice(entries.begin(), entries, itEntry);
+            stats.hits++;
             return true;
         } else
         {
             // TradePath is now invalid -> remove it
-            if(static_cast<unsigned>(entryIdx) != paths.size() - 1u)
-                std::swap(paths[entryIdx], paths.back());
-            paths.pop_back();
+            erase(itEntry);
+            stats.invalidPaths++;
         }
-    }
+    } else
+        stats.misses++;
 
     std::vector<Direction> route;
     if(!world.FindTradePath(start, goal, player, std::numeric_limits<unsigned>::max(), false, &route))
@@ -39,41 +77,86 @@ bool TradePathCache::pathExists(const MapPoint start, const MapPoint goal, const
     return true;
 }
 
-int TradePathCache::findEntry(const MapPoint start, const MapPoint goal, const PlayerIdx player) const
+uint64_t TradePathCache::makeKey(MapPoint start, MapPoint goal)
+{
+    if(isLess(goal, start))
+        std::swap(start, goal);
+    return (static_cast<uint64_t>(start.x) << 48) | (static_cast<uint64_t>(start.y) << 32)
+           | (static_cast<uint64_t>(goal.x) << 16) | goal.y;
+}
+
+TradePathCache::Entries::iterator TradePathCache::findEntry(const MapPoint start, const MapPoint goal,
+                                                            const PlayerIdx player)
 {
     const GamePlayer& thisPlayer = world.GetPlayer(player);
+    const uint64_t key = makeKey(start, goal);
 
-    for(unsigned i = 0; i < paths.size(); i++)
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
     {
-        const Entry& pathEntry = paths[i];
-        if(pathEntry.path.start != start && pathEntry.path.goal != start)
-            continue;
-        if(pathEntry.path.goal != goal && pathEntry.path.start != goal)
-            continue;
-        if(!thisPlayer.IsAlly(pathEntry.player))
+        if(entriesByKey[i].empty() || !thisPlayer.IsAlly(i))
             continue;
-        return i;
+        const auto it = entriesByKey[i].find(key);
+        if(it != entriesByKey[i].end())
+            return it->second;
     }
-    return -1;
+    return entries.end();
+}
+
+TradePathCache::Entries::iterator TradePathCache::erase(const Entries::iterator it)
+{
+    entriesByKey[it->player].erase(makeKey(it->path.start, it->path.goal));
+    return entries.erase(it);
 }
 
 void TradePathCache::addEntry(TradePath path, const unsigned char player)
 {
-    Entry entry{player, world.GetEvMgr().GetCurrentGF(), std::move(path)};
+    const auto itOld = findEntry(path.start, path.goal, player);
+    if(itOld != entries.end())
+        erase(itOld);
+    else if(entries.size() >= maxSize)
+    {
+        // No space left --> Replace least recently used
+        erase(std::prev(entries.end()));
+        stats.evictions++;
+    }
 
-    int idx = findEntry(entry.path.start, entry.path.goal, player);
-    if(idx < 0)
+    const uint64_t key = makeKey(path.start, path.goal);
+    entries.push_front(Entry{player, std::move(path)});
+    entriesByKey[player][key] = entries.begin();
+}
+
+bool TradePathCache::isUsable(const Entry& entry, const std::vector<MapPoint>& sortedPts) const
+{
+    const GamePlayer& player = world.GetPlayer(entry.player);
+    MapPoint curPt = entry.path.start;
+    // Start and goal are not checked, see PathConditionTrade
+    for(unsigned i = 0; i + 1 < entry.path.route.size(); i++)
     {
-        // None found --> Find a new spot
-        if(paths.size() < paths.max_size())
-            paths.emplace_back(std::move(entry)); // We got space left --> append
+        curPt = world.GetNeighbour(curPt, entry.path.route[i]);
+        if(!std::binary_search(sortedPts.begin(), sortedPts.end(), curPt, isLess))
+            continue;
+        const unsigned char owner = world.GetNode(curPt).owner;
+        if(owner != 0 && !player.IsAlly(owner - 1))
+            return false;
+    }
+    return true;
+}
+
+void TradePathCache::onOwnerChanged(const std::vector<MapPoint>& pts)
+{
+    if(entries.empty() || pts.empty())
+        return;
+
+    std::vector<MapPoint> sortedPts = pts;
+    std::sort(sortedPts.begin(), sortedPts.end(), isLess);
+    for(auto it = entries.begin(); it != entries.end();)
+    {
+        if(isUsable(*it, sortedPts))
+            ++it;
         else
         {
-            // No space left --> Replace oldest
-            const auto itOldestElement = std::min_element(
-              paths.begin(), paths.end(), [](const Entry& rhs, const Entry& lhs) { return rhs.lastUse < lhs.lastUse; });
-            *itOldestElement = std::move(entry);
+            it = erase(it);
+            stats.invalidations++;
         }
-    } else
-        paths[idx] = std::move(entry);
+    }
 }
@@ -1,14 +1,22 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include "world/TradePath.h"
-#include <boost/container/static_vector.hpp>
+#include "gameData/MaxPlayers.h"
+#include <array>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
 
 class GameWorld;
 
+/// Cache for the existence of trade paths between 2 flags.
+/// Paths are stored per player and can be used by all allies. They are checked before use as objects might block them
+/// now, the least recently used ones are replaced when the cache is full.
 class TradePathCache
 {
     using PlayerIdx = unsigned char;
@@ -16,19 +24,57 @@ class TradePathCache
     struct Entry
     {
         PlayerIdx player;
-        unsigned lastUse;
         TradePath path;
     };
-
-    const GameWorld& world;
-    boost::container::static_vector<Entry, 10> paths;
-    int findEntry(MapPoint start, MapPoint goal, PlayerIdx player) const;
+    /// Most recently used entry first
+    using Entries = std::list<Entry>;
 
 public:
-    TradePathCache(const GameWorld& world) : world(world) {}
+    struct Statistics
+    {
+        /// Found a valid path in the cache
+        uint64_t hits = 0;
+        /// No path in the cache
+        uint64_t misses = 0;
+        /// Found a path in the cache which was not valid anymore
+        uint64_t invalidPaths = 0;
+        /// Paths removed because the cache was full
+        uint64_t evictions = 0;
+        /// Paths removed because the territory on them changed
+        uint64_t invalidations = 0;
+
+        /// Fraction of lookups answered by the cache
+        double getHitRate() const;
+    };
+    static constexpr unsigned DEFAULT_MAX_SIZE = 128;
 
-    void clear() { paths.clear(); }
-    unsigned size() const { return paths.size(); }
+    explicit TradePathCache(const GameWorld& world, unsigned maxSize = DEFAULT_MAX_SIZE);
+
+    void clear();
+    unsigned size() const { return static_cast<unsigned>(entries.size()); }
+    unsigned getMaxSize() const { return maxSize; }
+    /// Set the maximum number of paths. Removes the least recently used ones if there are more
+    void setMaxSize(unsigned newMaxSize);
     bool pathExists(MapPoint start, MapPoint goal, PlayerIdx player);
     void addEntry(TradePath path, PlayerIdx player);
+    /// Remove all paths going through one of the points which can no longer be used by the owner of the path
+    void onOwnerChanged(const std::vector<MapPoint>& pts);
+
+    const Statistics& getStatistics() const { return stats; }
+    void resetStatistics() { stats = Statistics(); }
+
+private:
+    /// Key for a path between the 2 points independent of the direction
+    static uint64_t makeKey(MapPoint start, MapPoint goal);
+    /// Find a path between the points usable by the player
+    Entries::iterator findEntry(MapPoint start, MapPoint goal, PlayerIdx player);
+    Entries::iterator erase(Entries::iterator it);
+    bool isUsable(const Entry& entry, const std::vector<MapPoint>& sortedPts) const;
+
+    const GameWorld& world;
+    unsigned maxSize;
+    Entries entries;
+    /// Entries by key per player
+    std::array<std::unordered_map<uint64_t, Entries::iterator>, MAX_PLAYERS> entriesByKey;
+    Statistics stats;
 };
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -106,32 +106,35 @@ public:
     /// Return the headquarter of the player (or null if destroyed)
     const nobHQ* GetHeadquarter() const;
     /// Return reference to the list of building sites
-    const std::list<noBuildingSite*>& GetBuildingSites() const
+    const helpers::OrderedPtrSet<noBuildingSite>& GetBuildingSites() const
     {
         return player_.GetBuildingRegister().GetBuildingSites();
     }
-    const std::list<noBuildingSite*>& GetPlayerBuildingSites(unsigned playerId) const
+    const helpers::OrderedPtrSet<noBuildingSite>& GetPlayerBuildingSites(unsigned playerId) const
     {
         return gwb.GetPlayer(playerId).GetBuildingRegister().GetBuildingSites();
     }
     /// Return a list to buildings of a given type
-    const std::list<nobUsual*>& GetBuildings(const BuildingType type) const
+    const helpers::OrderedPtrSet<nobUsual>& GetBuildings(const BuildingType type) const
     {
         return player_.GetBuildingRegister().GetBuildings(type);
     }
-    const std::list<nobUsual*>& GetPlayerBuildings(const BuildingType type, unsigned playerId) const
+    const helpers::OrderedPtrSet<nobUsual>& GetPlayerBuildings(const BuildingType type, unsigned playerId) const
     {
         return gwb.GetPlayer(playerId).GetBuildingRegister().GetBuildings(type);
     }
     // Return a list containing all military buildings
-    const std::list<nobMilitary*>& GetMilitaryBuildings() const
+    const helpers::OrderedPtrSet<nobMilitary>& GetMilitaryBuildings() const
     {
         return player_.GetBuildingRegister().GetMilitaryBuildings();
     }
     /// Return a list containing all harbors
-    const std::list<nobHarborBuilding*>& GetHarbors() const { return player_.GetBuildingRegister().GetHarbors(); }
+    const helpers::OrderedPtrSet<nobHarborBuilding>& GetHarbors() const
+    {
+        return player_.GetBuildingRegister().GetHarbors();
+    }
     /// Return a list containing all storehouses and harbors and the hq
-    const std::list<nobBaseWarehouse*>& GetStorehouses() const
+    const helpers::OrderedPtrSet<nobBaseWarehouse>& GetStorehouses() const
     {
         return player_.GetBuildingRegister().GetStorehouses();
     }
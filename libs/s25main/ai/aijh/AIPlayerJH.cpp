@@ -4,6 +4,7 @@
 
 #include "AIPlayerJH.h"
 #include "AIConstruction.h"
+#include "AllocationStatistics.h"
 #include "BuildingPlanner.h"
 #include "FindWhConditions.h"
 #include "GamePlayer.h"
@@ -220,6 +221,7 @@ void AIPlayerJH::RunGF(const unsigned gf, bool gfisnwf)
 {
     if(defeated)
         return;
+    const AllocationScope allocationScope(AllocationTag::AI);
 
     if(TestDefeat())
         return;
@@ -284,7 +286,7 @@ void AIPlayerJH::RunGF(const unsigned gf, bool gfisnwf)
     {
         AdjustSettings();
         // check for useless sawmills
-        const std::list<nobUsual*>& sawMills = aii.GetBuildings(BuildingType::Sawmill);
+        const auto& sawMills = aii.GetBuildings(BuildingType::Sawmill);
         if(sawMills.size() > 3)
         {
             int burns = 0;
@@ -330,7 +332,7 @@ void AIPlayerJH::PlanNewBuildings(const unsigned gf)
     // LOG.write(("new buildorders %i whs and %i mil for player %i
     // \n",aii.GetStorehouses().size(),aii.GetMilitaryBuildings().size(),playerId);
 
-    const std::list<nobBaseWarehouse*>& storehouses = aii.GetStorehouses();
+    const auto& storehouses = aii.GetStorehouses();
     if(!storehouses.empty())
     {
         // collect swords,shields,helpers,privates and beer in first storehouse or whatever is closest to the
@@ -361,7 +363,7 @@ void AIPlayerJH::PlanNewBuildings(const unsigned gf)
     // end of construction around & orders for warehouses
 
     // now pick a random military building and try to build around that as well
-    const std::list<nobMilitary*>& militaryBuildings = aii.GetMilitaryBuildings();
+    const auto& militaryBuildings = aii.GetMilitaryBuildings();
     if(militaryBuildings.empty())
         return;
     const auto* randomMiliBld = AI::randomElement(militaryBuildings);
@@ -404,7 +406,7 @@ unsigned AIPlayerJH::GetNumJobs() const
 /// no warehouse left null
 nobBaseWarehouse* AIPlayerJH::GetUpgradeBuildingWarehouse()
 {
-    const std::list<nobBaseWarehouse*>& storehouses = aii.GetStorehouses();
+    const auto& storehouses = aii.GetStorehouses();
     if(storehouses.empty())
         return nullptr;
     const auto* upgradeBld = UpdateUpgradeBuilding();
@@ -722,7 +724,7 @@ void AIPlayerJH::ExecuteAIJob()
 
 void AIPlayerJH::DistributeGoodsByBlocking(const GoodType good, unsigned limit)
 {
-    const std::list<nobBaseWarehouse*>& storehouses = aii.GetStorehouses();
+    const auto& storehouses = aii.GetStorehouses();
     if(aii.GetHarbors().size() >= storehouses.size() / 2)
     {
         // dont distribute on maps that are mostly sea maps - harbors are too difficult to defend and have to handle
@@ -804,7 +806,7 @@ void AIPlayerJH::DistributeGoodsByBlocking(const GoodType good, unsigned limit)
 
 void AIPlayerJH::DistributeMaxRankSoldiersByBlocking(unsigned limit, nobBaseWarehouse* upwh)
 {
-    const std::list<nobBaseWarehouse*>& storehouses = aii.GetStorehouses();
+    const auto& storehouses = aii.GetStorehouses();
     unsigned numCompleteWh = storehouses.size();
 
     if(numCompleteWh < 1) // no warehouses -> no job
@@ -1315,7 +1317,7 @@ void AIPlayerJH::HandleNoMoreResourcesReachable(const MapPoint pt, BuildingType
 void AIPlayerJH::HandleShipBuilt(const MapPoint pt)
 {
     // Stop building ships if reached a maximum (TODO: make variable)
-    const std::list<nobUsual*>& shipyards = aii.GetBuildings(BuildingType::Shipyard);
+    const auto& shipyards = aii.GetBuildings(BuildingType::Shipyard);
     bool wantMoreShips;
     unsigned numRelevantSeas = GetNumAIRelevantSeaIds();
     if(numRelevantSeas == 0)
@@ -1385,7 +1387,7 @@ void AIPlayerJH::HandleLostLand(const MapPoint pt)
 void AIPlayerJH::MilUpgradeOptim()
 {
     const auto* upgradeBld = UpdateUpgradeBuilding();
-    const std::list<nobMilitary*>& militaryBuildings = aii.GetMilitaryBuildings();
+    const auto& militaryBuildings = aii.GetMilitaryBuildings();
     const auto numPlannedConnectedInlandMilitaryBlds = GetNumPlannedConnectedInlandMilitaryBlds();
     unsigned count = 0;
     for(const nobMilitary* milBld : militaryBuildings)
@@ -1453,7 +1455,7 @@ bool AIPlayerJH::HasFrontierBuildings()
 
 void AIPlayerJH::CheckExpeditions()
 {
-    const std::list<nobHarborBuilding*>& harbors = aii.GetHarbors();
+    const auto& harbors = aii.GetHarbors();
     for(const nobHarborBuilding* harbor : harbors)
     {
         bool isHarborRelevant = HarborPosRelevant(harbor->GetHarborPosID(), true);
@@ -1475,7 +1477,7 @@ void AIPlayerJH::CheckExpeditions()
 
 void AIPlayerJH::CheckForester()
 {
-    const std::list<nobUsual*>& foresters = aii.GetBuildings(BuildingType::Forester);
+    const auto& foresters = aii.GetBuildings(BuildingType::Forester);
     if(!foresters.empty() && foresters.size() < 2 && aii.GetMilitaryBuildings().size() < 3
        && aii.GetBuildingSites().size() < 3)
     // stop the forester
@@ -1508,7 +1510,7 @@ void AIPlayerJH::TryToAttack()
     std::vector<const nobBaseMilitary*> potentialTargets;
 
     // use own military buildings (except inland buildings) to search for enemy military buildings
-    const std::list<nobMilitary*>& militaryBuildings = aii.GetMilitaryBuildings();
+    const auto& militaryBuildings = aii.GetMilitaryBuildings();
     const unsigned numMilBlds = militaryBuildings.size();
     // when the ai has many buildings the ai will not check the complete list every time
     constexpr unsigned limit = 40;
@@ -2451,7 +2453,7 @@ unsigned AIPlayerJH::CalcMilSettings()
     unsigned count = 0;
     unsigned soldierInUseFixed = 0;
     const auto* upgradeBld = UpdateUpgradeBuilding();
-    const std::list<nobMilitary*>& militaryBuildings = aii.GetMilitaryBuildings();
+    const auto& militaryBuildings = aii.GetMilitaryBuildings();
     for(const nobMilitary* milBld : militaryBuildings)
     {
         if(milBld->GetFrontierDistance() == FrontierDistance::Near
@@ -304,12 +304,12 @@ void noBuildingSite::AddWare(std::unique_ptr<Ware> ware)
     if(ware->type == GoodType::Boards)
     {
         RTTR_Assert(helpers::contains(ordered_boards, ware.get()));
-        ordered_boards.remove(ware.get());
+        helpers::erase(ordered_boards, ware.get());
         ++boards;
     } else if(ware->type == GoodType::Stones)
     {
         RTTR_Assert(helpers::contains(ordered_stones, ware.get()));
-        ordered_stones.remove(ware.get());
+        helpers::erase(ordered_stones, ware.get());
         ++stones;
     } else
         throw std::logic_error("Wrong ware type " + helpers::toString(ware->type));
@@ -326,11 +326,11 @@ void noBuildingSite::WareLost(Ware& ware)
     if(ware.type == GoodType::Boards)
     {
         RTTR_Assert(helpers::contains(ordered_boards, &ware));
-        ordered_boards.remove(&ware);
+        helpers::erase(ordered_boards, &ware);
     } else if(ware.type == GoodType::Stones)
     {
         RTTR_Assert(helpers::contains(ordered_stones, &ware));
-        ordered_stones.remove(&ware);
+        helpers::erase(ordered_stones, &ware);
     } else
         throw std::logic_error("Wrong ware type lost " + helpers::toString(ware.type));
 
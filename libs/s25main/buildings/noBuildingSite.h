@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,7 +7,7 @@
 #include "noBaseBuilding.h"
 #include "gameTypes/GoodTypes.h"
 #include <cstdint>
-#include <list>
+#include <vector>
 
 class nofBuilder;
 class nofPlaner;
@@ -41,7 +41,7 @@ class noBuildingSite : public noBaseBuilding
     /// Gibt den Baufortschritt an, wie hoch das Gebäude schon gebaut ist, gemessen in 8 Stufen für jede verbaute Ware
     unsigned char build_progress;
     /// Bestellte Bretter und Steine, d.h. Steine/Bretter, die noch "bestellt" wurden, aber noch nicht da sind
-    std::list<Ware*> ordered_boards, ordered_stones;
+    std::vector<Ware*> ordered_boards, ordered_stones;
 
 public:
     unsigned char getUsedBoards() const { return used_boards; }
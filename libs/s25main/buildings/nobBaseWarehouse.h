@@ -7,12 +7,14 @@
 #include "DataChangedObservable.h"
 #include "nobBaseMilitary.h"
 #include "variant.h"
+#include "helpers/containerUtils.h"
 #include "gameTypes/GoodsAndPeopleArray.h"
 #include "gameTypes/InventorySetting.h"
 #include "gameTypes/VirtualInventory.h"
 #include <array>
 #include <list>
 #include <memory>
+#include <vector>
 
 class nofCarrier;
 class noFigure;
@@ -59,7 +61,7 @@ protected:
     /// Liste von Figuren, die auf dem Weg zu dem Lagerhaus sind bzw. Soldaten die von ihm kommen
     std::list<noFigure*> dependent_figures;
     /// Liste von Waren, die auf dem Weg zum Lagerhaus sind
-    std::list<Ware*> dependent_wares;
+    std::vector<Ware*> dependent_wares;
     /// Produzier-Träger-Event
     const GameEvent* producinghelpers_event;
     /// Rekrutierungsevent für Soldaten
@@ -245,7 +247,7 @@ public:
     void RemoveDependentWare(Ware& ware)
     {
         RTTR_Assert(IsWareDependent(ware));
-        dependent_wares.remove(&ware);
+        helpers::erase(dependent_wares, &ware);
     }
     /// Überprüft, ob Ware abhängig ist
     bool IsWareDependent(const Ware& ware);
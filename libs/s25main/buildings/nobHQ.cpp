@@ -27,7 +27,7 @@ nobHQ::nobHQ(const MapPoint pos, const unsigned char player, const Nation nation
     TryRecruiting();
 
     // ins Militärquadrat einfügen
-    world->GetMilitarySquares().Add(this);
+    world->AddMilitaryBuilding(*this);
     world->RecalcTerritory(*this, TerritoryChangeReason::Build);
 }
 
@@ -326,7 +326,7 @@ void nobHQ::DestroyBuilding()
 {
     nobBaseWarehouse::DestroyBuilding();
     // Wieder aus dem Militärquadrat rauswerfen
-    world->GetMilitarySquares().Remove(this);
+    world->RemoveMilitaryBuilding(*this);
     // Recalc territory. AFTER calling base destroy as otherwise figures might get stuck here
     world->RecalcTerritory(*this, TerritoryChangeReason::Destroyed);
 }
@@ -339,7 +339,7 @@ void nobHQ::Serialize(SerializedGameData& sgd) const
 
 nobHQ::nobHQ(SerializedGameData& sgd, const unsigned obj_id) : nobBaseWarehouse(sgd, obj_id), isTent_(sgd.PopBool())
 {
-    world->GetMilitarySquares().Add(this);
+    world->AddMilitaryBuilding(*this);
 }
 
 void nobHQ::Draw(DrawPoint drawPt)
@@ -55,7 +55,7 @@ nobHarborBuilding::nobHarborBuilding(const MapPoint pos, const unsigned char pla
     : nobBaseWarehouse(BuildingType::HarborBuilding, pos, player, nation), orderware_ev(nullptr)
 {
     // ins Militärquadrat einfügen
-    world->GetMilitarySquares().Add(this);
+    world->AddMilitaryBuilding(*this);
     world->RecalcTerritory(*this, TerritoryChangeReason::Build);
 
     // Take 1 as the reserve per rank
@@ -137,7 +137,7 @@ void nobHarborBuilding::DestroyBuilding()
 
     nobBaseWarehouse::DestroyBuilding();
 
-    world->GetMilitarySquares().Remove(this);
+    world->RemoveMilitaryBuilding(*this);
     // Recalc territory. AFTER calling base destroy as otherwise figures might get stuck here
     world->RecalcTerritory(*this, TerritoryChangeReason::Destroyed);
 }
@@ -168,7 +168,7 @@ nobHarborBuilding::nobHarborBuilding(SerializedGameData& sgd, const unsigned obj
     : nobBaseWarehouse(sgd, obj_id), expedition(sgd), exploration_expedition(sgd), orderware_ev(sgd.PopEvent())
 {
     // ins Militärquadrat einfügen
-    world->GetMilitarySquares().Add(this);
+    world->AddMilitaryBuilding(*this);
 
     helpers::popContainer(sgd, seaIds);
 
@@ -1132,7 +1132,7 @@ std::vector<nobHarborBuilding::SeaAttackerBuilding> nobHarborBuilding::GetAttack
             continue;
         }
         // Weg vom Hafen zum Militärgebäude berechnen
-        if(!world->FindHumanPath(all_building->GetPos(), pos, MAX_ATTACKING_RUN_DISTANCE))
+        if(!world->IsReachableForAttack(all_building->GetPos(), pos))
             continue;
         // neues Gebäude mit weg und allem -> in die Liste!
         SeaAttackerBuilding sab = {static_cast<nobMilitary*>(all_building), this, 0};
@@ -1158,7 +1158,7 @@ nobHarborBuilding::GetAttackerBuildingsForSeaAttack(const std::vector<HarborId>&
             continue;
 
         // Weg vom Hafen zum Militärgebäude berechnen
-        if(!world->FindHumanPath(all_building->GetPos(), pos, MAX_ATTACKING_RUN_DISTANCE))
+        if(!world->IsReachableForAttack(all_building->GetPos(), pos))
             continue;
 
         // Entfernung zwischen Hafen und möglichen Zielhafenpunkt ausrechnen
@@ -45,9 +45,6 @@ nobMilitary::nobMilitary(const BuildingType type, const MapPoint pos, const unsi
       capturing_soldiers(0), gold_order_event(nullptr), armor_order_event(nullptr), upgrade_event(nullptr),
       armor_upgrade_event(nullptr), is_regulating_troops(false)
 {
-    // Gebäude entsprechend als Militärgebäude registrieren und in ein Militärquadrat eintragen
-    world->GetMilitarySquares().Add(this);
-
     // Größe ermitteln
     switch(type)
     {
@@ -62,6 +59,10 @@ nobMilitary::nobMilitary(const BuildingType type, const MapPoint pos, const unsi
     }
     troop_limits.fill(GetMaxTroopsCt());
 
+    // Gebäude entsprechend als Militärgebäude registrieren und in ein Militärquadrat eintragen
+    // Needs the size for the military radius of the territory claims
+    world->AddMilitaryBuilding(*this);
+
     // Tür aufmachen, bis Gebäude besetzt ist
     OpenDoor();
 
@@ -109,7 +110,7 @@ std::array<unsigned, NUM_SOLDIER_RANKS> nobMilitary::GetTotalSoldiersByRank() co
 void nobMilitary::DestroyBuilding()
 {
     // Remove from military square and buildings first, to avoid e.g. sending canceled soldiers back to this building
-    world->GetMilitarySquares().Remove(this);
+    world->RemoveMilitaryBuilding(*this);
 
     // Bestellungen stornieren
     CancelOrders();
@@ -205,7 +206,7 @@ nobMilitary::nobMilitary(SerializedGameData& sgd, const unsigned obj_id)
     }
 
     // ins Militärquadrat einfügen
-    world->GetMilitarySquares().Add(this);
+    world->AddMilitaryBuilding(*this);
 
     if(capturing && capturing_soldiers == 0 && aggressors.empty())
     {
@@ -741,7 +742,7 @@ void nobMilitary::AddWare(std::unique_ptr<Ware> ware)
         ++numCoins;
         // aus der Bestellliste raushaun
         RTTR_Assert(helpers::contains(ordered_coins, ware.get()));
-        ordered_coins.remove(ware.get());
+        helpers::erase(ordered_coins, ware.get());
 
         // Ware vernichten
         world->GetPlayer(player).RemoveWare(*ware);
@@ -753,7 +754,7 @@ void nobMilitary::AddWare(std::unique_ptr<Ware> ware)
     {
         ++numArmor;
         RTTR_Assert(helpers::contains(ordered_armor, ware.get()));
-        ordered_armor.remove(ware.get());
+        helpers::erase(ordered_armor, ware.get());
 
         world->GetPlayer(player).RemoveWare(*ware);
         ware.reset();
@@ -768,11 +769,11 @@ void nobMilitary::WareLost(Ware& ware)
     {
         // Ein Goldstück konnte nicht kommen --> aus der Bestellliste entfernen
         RTTR_Assert(helpers::contains(ordered_coins, &ware));
-        ordered_coins.remove(&ware);
+        helpers::erase(ordered_coins, &ware);
     } else
     {
         RTTR_Assert(helpers::contains(ordered_armor, &ware));
-        ordered_armor.remove(&ware);
+        helpers::erase(ordered_armor, &ware);
     }
 }
 
@@ -985,7 +986,7 @@ unsigned nobMilitary::GetNumSoldiersForAttack(const MapPoint dest) const
     }
 
     // und auch der Weg zu Fuß darf dann nicht so weit sein, wenn das alles bestanden ist, können wir ihn nehmen..
-    if(soldiers_count && world->FindHumanPath(pos, dest, MAX_ATTACKING_RUN_DISTANCE))
+    if(soldiers_count && world->IsReachableForAttack(pos, dest))
         // Soldaten davon nehmen
         return soldiers_count;
     else
@@ -1094,7 +1095,7 @@ void nobMilitary::Capture(const unsigned char new_owner)
     unsigned char old_player = player;
     world->GetPlayer(old_player).RemoveBuilding(this, bldType_);
     // neuer Spieler
-    player = new_owner;
+    SetPlayer(new_owner);
     // In der Wirtschaftsverwaltung dieses Gebäude jetzt zum neuen Spieler zählen und beim alten raushauen
     world->GetPlayer(new_owner).AddBuilding(this, bldType_);
 
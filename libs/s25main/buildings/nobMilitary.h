@@ -57,8 +57,8 @@ private:
     /// Bestellte Soldaten
     SortedTroops ordered_troops;
     /// Bestellter Goldmünzen
-    std::list<Ware*> ordered_coins;
-    std::list<Ware*> ordered_armor;
+    std::vector<Ware*> ordered_coins;
+    std::vector<Ware*> ordered_armor;
     /// Gibt an, ob gerade die Eroberer in das Gebäude gehen (und es so nicht angegegriffen werden sollte)
     bool capturing;
     /// Anzahl der Soldaten, die das Militärgebäude gerade noch einnehmen
@@ -59,7 +59,7 @@ nobUsual::nobUsual(SerializedGameData& sgd, const unsigned obj_id)
 
     orderedWares.resize(BLD_WORK_DESC[bldType_].waresNeeded.size());
 
-    for(std::list<Ware*>& orderedWare : orderedWares)
+    for(std::vector<Ware*>& orderedWare : orderedWares)
         sgd.PopObjectContainer(orderedWare, GO_Type::Ware);
     helpers::popContainer(sgd, lastProductivities);
 }
@@ -80,7 +80,7 @@ void nobUsual::Serialize(SerializedGameData& sgd) const
     sgd.PushBool(is_working);
 
     helpers::pushContainer(sgd, numWares);
-    for(const std::list<Ware*>& orderedWare : orderedWares)
+    for(const std::vector<Ware*>& orderedWare : orderedWares)
         sgd.PushObjectContainer(orderedWare, true);
     helpers::pushContainer(sgd, lastProductivities);
 }
@@ -98,7 +98,7 @@ void nobUsual::DestroyBuilding()
         world->GetPlayer(player).JobNotWanted(this);
 
     // Bestellte Waren Bescheid sagen
-    for(std::list<Ware*>& orderedWare : orderedWares)
+    for(std::vector<Ware*>& orderedWare : orderedWares)
     {
         for(Ware* ware : orderedWare)
             WareNotNeeded(ware);
@@ -290,7 +290,7 @@ void nobUsual::AddWare(std::unique_ptr<Ware> ware)
         {
             ++numWares[i];
             RTTR_Assert(helpers::contains(orderedWares[i], ware.get()));
-            orderedWares[i].remove(ware.get());
+            helpers::erase(orderedWares[i], ware.get());
             break;
         }
     }
@@ -321,7 +321,8 @@ void nobUsual::WareLost(Ware& ware)
         if(ware.type == workDesc.waresNeeded[i])
         {
             RTTR_Assert(helpers::contains(orderedWares[i], &ware));
-            orderedWares[i].remove(&ware);
+            helpers::erase(orderedWares[i], &ware);
+            world->GetPlayer(player).WareNeedsChanged(*this);
             break;
         }
     }
@@ -427,6 +428,7 @@ void nobUsual::ConsumeWares()
         // Set to value of next iteration. Note: It might have been not 0 for useOneWareEach == false
         wareIdxToUse = i + 1;
     }
+    owner.WareNeedsChanged(*this);
 }
 
 unsigned nobUsual::CalcDistributionPoints(const GoodType type)
@@ -475,6 +477,7 @@ void nobUsual::TakeWare(Ware* ware)
         {
             RTTR_Assert(!helpers::contains(orderedWares[i], ware));
             orderedWares[i].push_back(ware);
+            world->GetPlayer(player).WareNeedsChanged(*this);
             return;
         }
     }
@@ -499,6 +502,7 @@ void nobUsual::SetProductionEnabled(const bool enabled)
     // Wenn das von einem fremden Spieler umgestellt wurde (oder vom Replay), muss auch das visuelle umgestellt werden
     if(GAMECLIENT.GetPlayerId() != player || GAMECLIENT.IsReplayModeOn())
         disableProductionVirtual = disableProduction;
+    world->GetPlayer(player).WareNeedsChanged(*this);
 
     if(disableProduction)
     {
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,7 +7,6 @@
 #include "noBuilding.h"
 #include "gameTypes/GoodTypes.h"
 #include <array>
-#include <list>
 #include <vector>
 
 class Ware;
@@ -32,7 +31,7 @@ protected:
     /// Rohstoffe, die zur Produktion benötigt werden
     std::array<uint8_t, 3> numWares;
     /// Bestellte Waren
-    std::vector<std::list<Ware*>> orderedWares;
+    std::vector<std::vector<Ware*>> orderedWares;
     /// Bestell-Ware-Event
     const GameEvent* orderware_ev;
     /// Rechne-Produktivität-aus-Event
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks <sf-team at siedler25.org>
+// Copyright (C) 2005 - 2026 Settlers Freaks <sf-team at siedler25.org>
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -13,16 +13,20 @@
 #include <samplerate.hpp>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
-void convertSounds(libsiedler2::Archiv& sounds, const boost::filesystem::path& scriptPath)
+namespace {
+constexpr unsigned targetFrequency = 44100;
+} // namespace
+
+std::vector<unsigned> convertSounds(libsiedler2::Archiv& sounds, const boost::filesystem::path& scriptPath)
 {
     samplerate::State converter(samplerate::Converter::SincFastest, 1);
     std::vector<float> input, output;
+    std::vector<unsigned> convertedIndices;
     libsiedler2::loadMapping(
-      scriptPath, [&sounds, &converter, &input, &output](unsigned idx, const std::string& sFrequency) {
-          constexpr unsigned targetFrequency = 44100;
-
+      scriptPath, [&](unsigned idx, const std::string& sFrequency) {
           const auto frequency = s25util::fromStringClassic<unsigned>(sFrequency);
           auto* sound = dynamic_cast<libsiedler2::ArchivItem_Sound_Wave*>(sounds[idx]);
           if(!sound)
@@ -46,16 +50,24 @@ void convertSounds(libsiedler2::Archiv& sounds, const boost::filesystem::path& s
               int converted = std::lrint((value + 1.f) / 2.f * std::numeric_limits<uint8_t>::max());
               return static_cast<uint8_t>(std::min<int>(std::numeric_limits<uint8_t>::max(), std::max(0, converted)));
           });
-          // Those 2 are checked above, but for completeness here again
-          header.numChannels = 1;
-          header.bitsPerSample = 8;
-
-          header.samplesPerSec = targetFrequency;
-          header.frameSize = header.numChannels * helpers::divCeil(header.bitsPerSample, 8);
-          header.bytesPerSec = header.samplesPerSec * header.frameSize;
-          header.dataSize = data.size();
-          header.fileSize = data.size() + sizeof(header);
-          sound->setHeader(header);
-          sound->setData(data);
+          setConvertedSoundData(*sound, std::move(data));
+          convertedIndices.push_back(idx);
       });
+    return convertedIndices;
+}
+
+void setConvertedSoundData(libsiedler2::ArchivItem_Sound_Wave& sound, std::vector<uint8_t> data)
+{
+    auto header = sound.getHeader();
+    // Only 8 bit mono sounds are converted
+    header.numChannels = 1;
+    header.bitsPerSample = 8;
+
+    header.samplesPerSec = targetFrequency;
+    header.frameSize = header.numChannels * helpers::divCeil(header.bitsPerSample, 8);
+    header.bytesPerSec = header.samplesPerSec * header.frameSize;
+    header.dataSize = data.size();
+    header.fileSize = data.size() + sizeof(header);
+    sound.setHeader(header);
+    sound.setData(std::move(data));
 }
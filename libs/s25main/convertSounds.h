@@ -1,13 +1,19 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks <sf-team at siedler25.org>
+// Copyright (C) 2005 - 2026 Settlers Freaks <sf-team at siedler25.org>
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <vector>
 
 namespace libsiedler2 {
 class Archiv;
-}
+class ArchivItem_Sound_Wave;
+} // namespace libsiedler2
 
-void convertSounds(libsiedler2::Archiv& sounds, const boost::filesystem::path& scriptPath);
+/// Resample the sounds listed in the script to 44.1kHz. Returns the indices of the converted sounds
+std::vector<unsigned> convertSounds(libsiedler2::Archiv& sounds, const boost::filesystem::path& scriptPath);
+/// Set the data of a sound to the given (already converted) 44.1kHz samples and adjust its header
+void setConvertedSoundData(libsiedler2::ArchivItem_Sound_Wave& sound, std::vector<uint8_t> data);
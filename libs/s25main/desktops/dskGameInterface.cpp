@@ -39,6 +39,7 @@
 #include "ingameWindows/iwDistribution.h"
 #include "ingameWindows/iwEconomicProgress.h"
 #include "ingameWindows/iwEndgame.h"
+#include "ingameWindows/iwEventStatistics.h"
 #include "ingameWindows/iwHQ.h"
 #include "ingameWindows/iwHarborBuilding.h"
 #include "ingameWindows/iwInventory.h"
@@ -825,6 +826,11 @@ bool dskGameInterface::Msg_KeyDown(const KeyEvent& ke)
             return true;
         case KeyType::F3: // Map debug window
         {
+            if(ke.ctrl) // Event statistics
+            {
+                WINDOWMANAGER.ToggleWindow(std::make_unique<iwEventStatistics>(*game_->em_));
+                return true;
+            }
             const bool replayMode = GAMECLIENT.IsReplayModeOn();
             if(replayMode)
                 DisableFoW(true);
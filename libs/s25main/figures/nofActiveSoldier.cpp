@@ -213,22 +213,23 @@ bool nofActiveSoldier::TryFightingNearbyEnemy(const std::optional<unsigned char>
 
     const GamePlayer& owner = world->GetPlayer(player);
     // Check all close points
-    for(const auto& curPos : world->GetPointsInRadiusWithCenter(pos, 2))
-    {
-        for(noBase& object : world->GetFigures(curPos))
-        {
-            auto* soldier = dynamic_cast<nofActiveSoldier*>(&object);
-            if(!soldier || soldier->GetPlayer() == excludedOwner)
-                continue;
-            if(soldier->IsReadyForFight() && !owner.IsAlly(soldier->GetPlayer()))
-            {
-                enemy = soldier;
-                break;
-            }
-        }
-        if(enemy)
-            break;
-    }
+    world->CheckPointsInRadius<2>(
+      pos,
+      [&](const MapPoint curPos, unsigned) {
+          for(noBase& object : world->GetFigures(curPos))
+          {
+              auto* soldier = dynamic_cast<nofActiveSoldier*>(&object);
+              if(!soldier || soldier->GetPlayer() == excludedOwner)
+                  continue;
+              if(soldier->IsReadyForFight() && !owner.IsAlly(soldier->GetPlayer()))
+              {
+                  enemy = soldier;
+                  return true;
+              }
+          }
+          return false;
+      },
+      true);
 
     // No enemy found? Goodbye
     if(!enemy)
@@ -24,6 +24,7 @@ enum GUI_ID : unsigned
     CGI_DISTRIBUTION,
     CGI_ECONOMICPROGRESS,
     CGI_ENDGAME,
+    CGI_EVENT_STATISTICS,
     CGI_HELP,
     CGI_INPUTWINDOW,
     CGI_INVENTORY,
@@ -4,6 +4,7 @@
 
 #include "CompressedData.h"
 #include "FileChecksum.h"
+#include "RTTR_Assert.h"
 #include "helpers/format.hpp"
 #include "s25util/Log.h"
 #include <boost/nowide/fstream.hpp>
@@ -100,3 +101,76 @@ std::vector<char> CompressedData::decompress(const std::vector<char>& data, size
 
     return uncompressedData;
 }
+
+struct DecompressionStream::BzStream
+{
+    bz_stream stream = {};
+};
+
+DecompressionStream::DecompressionStream(unsigned uncompressedLength)
+    : stream_(std::make_unique<BzStream>()), data_(uncompressedLength), numDecompressed_(0), checksum_(0),
+      isDone_(false)
+{
+    const int err = BZ2_bzDecompressInit(&stream_->stream, 0, 0);
+    if(err != BZ_OK)
+        throw std::runtime_error(helpers::format("BZ2_bzDecompressInit failed with error: %1%", err));
+}
+
+DecompressionStream::~DecompressionStream()
+{
+    BZ2_bzDecompressEnd(&stream_->stream);
+}
+
+void DecompressionStream::add(const char* compressedData, size_t length)
+{
+    if(isDone_)
+    {
+        if(length > 0)
+            throw std::runtime_error("Received data after the end of the compressed stream");
+        return;
+    }
+    bz_stream& stream = stream_->stream;
+    stream.next_in = const_cast<char*>(compressedData);
+    stream.avail_in = static_cast<unsigned>(length);
+    stream.next_out = data_.data() + numDecompressed_;
+    stream.avail_out = static_cast<unsigned>(data_.size() - numDecompressed_);
+    while(stream.avail_in > 0 && !isDone_)
+    {
+        const int err = BZ2_bzDecompress(&stream);
+        if(err == BZ_STREAM_END)
+            isDone_ = true;
+        else if(err != BZ_OK)
+            throw std::runtime_error(helpers::format("BZ2_bzDecompress failed with error: %1%", err));
+        else if(stream.avail_out == 0 && stream.avail_in > 0)
+            throw std::runtime_error(
+              helpers::format("Decompressed data is larger than the expected size of %1%", data_.size()));
+    }
+    const size_t newNumDecompressed = data_.size() - stream.avail_out;
+    // The checksum is a plain sum so it can be updated for the new part only
+    checksum_ += CalcChecksumOfBuffer(data_.data() + numDecompressed_, newNumDecompressed - numDecompressed_);
+    numDecompressed_ = newNumDecompressed;
+
+    if(isDone_ && (numDecompressed_ != data_.size() || stream.avail_in > 0))
+    {
+        throw std::runtime_error(helpers::format("Length mismatch after decompressing. Expected: %1%, got %2%",
+                                                 data_.size(), numDecompressed_));
+    }
+}
+
+bool DecompressionStream::WriteToFile(const boost::filesystem::path& filePath) const
+{
+    RTTR_Assert(isDone_);
+    boost::nowide::ofstream file(filePath, std::ios::binary);
+
+    if(!file)
+    {
+        LOG.write("FATAL ERROR: can't write to %1%\n") % filePath;
+        return false;
+    }
+    if(!file.write(data_.data(), data_.size()))
+    {
+        LOG.write("FATAL ERROR: Writing to %1% failed\n") % filePath;
+        return false;
+    }
+    return true;
+}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <boost/filesystem/path.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -28,3 +29,32 @@ struct CompressedData
     static std::vector<char> compress(const std::vector<char>& data);
     static std::vector<char> decompress(const std::vector<char>& data, size_t uncompressedSize);
 };
+
+/// Decompresses data created by CompressedData::compress part by part, e.g. while it is received.
+/// Also calculates the checksum of the decompressed data
+class DecompressionStream
+{
+public:
+    /// Start decompressing data with the given uncompressed size. Throws on error
+    explicit DecompressionStream(unsigned uncompressedLength);
+    ~DecompressionStream();
+
+    /// Decompress the next part of compressed data. Throws on invalid data
+    void add(const char* compressedData, size_t length);
+    /// True if the end of the compressed stream was reached and all data is decompressed
+    bool isDone() const { return isDone_; }
+    /// Decompressed data (complete only if isDone)
+    const std::vector<char>& getData() const { return data_; }
+    /// Checksum of the data decompressed so far
+    unsigned getChecksum() const { return checksum_; }
+    /// Write the (complete) decompressed data to the file
+    bool WriteToFile(const boost::filesystem::path& filePath) const;
+
+private:
+    struct BzStream;
+    std::unique_ptr<BzStream> stream_;
+    std::vector<char> data_;
+    size_t numDecompressed_;
+    unsigned checksum_;
+    bool isDone_;
+};
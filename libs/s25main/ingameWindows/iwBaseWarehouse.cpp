@@ -219,8 +219,7 @@ void iwBaseWarehouse::Msg_ButtonClick(const unsigned ctrl_id)
         case ID_GOTO_NEXT: // go to next of same type
         {
             // is there at least 1 other building of the same type?
-            const std::list<nobBaseWarehouse*>& storehouses =
-              gwv.GetWorld().GetPlayer(wh->GetPlayer()).GetBuildingRegister().GetStorehouses();
+            const auto& storehouses = gwv.GetWorld().GetPlayer(wh->GetPlayer()).GetBuildingRegister().GetStorehouses();
             // go through list once we get to current building -> open window for the next one and go to next location
             auto it =
               helpers::find_if(storehouses, [whPos = wh->GetPos()](const auto* it) { return it->GetPos() == whPos; });
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -212,10 +212,10 @@ void iwBuilding::Msg_ButtonClick(const unsigned ctrl_id)
         break;
         case 12: // go to next of same type
         {
-            const std::list<nobUsual*>& buildings = gwv.GetWorld()
-                                                      .GetPlayer(building->GetPlayer())
-                                                      .GetBuildingRegister()
-                                                      .GetBuildings(building->GetBuildingType());
+            const auto& buildings = gwv.GetWorld()
+                                      .GetPlayer(building->GetPlayer())
+                                      .GetBuildingRegister()
+                                      .GetBuildings(building->GetBuildingType());
             // go through list once we get to current building -> open window for the next one and go to next location
             auto it = helpers::find_if(
               buildings, [bldPos = building->GetPos()](const auto* it) { return it->GetPos() == bldPos; });
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -156,7 +156,7 @@ void iwBuildings::Msg_ButtonClick(const unsigned ctrl_id)
 }
 
 template<class T_Window, class T_Building>
-void iwBuildings::GoToFirstMatching(BuildingType bldType, const std::list<T_Building*>& blds)
+void iwBuildings::GoToFirstMatching(BuildingType bldType, const helpers::OrderedPtrSet<T_Building>& blds)
 {
     for(T_Building* bld : blds)
     {
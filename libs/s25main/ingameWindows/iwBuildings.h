@@ -1,12 +1,12 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include "IngameWindow.h"
+#include "helpers/OrderedPtrSet.h"
 #include "gameTypes/BuildingType.h"
-#include <list>
 #include <vector>
 
 class GameCommandFactory;
@@ -27,7 +27,7 @@ private:
 
     void Msg_ButtonClick(unsigned ctrl_id) override;
     template<class T_Window, class T_Building>
-    void GoToFirstMatching(BuildingType bldType, const std::list<T_Building*>& blds);
+    void GoToFirstMatching(BuildingType bldType, const helpers::OrderedPtrSet<T_Building>& blds);
 
     void setBuildingOrder();
     std::vector<BuildingType> bts;
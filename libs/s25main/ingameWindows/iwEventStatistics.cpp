@@ -0,0 +1,131 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "iwEventStatistics.h"
+#include "EventManager.h"
+#include "EventStatistics.h"
+#include "Loader.h"
+#include "controls/ctrlTable.h"
+#include "controls/ctrlText.h"
+#include "helpers/format.hpp"
+#include "helpers/toString.h"
+#include "gameData/const_gui_ids.h"
+#include "s25util/Log.h"
+#include "s25util/colors.h"
+#include <sstream>
+#include <string>
+
+namespace {
+enum
+{
+    ID_tblEvents,
+    ID_txtSummary,
+    ID_txtDistribution,
+    ID_btReset,
+    ID_btPrint,
+    ID_tmrUpdate
+};
+} // namespace
+
+iwEventStatistics::iwEventStatistics(EventManager& em)
+    : IngameWindow(CGI_EVENT_STATISTICS, IngameWindow::posLastOrCenter, Extent(560, 350), _("Event statistics"),
+                   LOADER.GetImageN("resource", 41)),
+      em(em)
+{
+    em.EnableStatistics(true);
+
+    using SRT = ctrlTable::SortType;
+    AddTable(ID_tblEvents, DrawPoint(20, 30), Extent(520, 220), TextureColor::Grey, NormalFont,
+             ctrlTable::Columns{{_("Object type"), 250, SRT::String},
+                                {_("Event"), 70, SRT::Number},
+                                {_("Added"), 120, SRT::Number},
+                                {_("Executed"), 120, SRT::Number},
+                                {_("Removed"), 120, SRT::Number},
+                                {_("Avg. lifetime"), 120, SRT::Number}});
+    AddText(ID_txtSummary, DrawPoint(20, 260), "", COLOR_YELLOW, FontStyle{}, NormalFont);
+    AddText(ID_txtDistribution, DrawPoint(20, 280), "", COLOR_YELLOW, FontStyle{}, NormalFont);
+    AddTextButton(ID_btReset, DrawPoint(20, 310), Extent(150, 22), TextureColor::Grey, _("Reset"), NormalFont);
+    AddTextButton(ID_btPrint, DrawPoint(180, 310), Extent(150, 22), TextureColor::Grey, _("Write to log"), NormalFont);
+    using namespace std::chrono_literals;
+    AddTimer(ID_tmrUpdate, 1s);
+
+    GetCtrl<ctrlTable>(ID_tblEvents)->SortRows(3, TableSortDir::Descending);
+    UpdateStatistics();
+}
+
+iwEventStatistics::~iwEventStatistics()
+{
+    em.EnableStatistics(false);
+}
+
+void iwEventStatistics::Msg_ButtonClick(const unsigned ctrl_id)
+{
+    const EventStatistics* statistics = em.GetStatistics();
+    if(!statistics)
+        return;
+    if(ctrl_id == ID_btReset)
+    {
+        em.ResetStatistics();
+        UpdateStatistics();
+    } else if(ctrl_id == ID_btPrint)
+    {
+        std::stringstream report;
+        statistics->print(report);
+        LOG.write("%1%") % report.str();
+    }
+}
+
+void iwEventStatistics::Msg_Timer(unsigned /*ctrl_id*/)
+{
+    UpdateStatistics();
+}
+
+void iwEventStatistics::UpdateStatistics()
+{
+    const EventStatistics* statistics = em.GetStatistics();
+    if(!statistics)
+        return;
+
+    auto* table = GetCtrl<ctrlTable>(ID_tblEvents);
+    const auto sortCol = table->GetSortColumn();
+    const auto sortDir = table->GetSortDirection();
+    const auto selection = table->GetSelection();
+    table->DeleteAllItems();
+    for(const EventStatistics::Entry& entry : statistics->getEntries())
+    {
+        const EventStatistics::Counters& counters = entry.counters;
+        table->AddRow({getGOTypeName(entry.type), helpers::toString(entry.eventId), helpers::toString(counters.added),
+                       helpers::toString(counters.executed), helpers::toString(counters.removed),
+                       helpers::format("%.1f", counters.getAvgLifetime())});
+    }
+    if(sortCol >= 0)
+        table->SortRows(sortCol, sortDir);
+    if(selection && *selection < table->GetNumRows())
+        table->SetSelection(selection);
+
+    const EventStatistics::Counters total = statistics->getTotal();
+    const uint64_t numGFs = statistics->getNumGFs();
+    GetCtrl<ctrlText>(ID_txtSummary)
+      ->SetText(helpers::format(_("%1% GFs: %2% events executed, %3% per GF on average, %4% at most"), numGFs,
+                                total.executed, numGFs ? total.executed / numGFs : 0,
+                                statistics->getMaxEventsPerGF()));
+
+    // Bucket with the most GFs
+    const auto& eventsPerGF = statistics->getEventsPerGF();
+    unsigned mostCommonBucket = 0;
+    for(unsigned bucket = 1; bucket < eventsPerGF.size(); bucket++)
+    {
+        if(eventsPerGF[bucket] > eventsPerGF[mostCommonBucket])
+            mostCommonBucket = bucket;
+    }
+    const unsigned bucketStart = EventStatistics::getBucketStart(mostCommonBucket);
+    std::string numEvents = helpers::toString(bucketStart);
+    if(mostCommonBucket + 1u == eventsPerGF.size())
+        numEvents += "+";
+    else if(EventStatistics::getBucketStart(mostCommonBucket + 1u) - 1u > bucketStart)
+        numEvents += "-" + helpers::toString(EventStatistics::getBucketStart(mostCommonBucket + 1u) - 1u);
+    GetCtrl<ctrlText>(ID_txtDistribution)
+      ->SetText(helpers::format(_("Most GFs execute %1% events (%2% of %3% GFs)"), numEvents,
+                                eventsPerGF[mostCommonBucket], numGFs));
+}
@@ -0,0 +1,26 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "IngameWindow.h"
+
+class EventManager;
+
+/// Shows which object types and events cause the most work for the EventManager.
+/// Statistics are collected while this window is open
+class iwEventStatistics : public IngameWindow
+{
+public:
+    explicit iwEventStatistics(EventManager& em);
+    ~iwEventStatistics() override;
+
+private:
+    void Msg_ButtonClick(unsigned ctrl_id) override;
+    void Msg_Timer(unsigned ctrl_id) override;
+
+    void UpdateStatistics();
+
+    EventManager& em;
+};
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -162,7 +162,7 @@ void iwMerchandiseStatistics::DrawStatistic()
     const std::set<unsigned>& active = GetCtrl<ctrlMultiSelectGroup>(22)->GetSelection();
 
     // Statistik holen
-    const GamePlayer::Statistic stat = player.GetStatistic(currentTime);
+    const GamePlayer::Statistic& stat = player.GetStatistic(currentTime);
 
     // Maximalwert suchen
     unsigned short max = 1;
@@ -181,7 +181,6 @@ void iwMerchandiseStatistics::DrawStatistic()
     maxValue->SetText(std::to_string(max));
 
     DrawPoint previous(0, 0);
-    unsigned short currentIndex = stat.currentIndex;
 
     for(unsigned short it : active)
     {
@@ -192,11 +191,7 @@ void iwMerchandiseStatistics::DrawStatistic()
         {
             DrawPoint drawPos = topLeft;
             drawPos.x += (NUM_STAT_STEPS - i) * stepX;
-            drawPos.y += sizeY
-                         - ((stat.merchandiseData[it - 1][(currentIndex >= i) ? (currentIndex - i) :
-                                                                                (NUM_STAT_STEPS - i + currentIndex)])
-                            * sizeY)
-                             / max;
+            drawPos.y += sizeY - (stat.GetMerchandiseValue(it - 1, i) * sizeY) / max;
             if(i != 0)
             {
                 DrawLine(drawPos, previous, 2, BarColors[it - 1]);
@@ -329,13 +329,12 @@ void iwStatistics::DrawStatistic(StatisticType type)
             continue;
         const GamePlayer::Statistic& stat = world.GetPlayer(p).GetStatistic(currentTime);
 
-        const auto currentIndex = stat.currentIndex;
         for(const auto i : helpers::range(NUM_STAT_STEPS))
         {
-            const auto idx = (currentIndex >= i) ? (currentIndex - i) : (NUM_STAT_STEPS - i + currentIndex);
-            max = std::max(max, stat.data[type][idx]);
+            const unsigned curStatVal = stat.GetValue(type, i);
+            max = std::max(max, curStatVal);
             if(SETTINGS.ingame.scaleStatistics) //-V807
-                min = std::min(min, stat.data[type][idx]);
+                min = std::min(min, curStatVal);
         }
     }
 
@@ -360,12 +359,10 @@ void iwStatistics::DrawStatistic(StatisticType type)
         const GamePlayer::Statistic& stat = world.GetPlayer(p).GetStatistic(currentTime);
         const auto playerColor = world.GetPlayer(p).color;
 
-        const auto currentIndex = stat.currentIndex;
         for(const auto i : helpers::range(NUM_STAT_STEPS))
         {
             DrawPoint curPos = topLeft + DrawPoint((NUM_STAT_STEPS - i) * stepX, diagramSize.y);
-            unsigned curStatVal =
-              stat.data[type][(currentIndex >= i) ? (currentIndex - i) : (NUM_STAT_STEPS - i + currentIndex)];
+            const unsigned curStatVal = stat.GetValue(type, i);
             if(SETTINGS.ingame.scaleStatistics)
                 curPos.y -= ((curStatVal - min) * diagramSize.y) / (max - min);
             else
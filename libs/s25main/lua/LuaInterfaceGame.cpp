@@ -1,10 +1,11 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "LuaInterfaceGame.h"
 #include "EventManager.h"
 #include "Game.h"
+#include "SerializedGameData.h"
 #include "WindowManager.h"
 #include "ai/AIInterface.h"
 #include "ai/AIPlayer.h"
@@ -14,12 +15,14 @@
 #include "lua/LuaWorld.h"
 #include "postSystem/PostMsg.h"
 #include "world/GameWorld.h"
+#include "helpers/serializePoint.h"
 #include "gameTypes/Resource.h"
 #include "s25util/Serializer.h"
 #include "s25util/strAlgos.h"
 
 LuaInterfaceGame::LuaInterfaceGame(Game& gameInstance, ILocalGameState& localGameState)
-    : LuaInterfaceGameBase(localGameState), localGameState(localGameState), gw(gameInstance.world_), game(gameInstance)
+    : LuaInterfaceGameBase(localGameState), localGameState(localGameState), gw(gameInstance.world_), game(gameInstance),
+      exploredPts_(gw.GetNumPlayers()), occupiedPts_(gw.GetNumPlayers())
 {
 #pragma region ConstDefs
 #define ADD_LUA_CONST(name) lua["BLD_" + s25util::toUpper(#name)] = BuildingType::name
@@ -259,6 +262,44 @@ bool LuaInterfaceGame::Deserialize(Serializer& luaSaveState)
         return true;
 }
 
+void LuaInterfaceGame::SerializeBatchedEvents(SerializedGameData& sgd) const
+{
+    for(const std::vector<ExploredPoint>& pts : exploredPts_)
+    {
+        sgd.PushVarSize(pts.size());
+        for(const ExploredPoint& explPt : pts)
+        {
+            helpers::pushPoint(sgd, explPt.pt);
+            sgd.PushUnsignedChar(explPt.owner);
+        }
+    }
+    for(const std::vector<MapPoint>& pts : occupiedPts_)
+    {
+        sgd.PushVarSize(pts.size());
+        for(const MapPoint& pt : pts)
+            helpers::pushPoint(sgd, pt);
+    }
+}
+
+void LuaInterfaceGame::DeserializeBatchedEvents(SerializedGameData& sgd)
+{
+    for(std::vector<ExploredPoint>& pts : exploredPts_)
+    {
+        pts.resize(sgd.PopVarSize());
+        for(ExploredPoint& explPt : pts)
+        {
+            explPt.pt = helpers::popPoint<MapPoint>(sgd);
+            explPt.owner = sgd.PopUnsignedChar();
+        }
+    }
+    for(std::vector<MapPoint>& pts : occupiedPts_)
+    {
+        pts.resize(sgd.PopVarSize());
+        for(MapPoint& pt : pts)
+            pt = helpers::popPoint<MapPoint>(sgd);
+    }
+}
+
 void LuaInterfaceGame::ClearResources()
 {
     for(unsigned p = 0; p < gw.GetNumPlayers(); p++)
@@ -341,28 +382,89 @@ LuaWorld LuaInterfaceGame::GetWorld()
     return LuaWorld(gw);
 }
 
+void LuaInterfaceGame::onScriptLoaded()
+{
+    const auto getHandler = [this](const char* name) -> kaguya::LuaRef {
+        kaguya::LuaRef handler = lua[name];
+        return (handler.type() == LUA_TFUNCTION) ? handler : kaguya::LuaRef();
+    };
+    onGameFrame_ = getHandler("onGameFrame");
+    onExplored_ = getHandler("onExplored");
+    onExploredBatch_ = getHandler("onExploredBatch");
+    onOccupied_ = getHandler("onOccupied");
+    onOccupiedBatch_ = getHandler("onOccupiedBatch");
+}
+
 void LuaInterfaceGame::EventExplored(unsigned player, const MapPoint pt, unsigned char owner)
 {
-    kaguya::LuaRef onExplored = lua["onExplored"];
-    if(onExplored.type() == LUA_TFUNCTION)
+    if(onExploredBatch_.type() == LUA_TFUNCTION)
+        exploredPts_[player].push_back(ExploredPoint{pt, owner});
+    else if(onExplored_.type() == LUA_TFUNCTION)
     {
         if(owner == 0)
         {
             // No owner? Pass nil value to Lua.
-            onExplored.call<void>(player, pt.x, pt.y, kaguya::NilValue());
+            onExplored_.call<void>(player, pt.x, pt.y, kaguya::NilValue());
         } else
         {
             // Adapt owner to be comparable with the player index
-            onExplored.call<void>(player, pt.x, pt.y, owner - 1);
+            onExplored_.call<void>(player, pt.x, pt.y, owner - 1);
         }
     }
 }
 
 void LuaInterfaceGame::EventOccupied(unsigned player, const MapPoint pt)
 {
-    kaguya::LuaRef onOccupied = lua["onOccupied"];
-    if(onOccupied.type() == LUA_TFUNCTION)
-        onOccupied.call<void>(player, pt.x, pt.y);
+    if(onOccupiedBatch_.type() == LUA_TFUNCTION)
+        occupiedPts_[player].push_back(pt);
+    else if(onOccupied_.type() == LUA_TFUNCTION)
+        onOccupied_.call<void>(player, pt.x, pt.y);
+}
+
+void LuaInterfaceGame::FlushBatchedEvents()
+{
+    for(unsigned player = 0; player < exploredPts_.size(); player++)
+    {
+        if(exploredPts_[player].empty())
+            continue;
+        // Move out first as the handler might cause new events and the script might have been reloaded
+        const std::vector<ExploredPoint> pts = std::move(exploredPts_[player]);
+        exploredPts_[player].clear();
+        if(onExploredBatch_.type() != LUA_TFUNCTION)
+            continue;
+        kaguya::LuaTable luaPts = lua.newTable();
+        int idx = 1;
+        for(const ExploredPoint& explPt : pts)
+        {
+            kaguya::LuaTable luaPt = lua.newTable();
+            luaPt[1] = explPt.pt.x;
+            luaPt[2] = explPt.pt.y;
+            // No owner -> nil
+            if(explPt.owner != 0)
+                luaPt[3] = explPt.owner - 1;
+            luaPts[idx++] = luaPt;
+        }
+        onExploredBatch_.call<void>(player, luaPts);
+    }
+    for(unsigned player = 0; player < occupiedPts_.size(); player++)
+    {
+        if(occupiedPts_[player].empty())
+            continue;
+        const std::vector<MapPoint> pts = std::move(occupiedPts_[player]);
+        occupiedPts_[player].clear();
+        if(onOccupiedBatch_.type() != LUA_TFUNCTION)
+            continue;
+        kaguya::LuaTable luaPts = lua.newTable();
+        int idx = 1;
+        for(const MapPoint& pt : pts)
+        {
+            kaguya::LuaTable luaPt = lua.newTable();
+            luaPt[1] = pt.x;
+            luaPt[2] = pt.y;
+            luaPts[idx++] = luaPt;
+        }
+        onOccupiedBatch_.call<void>(player, luaPts);
+    }
 }
 
 void LuaInterfaceGame::EventAttack(unsigned char attackerPlayerId, unsigned char defenderPlayerId,
@@ -382,9 +484,9 @@ void LuaInterfaceGame::EventStart(bool isFirstStart)
 
 void LuaInterfaceGame::EventGameFrame(unsigned nr)
 {
-    kaguya::LuaRef onGameFrame = lua["onGameFrame"];
-    if(onGameFrame.type() == LUA_TFUNCTION)
-        onGameFrame.call<void>(nr);
+    FlushBatchedEvents();
+    if(onGameFrame_.type() == LUA_TFUNCTION)
+        onGameFrame_.call<void>(nr);
 }
 
 void LuaInterfaceGame::EventResourceFound(unsigned char player, const MapPoint pt, ResourceType type,
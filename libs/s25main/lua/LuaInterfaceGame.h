@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -9,11 +9,13 @@
 #include "gameTypes/PactTypes.h"
 #include <memory>
 #include <string>
+#include <vector>
 
 class GameWorld;
 class LuaPlayer;
 class LuaWorld;
 class Serializer;
+class SerializedGameData;
 class Game;
 enum class ResourceType : uint8_t;
 
@@ -28,7 +30,12 @@ public:
 
     bool Serialize(Serializer& luaSaveState);
     bool Deserialize(Serializer& luaSaveState);
+    /// Save/load the explored and occupied points not yet delivered to the batch handlers.
+    /// Those might be raised after the batches were delivered in the current game frame or by game commands
+    void SerializeBatchedEvents(SerializedGameData& sgd) const;
+    void DeserializeBatchedEvents(SerializedGameData& sgd);
 
+    /// Explored and occupied points are delivered at once in the next game frame if the batch handler exists
     void EventExplored(unsigned player, MapPoint pt, unsigned char owner);
     void EventOccupied(unsigned player, MapPoint pt);
     void EventAttack(unsigned char attackerPlayerId, unsigned char defenderPlayerId, unsigned attackerCount);
@@ -59,10 +66,27 @@ public:
     void PostMessageLua(int playerIdx, const std::string& msg);
     void PostMessageWithLocation(int playerIdx, const std::string& msg, int x, int y);
 
+protected:
+    void onScriptLoaded() override;
+
 private:
+    struct ExploredPoint
+    {
+        MapPoint pt;
+        unsigned char owner;
+    };
+
     ILocalGameState& localGameState;
     GameWorld& gw;
     Game& game;
+    /// Handlers of frequent events, resolved when a script is loaded
+    kaguya::LuaRef onGameFrame_, onExplored_, onExploredBatch_, onOccupied_, onOccupiedBatch_;
+    /// Points explored/occupied in the current game frame per player, if batched
+    std::vector<std::vector<ExploredPoint>> exploredPts_;
+    std::vector<std::vector<MapPoint>> occupiedPts_;
+
+    /// Call the batch handlers with the collected points
+    void FlushBatchedEvents();
     LuaPlayer GetPlayer(int playerIdx);
     LuaWorld GetWorld();
 };
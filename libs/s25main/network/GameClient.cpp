@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GameClient.h"
+#include "AllocationStatistics.h"
 #include "CreateServerInfo.h"
 #include "EventManager.h"
 #include "Game.h"
@@ -40,6 +41,7 @@
 #include "world/GameWorld.h"
 #include "world/GameWorldView.h"
 #include "world/MapLoader.h"
+#include "gameTypes/CompressedData.h"
 #include "gameTypes/RoadBuildState.h"
 #include "gameData/GameConsts.h"
 #include "gameData/PortraitConsts.h"
@@ -88,7 +90,10 @@ void GameClient::ClientConfig::Clear()
     isHost = false;
 }
 
-GameClient::GameClient() : skiptogf(0), mainPlayer(0), state(ClientState::Stopped), ci(nullptr), replayMode(false) {}
+GameClient::GameClient()
+    : skiptogf(0), mainPlayer(0), state(ClientState::Stopped), ci(nullptr), stateHashInterval(0),
+      numNWFsSinceStateHash(0), replayMode(false)
+{}
 
 GameClient::~GameClient()
 {
@@ -227,6 +232,8 @@ void GameClient::Stop()
     framesinfo.Clear();
     clientconfig.Clear();
     mapinfo.Clear();
+    mapReceiver = MapDataReceiver();
+    luaReceiver = MapDataReceiver();
 
     if(replayinfo)
     {
@@ -772,6 +779,7 @@ bool GameClient::OnGameMessage(const GameMessage_Server_Start& msg)
 
     nwfInfo = std::make_shared<NWFInfo>();
     nwfInfo->init(msg.firstNwf, msg.cmdDelay);
+    numNWFsSinceStateHash = 0;
     try
     {
         StartGame(msg.random_init);
@@ -970,11 +978,48 @@ bool GameClient::OnGameMessage(const GameMessage_Map_Info& msg)
     mapinfo.luaData.uncompressedLength = msg.luaLen;
     mapinfo.mapData.data.resize(msg.mapCompressedLen);
     mapinfo.luaData.data.resize(msg.luaCompressedLen);
+    StartMapReceive();
     mainPlayer.sendMsgAsync(new GameMessage_MapRequest(false));
     AdvanceState(ConnectState::ReceiveMap);
     return true;
 }
 
+void GameClient::StartMapReceive()
+{
+    const auto startReceive = [](MapDataReceiver& receiver, const CompressedData& data) {
+        receiver.numReceived = 0;
+        receiver.decompressor.reset();
+        if(data.data.empty())
+            return;
+        try
+        {
+            receiver.decompressor = std::make_unique<DecompressionStream>(data.uncompressedLength);
+        } catch(const std::runtime_error& err)
+        {
+            // Decompress after receiving everything
+            LOG.write("Could not start decompression: %1%\n") % err.what();
+        }
+    };
+    startReceive(mapReceiver, mapinfo.mapData);
+    startReceive(luaReceiver, mapinfo.luaData);
+}
+
+namespace {
+/// Write the received data to the file and calculate its checksum.
+/// Uses the data decompressed while receiving if possible
+bool writeReceivedData(std::unique_ptr<DecompressionStream>& decompressor, const CompressedData& data,
+                       const bfs::path& filePath, unsigned& checksum)
+{
+    const std::unique_ptr<DecompressionStream> curDecompressor = std::move(decompressor);
+    if(curDecompressor && curDecompressor->isDone())
+    {
+        checksum = curDecompressor->getChecksum();
+        return curDecompressor->WriteToFile(filePath);
+    }
+    return data.DecompressToFile(filePath, &checksum);
+}
+} // namespace
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Kartendaten
 /// @param message  Nachricht, welche ausgeführt wird
@@ -992,6 +1037,26 @@ bool GameClient::OnGameMessage(const GameMessage_Map_Data& msg)
     }
     std::copy(msg.data.begin(), msg.data.end(), targetData.begin() + msg.offset);
 
+    MapDataReceiver& receiver = (msg.isMapData) ? mapReceiver : luaReceiver;
+    if(receiver.decompressor)
+    {
+        if(msg.offset != receiver.numReceived)
+            receiver.decompressor.reset(); // Out of order, decompress everything at the end
+        else
+        {
+            try
+            {
+                receiver.decompressor->add(msg.data.data(), msg.data.size());
+                receiver.numReceived += msg.data.size();
+            } catch(const std::runtime_error& err)
+            {
+                LOG.write("FATAL ERROR: %1%\n") % err.what();
+                OnError(ClientError::MapTransmission);
+                return true;
+            }
+        }
+    }
+
     uint32_t totalSize = mapinfo.mapData.data.size();
     uint32_t receivedSize = msg.offset + msg.data.size();
     if(!mapinfo.luaFilepath.empty())
@@ -1006,12 +1071,13 @@ bool GameClient::OnGameMessage(const GameMessage_Map_Data& msg)
 
     if(receivedSize == totalSize)
     {
-        if(!mapinfo.mapData.DecompressToFile(mapinfo.filepath, &mapinfo.mapChecksum))
+        if(!writeReceivedData(mapReceiver.decompressor, mapinfo.mapData, mapinfo.filepath, mapinfo.mapChecksum))
         {
             OnError(ClientError::MapTransmission);
             return true;
         }
-        if(!mapinfo.luaFilepath.empty() && !mapinfo.luaData.DecompressToFile(mapinfo.luaFilepath, &mapinfo.luaChecksum))
+        if(!mapinfo.luaFilepath.empty()
+           && !writeReceivedData(luaReceiver.decompressor, mapinfo.luaData, mapinfo.luaFilepath, mapinfo.luaChecksum))
         {
             OnError(ClientError::MapTransmission);
             return true;
@@ -1120,6 +1186,7 @@ bool GameClient::OnGameMessage(const GameMessage_Map_ChecksumOK& msg)
         gameLobby.reset();
         if(msg.retryAllowed)
         {
+            StartMapReceive();
             mainPlayer.sendMsgAsync(new GameMessage_MapRequest(false));
             AdvanceState(ConnectState::ReceiveMap);
         } else
@@ -1174,6 +1241,23 @@ bool GameClient::OnGameMessage(const GameMessage_GameCommand& msg)
     return true;
 }
 
+bool GameClient::OnGameMessage(const GameMessage_GameCommandBatch& msg)
+{
+    if(nwfInfo)
+    {
+        for(const GameMessage_GameCommandBatch::Entry& entry : msg.entries)
+        {
+            if(!nwfInfo->addPlayerCmds(entry.player, entry.cmds))
+            {
+                LOG.write("Could not add gamecommands for player %1%. He might be cheating!\n")
+                  % unsigned(entry.player);
+                RTTR_Assert(false);
+            }
+        }
+    }
+    return true;
+}
+
 void GameClient::IncreaseSpeed(const bool wraparound)
 {
     const auto curSpeed = framesinfo.gfLengthReq;
@@ -1353,6 +1437,7 @@ void GameClient::ExecuteGameFrame()
                 NextGF(isNWF);
                 RTTR_Assert(curGF <= nwfInfo->getNextNWF());
                 HandleAutosave();
+                HandleReplaySnapshot();
 
                 // GF-Ende im Replay aktualisieren
                 if(replayinfo && replayinfo->replay.IsRecording())
@@ -1410,11 +1495,30 @@ void GameClient::HandleAutosave()
     }
 }
 
+void GameClient::HandleReplaySnapshot()
+{
+    if(!SETTINGS.interface.replaySnapshotInterval || !replayinfo || !replayinfo->replay.IsRecording())
+        return;
+
+    if(GetGFNumber() % SETTINGS.interface.replaySnapshotInterval == 0)
+    {
+        try
+        {
+            replayinfo->replay.AddSnapshot(*game);
+        } catch(const std::exception& e)
+        {
+            LOG.write(_("Failed to add snapshot to replay: %1%\n")) % e.what();
+        }
+    }
+}
+
 /// Führt notwendige Dinge für nächsten GF aus
 void GameClient::NextGF(bool wasNWF)
 {
     for(AIPlayer& ai : game->aiPlayers_)
         ai.RunGF(GetGFNumber(), wasNWF);
+    // The AI runs after the events of its GF
+    AllocationStatistics::onGFFinished(GetGFNumber());
     game->RunGF();
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -29,6 +29,7 @@ struct Info;
 
 class AIPlayer;
 class ClientInterface;
+class DecompressionStream;
 class Game;
 class GameEvent;
 class GameLobby;
@@ -161,6 +162,9 @@ public:
     /// Is tournament mode activated (0 if not)? Returns the durations of the tournament mode in gf otherwise
     unsigned GetTournamentModeDuration() const;
 
+    /// Set the number of NWFs after which the detailed state hash is sent to the server. 0 (default) to disable
+    void SetStateHashInterval(unsigned numNWFs) { stateHashInterval = numNWFs; }
+
     void SkipGF(unsigned gf, GameWorldView& gwv);
 
     /// Changes the player ingame (for replay or debugging)
@@ -207,6 +211,8 @@ private:
     void NextGF(bool wasNWF);
     /// Checks if its time for autosaving (if enabled) and does it
     void HandleAutosave();
+    /// Adds a snapshot to the recorded replay if enabled and due
+    void HandleReplaySnapshot();
 
     //  Netzwerknachrichten
     RTTR_IGNORE_OVERLOADED_VIRTUAL
@@ -243,6 +249,7 @@ private:
     bool OnGameMessage(const GameMessage_SkipToGF& msg) override;
     bool OnGameMessage(const GameMessage_Server_NWFDone& msg) override;
     bool OnGameMessage(const GameMessage_GameCommand& msg) override;
+    bool OnGameMessage(const GameMessage_GameCommandBatch& msg) override;
 
     bool OnGameMessage(const GameMessage_GGSChange& msg) override;
     bool OnGameMessage(const GameMessage_RemoveLua& msg) override;
@@ -259,6 +266,8 @@ private:
     bool VerifyState(ConnectState expectedState);
 
     bool CreateLobby();
+    /// Prepare receiving the map (and lua) data with the sizes set in mapinfo
+    void StartMapReceive();
 
     /// Wird aufgerufen, wenn der Server gegangen ist (Verbindung verloren, ungültige Nachricht etc.)
     void ServerLost();
@@ -305,6 +314,14 @@ private:
     } clientconfig;
 
     MapInfo mapinfo;
+    /// Decompresses map/lua data while it is received
+    struct MapDataReceiver
+    {
+        std::unique_ptr<DecompressionStream> decompressor;
+        /// Number of compressed bytes received in order
+        unsigned numReceived = 0;
+    };
+    MapDataReceiver mapReceiver, luaReceiver;
 
     FramesInfoClient framesinfo;
 
@@ -312,6 +329,8 @@ private:
 
     /// GameCommands, die vom Client noch an den Server gesendet werden müssen
     std::vector<gc::GameCommandPtr> gameCommands_;
+    /// Number of NWFs between sending the state hash and number of NWFs since the last one
+    unsigned stateHashInterval, numNWFsSinceStateHash;
 
     std::unique_ptr<ReplayInfo> replayinfo;
     bool replayMode;
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "Game.h"
+#include "GameCommands.h"
 #include "GameMessage_Chat.h"
 #include "GameMessage_GameCommand.h"
 #include "NWFInfo.h"
@@ -14,7 +15,7 @@ void GameClient::ExecuteNWF()
 {
     // Geschickte Network Commands der Spieler ausführen und ggf. im Replay aufzeichnen
 
-    AsyncChecksum checksum = AsyncChecksum::create(*game);
+    const AsyncChecksum checksum = AsyncChecksum::create(*game);
     const unsigned curGF = GetGFNumber();
 
     for(const NWFPlayerInfo& player : nwfInfo->getPlayerInfos())
@@ -34,19 +35,31 @@ void GameClient::ExecuteNWF()
         ExecuteAllGCs(player.id, currentGCs);
     }
 
-    // Send GC message for this NWF
-    // First for all potential AIs as we need to combine the AI cmds of the local player with our own ones
+    // Send GC message for this NWF with the commands of all potential AIs and our own ones
+    auto* gcMsg = new GameMessage_GameCommandBatch();
+    // Add the detailed hash every few NWFs so the server can find out where an async happened.
+    // Sent once for this client as the AIs run on the same game state
+    if(stateHashInterval > 0 && ++numNWFsSinceStateHash >= stateHashInterval)
+    {
+        numNWFsSinceStateHash = 0;
+        gcMsg->stateHash = StateHash::create(game->world_);
+    }
     for(AIPlayer& ai : game->aiPlayers_)
     {
-        const std::vector<gc::GameCommandPtr> aiGCs = ai.FetchGameCommands();
+        std::vector<gc::GameCommandPtr> aiGCs = ai.FetchGameCommands();
         /// Cmds from own AI get added to our gcs
         if(ai.GetPlayerId() == GetPlayerId())
             gameCommands_.insert(gameCommands_.end(), aiGCs.begin(), aiGCs.end());
         else
-            mainPlayer.sendMsgAsync(new GameMessage_GameCommand(ai.GetPlayerId(), checksum, aiGCs));
+        {
+            gc::removeRedundantCommands(aiGCs);
+            gcMsg->add(ai.GetPlayerId(), checksum, std::move(aiGCs));
+        }
         for(auto& msg : ai.getAIInterface().FetchChatMessages())
             mainPlayer.sendMsgAsync(msg.release());
     }
-    mainPlayer.sendMsgAsync(new GameMessage_GameCommand(0xFF, checksum, gameCommands_));
+    gc::removeRedundantCommands(gameCommands_);
+    gcMsg->add(GameMessageWithPlayer::NO_PLAYER_ID, checksum, std::move(gameCommands_));
+    mainPlayer.sendMsgAsync(gcMsg);
     gameCommands_.clear();
 }
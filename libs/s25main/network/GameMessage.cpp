@@ -56,6 +56,7 @@ Message* GameMessage::create_game(unsigned short id)
         case NMS_PAUSE: msg = new GameMessage_Pause(); break;
         case NMS_SKIP_TO_GF: msg = new GameMessage_SkipToGF(); break;
         case NMS_SERVER_SPEED: msg = new GameMessage_Speed(); break;
+        case NMS_GAMECOMMANDS_BATCH: msg = new GameMessage_GameCommandBatch(); break;
         case NMS_GGS_CHANGE: msg = new GameMessage_GGSChange(); break;
         case NMS_REMOVE_LUA: msg = new GameMessage_RemoveLua(); break;
         case NMS_GET_ASYNC_LOG: msg = new GameMessage_GetAsyncLog(); break;
@@ -54,7 +54,8 @@ GENERATE_GAME_MESSAGE_INTERFACE(GameMessage_Ping, GameMessage_Pong,
                                 GameMessage_Map_Info, GameMessage_MapRequest, GameMessage_Map_Data,
                                 GameMessage_Map_Checksum, GameMessage_Map_ChecksumOK, GameMessage_GGSChange,
                                 GameMessage_RemoveLua, GameMessage_Pause, GameMessage_SkipToGF,
-                                GameMessage_Server_NWFDone, GameMessage_GameCommand, GameMessage_Speed,
+                                GameMessage_Server_NWFDone, GameMessage_GameCommand, GameMessage_GameCommandBatch,
+                                GameMessage_Speed,
 
                                 GameMessage_GetAsyncLog, GameMessage_AsyncLog)
 RTTR_POP_DIAGNOSTIC
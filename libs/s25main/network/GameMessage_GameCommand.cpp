@@ -5,6 +5,8 @@
 #include "GameMessage_GameCommand.h"
 #include "GameMessageInterface.h"
 #include "GameProtocol.h"
+#include "s25util/Serializer.h"
+#include <stdexcept>
 
 //////////////////////////////////////////////////////////////////////////
 
@@ -32,3 +34,69 @@ bool GameMessage_GameCommand::Run(GameMessageInterface* callback) const
 {
     return callback->OnGameMessage(*this);
 }
+
+//////////////////////////////////////////////////////////////////////////
+
+GameMessage_GameCommandBatch::GameMessage_GameCommandBatch() : GameMessage(NMS_GAMECOMMANDS_BATCH) {}
+
+void GameMessage_GameCommandBatch::add(uint8_t player, const AsyncChecksum& checksum,
+                                       std::vector<gc::GameCommandPtr> gcs)
+{
+    entries.push_back(Entry{player, PlayerGameCommands(checksum, std::move(gcs))});
+}
+
+void GameMessage_GameCommandBatch::Serialize(Serializer& ser) const
+{
+    GameMessage::Serialize(ser);
+    ser.PushBool(!stateHash.empty());
+    if(!stateHash.empty())
+        stateHash.Serialize(ser);
+    ser.PushVarSize(entries.size());
+    const AsyncChecksum* lastChecksum = nullptr;
+    for(const Entry& entry : entries)
+    {
+        ser.PushUnsignedChar(entry.player);
+        // Checksums of all players are equal unless there is an async, so only send changes
+        const bool isSameChecksum = lastChecksum && *lastChecksum == entry.cmds.checksum;
+        ser.PushBool(isSameChecksum);
+        if(!isSameChecksum)
+            entry.cmds.checksum.Serialize(ser);
+        lastChecksum = &entry.cmds.checksum;
+
+        ser.PushVarSize(entry.cmds.gcs.size());
+        for(const gc::GameCommandPtr& gc : entry.cmds.gcs)
+            gc->Serialize(ser);
+    }
+}
+
+void GameMessage_GameCommandBatch::Deserialize(Serializer& ser)
+{
+    GameMessage::Deserialize(ser);
+    gc::Deserializer deser(ser);
+    if(deser.PopBool())
+        stateHash.Deserialize(deser);
+    else
+        stateHash = StateHash();
+    entries.resize(deser.PopVarSize());
+    for(unsigned i = 0; i < entries.size(); i++)
+    {
+        Entry& entry = entries[i];
+        entry.player = deser.PopUnsignedChar();
+        if(deser.PopBool())
+        {
+            if(i == 0)
+                throw std::runtime_error("No checksum to reuse");
+            entry.cmds.checksum = entries[i - 1].cmds.checksum;
+        } else
+            entry.cmds.checksum.Deserialize(deser);
+
+        entry.cmds.gcs.resize(deser.PopVarSize());
+        for(gc::GameCommandPtr& gc : entry.cmds.gcs)
+            gc = gc::GameCommand::Deserialize(deser);
+    }
+}
+
+bool GameMessage_GameCommandBatch::Run(GameMessageInterface* callback) const
+{
+    return callback->OnGameMessage(*this);
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,6 +7,7 @@
 #include "GameCommand.h"
 #include "GameMessage.h"
 #include "PlayerGameCommands.h"
+#include "StateHash.h"
 #include <vector>
 
 class Serializer;
@@ -23,3 +24,28 @@ public:
     void Deserialize(Serializer& ser) override;
     bool Run(GameMessageInterface* callback) const override;
 };
+
+/// Game commands of multiple players in one message using a compact encoding.
+/// Sent by a client for itself and its AIs and by the server to relay all commands received at once
+class GameMessage_GameCommandBatch : public GameMessage
+{
+public:
+    struct Entry
+    {
+        /// Player the commands are for. In messages to the server NO_PLAYER_ID means the sender
+        uint8_t player;
+        PlayerGameCommands cmds;
+    };
+    std::vector<Entry> entries;
+    /// Detailed hash of the game state of the sender, only set every few NWFs and only in messages to the server.
+    /// Belongs to the checksum of the senders own commands
+    StateHash stateHash;
+
+    GameMessage_GameCommandBatch();
+
+    void add(uint8_t player, const AsyncChecksum& checksum, std::vector<gc::GameCommandPtr> gcs);
+
+    void Serialize(Serializer& ser) const override;
+    void Deserialize(Serializer& ser) override;
+    bool Run(GameMessageInterface* callback) const override;
+};
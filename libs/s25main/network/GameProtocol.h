@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -51,6 +51,7 @@ enum
     NMS_PAUSE,
     NMS_SKIP_TO_GF,
     NMS_SERVER_SPEED,
+    NMS_GAMECOMMANDS_BATCH,
 
     NMS_GGS_CHANGE = 0x0501, //
     NMS_REMOVE_LUA,
@@ -159,5 +160,8 @@ constexpr unsigned PING_TIMEOUT = 5 * 60;
 constexpr unsigned LOAD_TIMEOUT = 10 * 60;
 
 /// Größe eines Map-Paketes
-/// ACHTUNG: IPV4 garantiert nur maximal 576!!
-constexpr unsigned MAP_PART_SIZE = 512;
+/// Sent over TCP, so this is not limited by the datagram size.
+/// Bigger parts reduce the message overhead and the number of frames required to transfer a map
+constexpr unsigned MAP_PART_SIZE = 32 * 1024;
+/// Suggested number of NWFs between adding the detailed state hash to the checksum when it is enabled for debugging
+constexpr unsigned STATE_HASH_INTERVAL = 10;
@@ -38,6 +38,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/nowide/convert.hpp>
 #include <boost/nowide/fstream.hpp>
+#include <algorithm>
 #include <helpers/chronoIO.h>
 #include <iomanip>
 #include <iterator>
@@ -107,6 +108,13 @@ GameServer::~GameServer()
     Stop();
 }
 
+void GameServer::SetRunSettings(const RunSettings& settings)
+{
+    RTTR_Assert(settings.cmdDelay >= 1u);
+    RTTR_Assert(settings.mapBytesPerSecond > 0u);
+    runSettings = settings;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Spiel hosten
 bool GameServer::Start(const CreateServerInfo& csi, const MapDescription& map, const std::string& hostPw)
@@ -301,19 +309,62 @@ void GameServer::Run()
             continue;
         player.executeMsgs(*this);
     }
+    // Relay all commands received in this run at once
+    SendPendingGameCommands();
     // Send afterwards as most messages are relayed which should be done as fast as possible
     for(GameServerPlayer& player : networkPlayers)
     {
         // Ignore kicked players
         if(!player.socket.isValid())
             continue;
-        player.sendMsgs(10);
+        player.sendMsgs(runSettings.maxMsgsPerRun);
     }
     helpers::erase_if(networkPlayers, [](const auto& player) { return !player.socket.isValid(); });
 
     lanAnnouncer.Run();
 }
 
+std::chrono::milliseconds GameServer::GetTimeToNextFrame() const
+{
+    using std::chrono::milliseconds;
+    // The countdown is updated once per second
+    if(state == ServerState::Config && countdown.IsActive())
+        return milliseconds(100);
+    if(state != ServerState::Game || framesinfo.isPaused)
+        return milliseconds::max();
+    if(skiptogf > currentGF)
+        return milliseconds(0);
+    const auto passedTime = FramesInfo::UsedClock::now() - framesinfo.lastTime;
+    if(passedTime >= framesinfo.gf_length)
+        return milliseconds(0);
+    return std::chrono::duration_cast<milliseconds>(framesinfo.gf_length - passedTime);
+}
+
+bool GameServer::WaitForEvents(std::chrono::milliseconds maxWait)
+{
+    if(state == ServerState::Stopped)
+        return false;
+    for(const GameServerPlayer& player : networkPlayers)
+    {
+        // Still something to send -> Don't wait
+        if(player.socket.isValid() && !player.sendQueue.empty())
+            return true;
+    }
+    const std::chrono::milliseconds timeToNextFrame = GetTimeToNextFrame();
+    if(timeToNextFrame <= std::chrono::milliseconds::zero())
+        return true;
+
+    SocketSet set;
+    if(state == ServerState::Config)
+        set.Add(serversocket);
+    for(const GameServerPlayer& player : networkPlayers)
+        set.Add(player.socket);
+    if(set.Select(static_cast<int>(std::min(maxWait, timeToNextFrame).count()), 0) > 0)
+        return true;
+    // Woken up for the next frame
+    return timeToNextFrame <= maxWait;
+}
+
 void GameServer::RunStateConfig()
 {
     WaitForClients();
@@ -356,10 +407,9 @@ void GameServer::RunStateLoading()
     {
         for(const NWFPlayerInfo& player : nwfInfo.getPlayerInfos())
         {
-            GameMessage_GameCommand msg(player.id, nwfInfo.getPlayerCmds(player.id).checksum,
-                                        std::vector<gc::GameCommandPtr>());
-            SendToAll(msg);
-            nwfInfo.addPlayerCmds(player.id, msg.cmds);
+            const PlayerGameCommands cmds(nwfInfo.getPlayerCmds(player.id).checksum, {});
+            pendingGameCommands.push_back({static_cast<uint8_t>(player.id), cmds});
+            nwfInfo.addPlayerCmds(player.id, cmds);
         }
     }
 
@@ -398,6 +448,7 @@ void GameServer::Stop()
     networkPlayers.clear();
 
     // aufräumen
+    pendingGameCommands.clear();
     framesinfo.Clear();
     config.Clear();
     mapinfo.Clear();
@@ -538,7 +589,7 @@ bool GameServer::StartGame()
     else
         random_init = static_cast<unsigned>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
 
-    nwfInfo.init(currentGF, 3);
+    nwfInfo.init(currentGF, runSettings.cmdDelay);
 
     // Send start first, then load the rest
     SendToAll(GameMessage_Server_Start(random_init, nwfInfo.getNextNWF(), nwfInfo.getCmdDelay()));
@@ -558,7 +609,8 @@ bool GameServer::StartGame()
     framesinfo.gfLengthReq = framesinfo.gf_length = SPEED_GF_LENGTHS[ggs_.speed];
 
     // NetworkFrame-Länge bestimmen, je schlechter (also höher) die Pings, desto länger auch die Framelänge
-    framesinfo.nwf_length = CalcNWFLenght(FramesInfo::milliseconds32_t(highest_ping));
+    framesinfo.nwf_length =
+      CalcNWFLenght(std::max(FramesInfo::milliseconds32_t(highest_ping), runSettings.minNWFDuration));
 
     LOG.write("SERVER: Using gameframe length of %1%\n") % helpers::withUnit(framesinfo.gf_length);
     LOG.write("SERVER: Using networkframe length of %1% GFs (%2%)\n") % framesinfo.nwf_length
@@ -600,6 +652,8 @@ void GameServer::SendNWFDone(const NWFServerInfo& info)
 
 void GameServer::SendToAll(const GameMessage& msg)
 {
+    // Keep the order of relayed commands and other messages
+    SendPendingGameCommands();
     for(GameServerPlayer& player : networkPlayers)
     {
         // ist der Slot Belegt, dann Nachricht senden
@@ -770,12 +824,16 @@ bool GameServer::CheckForAsync()
     for(const GameServerPlayer& player : networkPlayers)
     {
         const AsyncChecksum& curChecksum = nwfInfo.getPlayerCmds(player.playerId).checksum;
+        // Only set every few NWFs but can detect an async before it affects the other checksums
+        const std::string stateDifference = curChecksum.stateHash.describeDifference(refChecksum.stateHash);
 
         // Checksummen nicht gleich?
-        if(curChecksum != refChecksum)
+        if(curChecksum != refChecksum || !stateDifference.empty())
         {
             LOG.write(_("Async at GF %1% of player %2% vs %3%. Checksums:\n%4%\n%5%\n\n")) % currentGF % player.playerId
               % networkPlayers.front().playerId % curChecksum % refChecksum;
+            if(!stateDifference.empty())
+                LOG.write("First difference in the game state: %1%\n") % stateDifference;
             isAsync = true;
         }
     }
@@ -1183,9 +1241,9 @@ bool GameServer::OnGameMessage(const GameMessage_MapRequest& msg)
             curPos += chunkSize;
             remainingSize -= chunkSize;
         }
-        // estimate time. max 60 chunks/s (currently limited by framerate), assume 50 (~25kb/s)
-        auto numChunks = (mapinfo.mapData.data.size() + mapinfo.luaData.data.size()) / MAP_PART_SIZE;
-        player->setMapSending(std::chrono::seconds(numChunks / 50 + 1));
+        // estimate time. Inside the client this is limited by the framerate
+        const auto numBytes = mapinfo.mapData.data.size() + mapinfo.luaData.data.size();
+        player->setMapSending(std::chrono::seconds(numBytes / runSettings.mapBytesPerSecond + 1));
     }
     return true;
 }
@@ -1259,24 +1317,60 @@ bool GameServer::OnGameMessage(const GameMessage_Speed& msg)
 
 bool GameServer::OnGameMessage(const GameMessage_GameCommand& msg)
 {
-    int targetPlayerId = GetTargetPlayer(msg);
+    AddGameCommands(msg.senderPlayerID, GetTargetPlayer(msg), msg.cmds);
+    return true;
+}
+
+bool GameServer::OnGameMessage(const GameMessage_GameCommandBatch& msg)
+{
+    for(const GameMessage_GameCommandBatch::Entry& entry : msg.entries)
+    {
+        const int targetPlayerId = GetTargetPlayer(entry.player, msg.senderPlayerID);
+        bool added;
+        if(targetPlayerId == msg.senderPlayerID && !msg.stateHash.empty())
+        {
+            // Keep the state hash with the senders checksum for CheckForAsync
+            PlayerGameCommands cmds = entry.cmds;
+            cmds.checksum.stateHash = msg.stateHash;
+            added = AddGameCommands(msg.senderPlayerID, targetPlayerId, cmds);
+        } else
+            added = AddGameCommands(msg.senderPlayerID, targetPlayerId, entry.cmds);
+        if(!added)
+            break;
+    }
+    return true;
+}
+
+bool GameServer::AddGameCommands(uint8_t senderPlayerId, int targetPlayerId, const PlayerGameCommands& cmds)
+{
     if((state != ServerState::Game && state != ServerState::Loading) || targetPlayerId < 0
-       || (state == ServerState::Loading && !msg.cmds.gcs.empty()))
+       || (state == ServerState::Loading && !cmds.gcs.empty()))
     {
-        KickPlayer(msg.senderPlayerID, KickReason::InvalidMsg, __LINE__);
-        return true;
+        KickPlayer(senderPlayerId, KickReason::InvalidMsg, __LINE__);
+        return false;
     }
 
-    if(!nwfInfo.addPlayerCmds(targetPlayerId, msg.cmds))
+    if(!nwfInfo.addPlayerCmds(targetPlayerId, cmds))
         return true; // Ignore
     GameServerPlayer* player = GetNetworkPlayer(targetPlayerId);
     if(player)
         player->setNotLagging();
-    SendToAll(GameMessage_GameCommand(targetPlayerId, msg.cmds.checksum, msg.cmds.gcs));
-
+    pendingGameCommands.push_back({static_cast<uint8_t>(targetPlayerId), cmds});
+    // Only required for CheckForAsync, the other players don't need it
+    pendingGameCommands.back().cmds.checksum.stateHash = StateHash();
     return true;
 }
 
+void GameServer::SendPendingGameCommands()
+{
+    if(pendingGameCommands.empty())
+        return;
+    GameMessage_GameCommandBatch msg;
+    // Take them out first as SendToAll sends pending commands
+    std::swap(msg.entries, pendingGameCommands);
+    SendToAll(msg);
+}
+
 bool GameServer::OnGameMessage(const GameMessage_AsyncLog& msg)
 {
     if(state != ServerState::Game)
@@ -1740,14 +1834,19 @@ bool GameServer::IsHost(unsigned playerIdx) const
 
 int GameServer::GetTargetPlayer(const GameMessageWithPlayer& msg)
 {
-    if(msg.player != 0xFF)
+    return GetTargetPlayer(msg.player, msg.senderPlayerID);
+}
+
+int GameServer::GetTargetPlayer(uint8_t player, uint8_t senderPlayerId)
+{
+    if(player != 0xFF)
     {
-        if(msg.player < playerInfos.size() && (msg.player == msg.senderPlayerID || IsHost(msg.senderPlayerID)))
+        if(player < playerInfos.size() && (player == senderPlayerId || IsHost(senderPlayerId)))
         {
-            GameServerPlayer* networkPlayer = GetNetworkPlayer(msg.senderPlayerID);
+            GameServerPlayer* networkPlayer = GetNetworkPlayer(senderPlayerId);
             if(networkPlayer->isActive())
-                return msg.player;
-            unsigned result = msg.player;
+                return player;
+            unsigned result = player;
             // Apply pending swaps
             for(auto& pSwap : networkPlayer->getPendingSwaps()) //-V522
             {
@@ -1758,7 +1857,7 @@ int GameServer::GetTargetPlayer(const GameMessageWithPlayer& msg)
             }
             return result;
         }
-    } else if(msg.senderPlayerID < playerInfos.size())
-        return msg.senderPlayerID;
+    } else if(senderPlayerId < playerInfos.size())
+        return senderPlayerId;
     return -1;
 }
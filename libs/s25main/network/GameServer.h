@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,6 +6,7 @@
 
 #include "FramesInfo.h"
 #include "GameMessageInterface.h"
+#include "GameMessage_GameCommand.h"
 #include "GameProtocol.h"
 #include "GlobalGameSettings.h"
 #include "JoinPlayerInfo.h"
@@ -22,7 +23,6 @@
 struct CreateServerInfo;
 class GameMessage;
 class GameMessageWithPlayer;
-class GameMessage_GameCommand;
 class GameServerPlayer;
 struct AIServerPlayer;
 
@@ -35,13 +35,40 @@ public:
     static constexpr unsigned Longevity = 6;
     using SteadyClock = std::chrono::steady_clock;
 
+    /// Settings controlling how the server is driven. The defaults match a server running inside the clients frame loop
+    struct RunSettings
+    {
+        /// Maximum number of messages sent to each player per call to Run. Negative means unlimited
+        int maxMsgsPerRun = 10;
+        /// Number of NWFs commands are sent in advance (>= 1)
+        unsigned cmdDelay = 3;
+        /// Minimum duration of a NWF. The actual length is the maximum of this and the highest ping
+        FramesInfo::milliseconds32_t minNWFDuration{0};
+        /// Minimum assumed transfer rate (bytes/s) of the map. Used for the timeout while sending the map
+        unsigned mapBytesPerSecond = 25 * 1024;
+    };
+
     GameServer();
     ~GameServer();
 
+    /// Set the run settings. Changes to the NWF handling only take effect on the next game start
+    void SetRunSettings(const RunSettings& settings);
+    const RunSettings& GetRunSettings() const { return runSettings; }
+
     /// Starts the server
     bool Start(const CreateServerInfo& csi, const MapDescription& map, const std::string& hostPw);
 
     void Run();
+    /// Block until there is data on any socket, a message needs to be sent or the next GF is due.
+    /// Waits at most maxWait. Used when the server runs in its own loop instead of the clients frame loop.
+    /// Return false if nothing happened till then
+    bool WaitForEvents(std::chrono::milliseconds maxWait);
+    /// Time until the server needs to be run again, ignoring network events
+    std::chrono::milliseconds GetTimeToNextFrame() const;
+
+    bool IsRunning() const { return state != ServerState::Stopped; }
+    bool IsInGame() const { return state == ServerState::Game || state == ServerState::Loading; }
+    unsigned GetNumConnectedPlayers() const { return networkPlayers.size(); }
 
     void RunStateGame();
 
@@ -63,6 +90,10 @@ private:
 
     void SendToAll(const GameMessage& msg);
     void SendNWFDone(const NWFServerInfo& info);
+    /// Send all commands received since the last call to all players in one message
+    void SendPendingGameCommands();
+    /// Add the commands received from the sender for the target player. Return false if the sender was kicked
+    bool AddGameCommands(uint8_t senderPlayerId, int targetPlayerId, const PlayerGameCommands& cmds);
 
     /// Kick a player (free slot and set socket to invalid. Does NOT remove it from NetworkPlayers)
     void KickPlayer(uint8_t playerId, KickReason cause, uint32_t param);
@@ -98,6 +129,7 @@ private:
     bool OnGameMessage(const GameMessage_MapRequest& msg) override;
     bool OnGameMessage(const GameMessage_Map_Checksum& msg) override;
     bool OnGameMessage(const GameMessage_GameCommand& msg) override;
+    bool OnGameMessage(const GameMessage_GameCommandBatch& msg) override;
     bool OnGameMessage(const GameMessage_Speed& msg) override;
     bool OnGameMessage(const GameMessage_AsyncLog& msg) override;
     bool OnGameMessage(const GameMessage_RemoveLua& msg) override;
@@ -133,6 +165,7 @@ private:
     bool IsHost(unsigned playerIdx) const;
     /// Get the player this message concerns. which is msg.player, msg.senderPlayer or -1 on error/wrong values
     int GetTargetPlayer(const GameMessageWithPlayer& msg);
+    int GetTargetPlayer(uint8_t player, uint8_t senderPlayerId);
 
     unsigned skiptogf;
 
@@ -165,6 +198,8 @@ private:
     std::vector<JoinPlayerInfo> playerInfos;
     std::vector<GameServerPlayer> networkPlayers;
     NWFInfo nwfInfo;
+    /// Commands received but not yet relayed to the players
+    std::vector<GameMessage_GameCommandBatch::Entry> pendingGameCommands;
     GlobalGameSettings ggs_;
 
     /// der Spielstartcountdown
@@ -192,6 +227,7 @@ private:
     std::chrono::steady_clock::time_point loadStartTime;
 
     LANDiscoveryService lanAnnouncer;
+    RunSettings runSettings;
     void RunStateLoading();
 };
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -307,7 +307,7 @@ void noFlag::Capture(const unsigned char new_owner)
 
     // Unregister this flag in the players flags
     world->GetPlayer(player).FlagDestroyed(this);
-    this->player = new_owner;
+    SetPlayer(new_owner);
 }
 
 /**
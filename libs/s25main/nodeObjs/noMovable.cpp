@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -44,7 +44,7 @@ void noMovable::Walk()
     moving = false;
     const MapPoint oldPos = pos;
     pos = world->GetNeighbour(pos, curMoveDir);
-    world->AddFigure(pos, world->RemoveFigure(oldPos, *this));
+    world->MoveFigure(oldPos, pos, *this);
 }
 
 void noMovable::FaceDir(Direction newDir)
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,15 +7,15 @@
 #include "GamePlayer.h"
 #include "RoadSegment.h"
 #include "SerializedGameData.h"
+#include "pathfinding/RoadPathFinder.h"
 #include "world/GameWorld.h"
 #include "s25util/warningSuppression.h"
 
 noRoadNode::noRoadNode(const NodalObjectType nop, const MapPoint pos, const unsigned char player)
-    : noCoordBase(nop, pos), player(player)
+    : noCoordBase(nop, pos), player(player), roadNodeIdx_(world->GetPlayer(player).AddRoadNode())
 {
     for(const auto dir : helpers::EnumRange<Direction>{})
         routes[dir] = nullptr;
-    last_visit = 0;
 }
 
 noRoadNode::~noRoadNode() = default;
@@ -23,6 +23,7 @@ noRoadNode::~noRoadNode() = default;
 void noRoadNode::Destroy()
 {
     DestroyAllRoads();
+    world->GetPlayer(player).RemoveRoadNode(roadNodeIdx_);
     noCoordBase::Destroy();
 }
 
@@ -53,14 +54,27 @@ void noRoadNode::Serialize(SerializedGameData& sgd) const
 }
 
 noRoadNode::noRoadNode(SerializedGameData& sgd, const unsigned obj_id)
-    : noCoordBase(sgd, obj_id), player(sgd.PopUnsignedChar())
+    : noCoordBase(sgd, obj_id), player(sgd.PopUnsignedChar()), roadNodeIdx_(world->GetPlayer(player).AddRoadNode())
 {
     for(const auto dir : helpers::EnumRange<Direction>{})
     {
         routes[dir] = sgd.PopObject<RoadSegment>(GO_Type::Roadsegment);
     }
+}
 
-    last_visit = 0;
+void noRoadNode::SetPlayer(const unsigned char newPlayer)
+{
+    world->GetPlayer(player).RemoveRoadNode(roadNodeIdx_);
+    player = newPlayer;
+    roadNodeIdx_ = world->GetPlayer(player).AddRoadNode();
+    // Cached paths from or to this node are no longer valid for the new owner
+    world->GetRoadPathFinder().RoadNetworkChanged();
+}
+
+void noRoadNode::SetRoute(const Direction dir, RoadSegment* route)
+{
+    routes[dir] = route;
+    world->GetRoadPathFinder().RoadNetworkChanged();
 }
 
 void noRoadNode::UpgradeRoad(const Direction dir) const
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -19,22 +19,15 @@ class noRoadNode : public noCoordBase
 protected:
     unsigned char player;
 
+    /// Hand this node over to another player
+    void SetPlayer(unsigned char newPlayer);
+
 private:
+    /// Index of this node among the road nodes of the player, see GamePlayer::AddRoadNode
+    unsigned roadNodeIdx_;
     helpers::EnumArray<RoadSegment*, Direction> routes;
 
 public:
-    // For Pathfinding
-    // cost from start
-    mutable unsigned cost; //-V730_NOINIT
-    // distance to target
-    mutable unsigned targetDistance; //-V730_NOINIT
-    // estimated total distance (cost + distance)
-    mutable unsigned estimate; //-V730_NOINIT
-    mutable unsigned last_visit;
-    mutable const noRoadNode* prev; //-V730_NOINIT
-    /// Direction to previous node, includes SHIP_DIR
-    mutable RoadPathDirection dir_; //-V730_NOINIT
-
     noRoadNode(NodalObjectType nop, MapPoint pos, unsigned char player);
     noRoadNode(SerializedGameData& sgd, unsigned obj_id);
     noRoadNode(const noRoadNode&) = delete;
@@ -44,7 +37,7 @@ public:
     void Serialize(SerializedGameData& sgd) const override;
 
     RoadSegment* GetRoute(const Direction dir) const { return routes[dir]; }
-    void SetRoute(const Direction dir, RoadSegment* route) { routes[dir] = route; }
+    void SetRoute(Direction dir, RoadSegment* route);
     const auto& getRoutes() const { return routes; }
     noRoadNode* GetNeighbour(Direction dir) const;
 
@@ -54,6 +47,8 @@ public:
     void DestroyAllRoads();
 
     unsigned char GetPlayer() const { return player; }
+    /// Dense index of this node among the road nodes of its owner, below GamePlayer::GetNumRoadNodeIndices
+    unsigned GetRoadNodeIdx() const { return roadNodeIdx_; }
 
     /// Legt eine Ware am Objekt ab (an allen Straßenknoten (Gebäude, Baustellen und Flaggen) kann man Waren ablegen
     virtual void AddWare(std::unique_ptr<Ware> ware) = 0;
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -14,14 +14,33 @@
 #include <memory>
 #include <utility>
 
-static bool isSizeGreater(glSmartBitmap* a, glSmartBitmap* b)
+namespace {
+/// Size of a BGRA pixel
+constexpr unsigned bytesPerPixel = 4;
+
+/// Set the texture coordinates of the bitmap drawn at the given position of the texture
+void setTexCoords(glSmartBitmap& bmp, const Extent& pos, const Extent& texSize, const PointF& bufferSize)
 {
-    const Extent sizeA = a->getRequiredTexSize();
-    const Extent sizeB = b->getRequiredTexSize();
-    return (sizeA.x * sizeA.y) > (sizeB.x * sizeB.y);
+    Extent curSize(texSize);
+    if(bmp.isPlayer())
+        curSize.x /= 2;
+
+    bmp.texCoords[0] = pos / bufferSize;
+    bmp.texCoords[2] = (pos + curSize) / bufferSize;
+    bmp.texCoords[1] = {bmp.texCoords[0].x, bmp.texCoords[2].y};
+    bmp.texCoords[3] = {bmp.texCoords[2].x, bmp.texCoords[0].y};
+
+    if(bmp.isPlayer())
+    {
+        bmp.texCoords[4] = bmp.texCoords[3];
+        bmp.texCoords[6] = (pos + texSize) / bufferSize;
+        bmp.texCoords[5] = {bmp.texCoords[4].x, bmp.texCoords[6].y};
+        bmp.texCoords[7] = {bmp.texCoords[6].x, bmp.texCoords[4].y};
+    }
 }
+} // namespace
 
-bool glTexturePacker::packHelper(std::vector<glSmartBitmap*>& list)
+bool glTexturePacker::packHelper(std::vector<SizedItem>& list, AssetCache::Writer* packedData)
 {
     glTexture texture;
 
@@ -31,12 +50,11 @@ bool glTexturePacker::packHelper(std::vector<glSmartBitmap*>& list)
     // find space needed in total and biggest texture to store (as a start)
     Extent maxBmpSize(0, 0);
     unsigned total = 0;
-    for(glSmartBitmap* bmp : list)
+    for(const SizedItem& item : list)
     {
-        Extent texSize = bmp->getRequiredTexSize();
-        maxBmpSize = elMax(maxBmpSize, texSize);
+        maxBmpSize = elMax(maxBmpSize, item.texSize);
 
-        total += texSize.x * texSize.y;
+        total += item.texSize.x * item.texSize.y;
     }
 
     // most cards work much better with texture sizes of powers of two.
@@ -49,6 +67,9 @@ bool glTexturePacker::packHelper(std::vector<glSmartBitmap*>& list)
     bool maxTex = false;
     std::vector<glTexturePackerNode*> tmpVec;
     tmpVec.reserve(list.size());
+    // Positions of the items in the current texture, only images that fit are drawn
+    std::vector<std::pair<const SizedItem*, Extent>> placed;
+    placed.reserve(list.size());
 
     Extent curSize = maxBmpSize;
     do
@@ -60,50 +81,68 @@ bool glTexturePacker::packHelper(std::vector<glSmartBitmap*>& list)
             auto root = std::make_unique<glTexturePackerNode>(curSize);
 
             // list to store bitmaps we could not fit in our current texture
-            std::vector<glSmartBitmap*> left;
-
-            libsiedler2::PixelBufferBGRA buffer(curSize.x, curSize.y);
+            std::vector<SizedItem> left;
+            placed.clear();
 
-            // try storing bitmaps in the big texture
-            for(glSmartBitmap* bmp : list)
+            // try storing bitmaps in the big texture. Only the layout is calculated here
+            for(const SizedItem& item : list)
             {
-                if(!root->insert(bmp, buffer, tmpVec))
+                Extent pos;
+                if(root->insert(item.texSize, pos, tmpVec))
+                    placed.emplace_back(&item, pos);
+                else
                 {
                     // inserting this bitmap failed? just remember it for next texture
-                    left.push_back(bmp);
-                } else
-                {
-                    // tell or glSmartBitmap, that it uses a shared texture (so it won't try to delete/free it)
-                    bmp->setSharedTexture(texture.get());
+                    left.push_back(item);
                 }
             }
-            if((false))
-            {
-                bfs::path outFilepath = std::to_string(texture.get()) + "-" + std::to_string(curSize.x) + "x"
-                                        + std::to_string(curSize.y) + ".bmp";
-                saveBitmap(buffer, outFilepath);
-            }
             // free texture packer, as it is not needed any more
             root->destroy(list.size());
             root.reset();
 
-            if(!texture.uploadData(buffer))
-                return false;
-
-            if(left.empty()) // nothing left, just generate texture and return success
-            {
-                textures.emplace_back(std::move(texture));
-                return true;
-            } else if(maxTex) // maximum texture size reached and something still left
+            // our pre-estimated size if the big texture was not enough for the algorithm to fit all textures in
+            // try again with an increased big texture
+            if(left.empty() || maxTex)
             {
+                libsiedler2::PixelBufferBGRA buffer(curSize.x, curSize.y);
+                const PointF bufferSize(curSize);
+                for(const auto& itemAndPos : placed)
+                {
+                    glSmartBitmap& bmp = *itemAndPos.first->bmp;
+                    bmp.drawTo(buffer, itemAndPos.second);
+                    setTexCoords(bmp, itemAndPos.second, itemAndPos.first->texSize, bufferSize);
+                    // tell or glSmartBitmap, that it uses a shared texture (so it won't try to delete/free it)
+                    bmp.setSharedTexture(texture.get());
+                }
+                if(packedData)
+                {
+                    packedData->push<uint8_t>(1);
+                    packedData->push(curSize);
+                    packedData->push<uint32_t>(placed.size());
+                    for(const auto& itemAndPos : placed)
+                    {
+                        packedData->push<uint32_t>(itemAndPos.first->idx);
+                        packedData->push(itemAndPos.second);
+                    }
+                    packedData->pushRaw(buffer.getPixelPtr(), curSize.x * curSize.y * bytesPerPixel);
+                }
+                if((false))
+                {
+                    bfs::path outFilepath = std::to_string(texture.get()) + "-" + std::to_string(curSize.x) + "x"
+                                            + std::to_string(curSize.y) + ".bmp";
+                    saveBitmap(buffer, outFilepath);
+                }
+
+                if(!texture.uploadData(buffer))
+                    return false;
+
                 textures.emplace_back(std::move(texture));
+                if(left.empty()) // nothing left, just generate texture and return success
+                    return true;
+                // maximum texture size reached and something still left
                 // recursively generate textures for what is left
-                return packHelper(left);
+                return packHelper(left, packedData);
             }
-
-            // our pre-estimated size if the big texture was not enough for the algorithm to fit all textures in
-            // delete buffer and try again with an increased big texture
-            left.clear();
         }
 
         // increase width or height, try whether opengl is able to handle textures that big
@@ -116,20 +155,94 @@ bool glTexturePacker::packHelper(std::vector<glSmartBitmap*>& list)
     } while(true);
 }
 
-bool glTexturePacker::pack()
+bool glTexturePacker::pack(AssetCache::Writer* packedData)
 {
-    helpers::sort(items, isSizeGreater);
+    std::vector<SizedItem> sizedItems;
+    sizedItems.reserve(items.size());
+    for(glSmartBitmap* bmp : items)
+        sizedItems.push_back(SizedItem{bmp, bmp->getRequiredTexSize(), static_cast<unsigned>(sizedItems.size())});
+    if(packedData)
+    {
+        // Sizes of the items to detect changes when loading
+        packedData->push<uint32_t>(sizedItems.size());
+        for(const SizedItem& item : sizedItems)
+            packedData->push(item.texSize);
+    }
+    helpers::sort(sizedItems, [](const SizedItem& a, const SizedItem& b) {
+        return (a.texSize.x * a.texSize.y) > (b.texSize.x * b.texSize.y);
+    });
 
-    if(packHelper(items))
+    if(packHelper(sizedItems, packedData))
+    {
+        if(packedData)
+            packedData->push<uint8_t>(0);
         return true;
+    }
 
+    reset();
+    return false;
+}
+
+bool glTexturePacker::loadPacked(AssetCache::Reader packedData)
+{
+    try
+    {
+        if(packedData.pop<uint32_t>() != items.size())
+            return false;
+        std::vector<Extent> texSizes;
+        texSizes.reserve(items.size());
+        for(const glSmartBitmap* bmp : items)
+        {
+            texSizes.push_back(packedData.pop<Extent>());
+            if(texSizes.back() != bmp->getRequiredTexSize())
+                return false;
+        }
+
+        while(packedData.pop<uint8_t>())
+        {
+            const auto texSize = packedData.pop<Extent>();
+            glTexture texture;
+            if(!texture || !texture.checkSize(texSize))
+            {
+                reset();
+                return false;
+            }
+            const PointF bufferSize(texSize);
+            const auto numPlaced = packedData.pop<uint32_t>();
+            for(unsigned i = 0; i < numPlaced; i++)
+            {
+                const auto idx = packedData.pop<uint32_t>();
+                const auto pos = packedData.pop<Extent>();
+                if(idx >= items.size())
+                {
+                    reset();
+                    return false;
+                }
+                setTexCoords(*items[idx], pos, texSizes[idx], bufferSize);
+                items[idx]->setSharedTexture(texture.get());
+            }
+            if(!texture.uploadData(texSize, packedData.popRaw(texSize.x * texSize.y * bytesPerPixel)))
+            {
+                reset();
+                return false;
+            }
+            textures.emplace_back(std::move(texture));
+        }
+    } catch(const std::runtime_error&)
+    {
+        reset();
+        return false;
+    }
+    return true;
+}
+
+void glTexturePacker::reset()
+{
     // reset glSmartBitmap textures
     for(glSmartBitmap* bmp : items)
         bmp->setSharedTexture(0);
 
     textures.clear();
-
-    return false;
 }
 
 glTexture::glTexture() : handle(VIDEODRIVER.GenerateTexture()), size(0, 0)
@@ -176,13 +289,17 @@ bool glTexture::checkSize(const Extent& size) const
 }
 
 bool glTexture::uploadData(const libsiedler2::PixelBufferBGRA& buffer)
+{
+    return uploadData(Extent(buffer.getWidth(), buffer.getHeight()), buffer.getPixelPtr());
+}
+
+bool glTexture::uploadData(const Extent& newSize, const void* pixels)
 {
     if(!handle)
         return false;
     VIDEODRIVER.BindTexture(handle);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, buffer.getWidth(), buffer.getHeight(), 0, GL_BGRA, GL_UNSIGNED_BYTE,
-                 buffer.getPixelPtr());
-    size = Extent(buffer.getWidth(), buffer.getHeight());
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, newSize.x, newSize.y, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
+    size = newSize;
     int resultWidth;
     glGetTexLevelParameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &resultWidth);
     return resultWidth > 0;
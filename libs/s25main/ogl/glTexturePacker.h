@@ -1,10 +1,11 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include "Point.h"
+#include "resources/AssetCache.h"
 #include <vector>
 
 class glSmartBitmap;
@@ -33,18 +34,35 @@ public:
     void bind() const;
     bool checkSize(const Extent&) const;
     bool uploadData(const libsiedler2::PixelBufferBGRA&);
+    /// Upload BGRA pixel data of the given size
+    bool uploadData(const Extent& size, const void* pixels);
 };
 
 class glTexturePacker
 {
 private:
+    /// Bitmap with its required size, which is queried only once
+    struct SizedItem
+    {
+        glSmartBitmap* bmp;
+        Extent texSize;
+        /// Index in items
+        unsigned idx;
+    };
+
     std::vector<glTexture> textures;
     std::vector<glSmartBitmap*> items;
 
-    bool packHelper(std::vector<glSmartBitmap*>& list);
+    bool packHelper(std::vector<SizedItem>& list, AssetCache::Writer* packedData);
+    /// Reset the textures of all items and remove the packed textures
+    void reset();
 
 public:
-    bool pack();
+    /// Pack all items into shared textures.
+    /// If packedData is given, the layout and the pixel data are written to it to be restored by loadPacked
+    bool pack(AssetCache::Writer* packedData = nullptr);
+    /// Restore the textures written by pack for the same items. Returns false if the data does not match the items
+    bool loadPacked(AssetCache::Reader packedData);
     void add(glSmartBitmap& bmp) { items.push_back(&bmp); }
     const auto& getTextures() const { return textures; }
 };
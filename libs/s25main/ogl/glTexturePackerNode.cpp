@@ -1,20 +1,15 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "glTexturePackerNode.h"
-#include "ogl/glSmartBitmap.h"
-#include "libsiedler2/PixelBufferBGRA.h"
 
-bool glTexturePackerNode::insert(glSmartBitmap* b, libsiedler2::PixelBufferBGRA& buffer,
-                                 std::vector<glTexturePackerNode*>& todo)
+bool glTexturePackerNode::insert(const Extent& texSize, Extent& placedPos, std::vector<glTexturePackerNode*>& todo)
 {
     todo.clear();
 
     todo.push_back(this);
 
-    const Extent texSize = b->getRequiredTexSize();
-
     while(!todo.empty())
     {
         glTexturePackerNode* current = todo.back();
@@ -28,7 +23,7 @@ bool glTexturePackerNode::insert(glSmartBitmap* b, libsiedler2::PixelBufferBGRA&
         }
 
         // we are a leaf and do already contain an image
-        if(current->bmp)
+        if(current->used)
             continue;
 
         // no space left for this item
@@ -37,26 +32,8 @@ bool glTexturePackerNode::insert(glSmartBitmap* b, libsiedler2::PixelBufferBGRA&
 
         if(texSize == current->size)
         {
-            b->drawTo(buffer, current->pos);
-            current->bmp = b;
-
-            const PointF bufferSize(buffer.getWidth(), buffer.getHeight());
-            Extent currentSize(current->size);
-            if(b->isPlayer())
-                currentSize.x /= 2;
-
-            b->texCoords[0] = current->pos / bufferSize;
-            b->texCoords[2] = (current->pos + currentSize) / bufferSize;
-            b->texCoords[1] = {b->texCoords[0].x, b->texCoords[2].y};
-            b->texCoords[3] = {b->texCoords[2].x, b->texCoords[0].y};
-
-            if(b->isPlayer())
-            {
-                b->texCoords[4] = b->texCoords[3];
-                b->texCoords[6] = (current->pos + current->size) / bufferSize;
-                b->texCoords[5] = {b->texCoords[4].x, b->texCoords[6].y};
-                b->texCoords[7] = {b->texCoords[6].x, b->texCoords[4].y};
-            }
+            current->used = true;
+            placedPos = current->pos;
             return true;
         }
 
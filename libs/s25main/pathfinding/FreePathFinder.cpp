@@ -1,8 +1,9 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "pathfinding/FreePathFinder.h"
+#include "AllocationStatistics.h"
 #include "EventManager.h"
 #include "RttrForeachPt.h"
 #include "helpers/containerUtils.h"
@@ -39,6 +40,11 @@ void FreePathFinder::Init(const MapExtent& mapSize)
     }
 }
 
+Direction FreePathFinder::GetStartDir(const MapPoint start, const bool randomRoute) const
+{
+    return randomRoute ? convertToDirection(gwb_.GetIdx(start) * gwb_.GetEvMgr().GetCurrentGF()) : Direction::West;
+}
+
 void FreePathFinder::IncreaseCurrentVisit()
 {
     // if the counter reaches its maxium, tidy up
@@ -82,6 +88,7 @@ bool FreePathFinder::FindPathAlternatingConditions(const MapPoint start, const M
         return true;
     }
 
+    const AllocationScope allocationScope(AllocationTag::Pathfinding);
     // increase currentVisit, so we don't have to clear the visited-states at every run
     IncreaseCurrentVisit();
 
@@ -101,8 +108,7 @@ bool FreePathFinder::FindPathAlternatingConditions(const MapPoint start, const M
     // LOG.write(("pf: from %i, %i to %i, %i \n", x_start, y_start, x_dest, y_dest);
 
     // Start at random dir (so different jobs may use different roads)
-    const Direction startDir =
-      randomRoute ? convertToDirection(gwb_.GetIdx(start) * gwb_.GetEvMgr().GetCurrentGF()) : Direction::West;
+    const Direction startDir = GetStartDir(start, randomRoute);
 
     while(!todo.empty())
     {
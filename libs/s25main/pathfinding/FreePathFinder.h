@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -43,6 +43,10 @@ public:
     bool CheckRoute(MapPoint start, const std::vector<Direction>& route, unsigned pos, const TNodeChecker& nodeChecker,
                     MapPoint* dest) const;
 
+    /// Direction in which the neighbours of a node are checked first. Varies with the start point and GF for random
+    /// routes, so the same path is not always taken
+    Direction GetStartDir(MapPoint start, bool randomRoute) const;
+
 private:
     void IncreaseCurrentVisit();
 };
@@ -1,9 +1,10 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include "AllocationStatistics.h"
 #include "EventManager.h"
 #include "pathfinding/FreePathFinder.h"
 #include "pathfinding/NewNode.h"
@@ -43,6 +44,7 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
                               const TNodeChecker& nodeChecker)
 {
     RTTR_Assert(start != dest);
+    const AllocationScope allocationScope(AllocationTag::Pathfinding);
 
     // increase currentVisit, so we don't have to clear the visited-states at every run
     IncreaseCurrentVisit();
@@ -64,8 +66,7 @@ bool FreePathFinder::FindPath(const MapPoint start, const MapPoint dest, bool ra
 
     // Bei Zufälliger Richtung anfangen (damit man nicht immer denselben Weg geht, besonders für die Soldaten wichtig)
     // TODO confirm random: RANDOM.Rand(__FILE__, __LINE__, y_start * GetWidth() + x_start, 6);
-    const Direction startDir =
-      randomRoute ? convertToDirection(gwb_.GetIdx(start) * gwb_.GetEvMgr().GetCurrentGF()) : Direction::West;
+    const Direction startDir = GetStartDir(start, randomRoute);
 
     while(!todo.empty())
     {
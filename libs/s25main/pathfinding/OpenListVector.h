@@ -4,27 +4,32 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
 struct GetEstimateFromPtr
 {
     template<typename T>
-    static unsigned GetValue(T* el)
+    unsigned operator()(T* el) const
     {
         return el->estimate;
     }
 };
 
 /// A priority queue based on an unsorted vector with same interface as OpenListPrioQueue
-/// Requires a policy that returns the value on which elements should be ordered from the element
+/// Requires a functor that returns the value on which elements should be ordered from the element
 /// Note: Order of elements with same value is determined by push/pop operations
 template<class T, class T_GetOrderValue = GetEstimateFromPtr>
 class OpenListVector
 {
     std::vector<T> elements;
+    T_GetOrderValue getOrderValue;
 
 public:
-    OpenListVector() { elements.reserve(255); }
+    explicit OpenListVector(T_GetOrderValue getOrderValue = T_GetOrderValue()) : getOrderValue(std::move(getOrderValue))
+    {
+        elements.reserve(255);
+    }
 
     T pop()
     {
@@ -37,14 +42,14 @@ public:
             return best;
         }
         int bestIdx = 0;
-        unsigned bestEstimate = T_GetOrderValue::GetValue(elements.front());
+        unsigned bestEstimate = getOrderValue(elements.front());
         for(int i = 1; i < size; i++)
         {
             // Note that this check does not consider nodes with the same value
             // However this is a) correct (same estimate = same quality so no preference from the algorithm)
             // and b) still fully deterministic as the entries are NOT sorted and the insertion-extraction-pattern
             // is completely pre-determined by the graph-structur
-            const unsigned estimate = T_GetOrderValue::GetValue(elements[i]);
+            const unsigned estimate = getOrderValue(elements[i]);
             if(estimate < bestEstimate)
             {
                 bestEstimate = estimate;
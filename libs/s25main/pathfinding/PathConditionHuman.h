@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -15,13 +15,24 @@ struct PathConditionHuman : PathConditionReachable
 {
     PathConditionHuman(const World& world) : PathConditionReachable(world) {}
 
+    /// Return true if figures can walk along a road of that type (but no boat road)
+    static BOOST_FORCEINLINE bool IsUsableRoad(const PointRoad road)
+    {
+        return road != PointRoad::None && road != PointRoad::Boat;
+    }
+
+    /// Return true if figures can walk over a node with that object
+    static BOOST_FORCEINLINE bool IsPassable(const noBase* no)
+    {
+        const BlockingManner bm = no ? no->GetBM() : BlockingManner::None;
+        return bm == BlockingManner::None || bm == BlockingManner::Tree || bm == BlockingManner::Flag;
+    }
+
     // Called for every node but the start & goal and should return true, if this point is usable
     BOOST_FORCEINLINE bool IsNodeOk(const MapPoint& pt) const
     {
         // Node blocked -> Can't go there
-        const auto* no = world.GetNode(pt).obj;
-        const BlockingManner bm = no ? no->GetBM() : BlockingManner::None;
-        if(bm != BlockingManner::None && bm != BlockingManner::Tree && bm != BlockingManner::Flag)
+        if(!IsPassable(world.GetNode(pt).obj))
             return false;
         return PathConditionReachable::IsNodeOk(pt);
     }
@@ -30,8 +41,7 @@ struct PathConditionHuman : PathConditionReachable
     BOOST_FORCEINLINE bool IsEdgeOk(const MapPoint& fromPt, const Direction dir) const
     {
         // If there is a road (but no boat road) we can pass
-        const PointRoad road = world.GetPointRoad(fromPt, dir);
-        if(road != PointRoad::None && road != PointRoad::Boat)
+        if(IsUsableRoad(world.GetPointRoad(fromPt, dir)))
             return true;
 
         // Check terrain for node transition
@@ -1,36 +1,19 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "RoadPathFinder.h"
+#include "AllocationStatistics.h"
 #include "EventManager.h"
-#include "RttrForeachPt.h"
+#include "GamePlayer.h"
 #include "buildings/nobHarborBuilding.h"
-#include "pathfinding/OpenListPrioQueue.h"
-#include "pathfinding/OpenListVector.h"
 #include "world/GameWorldBase.h"
 #include "nodeObjs/noRoadNode.h"
 #include "gameData/GameConsts.h"
 #include "s25util/Log.h"
 
-/// Comparison operator for road nodes that returns true if lhs > rhs (descending order)
-struct RoadNodeComperatorGreater
-{
-    bool operator()(const noRoadNode* const lhs, const noRoadNode* const rhs) const
-    {
-        if(lhs->estimate == rhs->estimate)
-        {
-            // Use a tie-breaker to get strict ordering
-            return (lhs->GetObjId() > rhs->GetObjId());
-        }
-
-        return (lhs->estimate > rhs->estimate);
-    }
-};
-
-using QueueImpl = OpenListPrioQueue<const noRoadNode*, RoadNodeComperatorGreater>;
-using VecImpl = OpenListVector<const noRoadNode*>;
-VecImpl todo;
+/// Limit for the cached human paths. Cache is cleared when reached
+constexpr size_t MAX_CACHED_HUMAN_PATHS = 1 << 16;
 
 // Namespace with all functors usable as additional cost functors
 namespace AdditonalCosts {
@@ -99,14 +82,32 @@ struct And : private T_Func1, private T_Func2
 };
 } // namespace SegmentConstraints
 
+void RoadPathSearchState::StartSearch(const unsigned numIndices)
+{
+    // Only grow: Nodes of other players or removed nodes are never visited by this search
+    if(nodes.size() < numIndices)
+        nodes.resize(numIndices);
+    // Use a counter for the visited-states so we don't have to reset them on every invocation
+    currentVisit++;
+    // if the counter reaches its maximum, tidy up
+    if(currentVisit == std::numeric_limits<unsigned>::max())
+    {
+        for(Node& node : nodes)
+            node.lastVisit = 0;
+        currentVisit = 1;
+    }
+    todo.clear();
+    numSearches++;
+}
+
 /// Path finding on roads using A* O(n lg n)
 /// \tparam T_AdditionalCosts Cost for each road segment but the one to the goal building
 /// \tparam T_SegmentConstraints Predicate whether a road is allowed
 template<class T_AdditionalCosts, class T_SegmentConstraints>
-bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goal, const unsigned max,
-                                  const T_AdditionalCosts addCosts, const T_SegmentConstraints isSegmentAllowed,
-                                  unsigned* const length, RoadPathDirection* const firstDir,
-                                  MapPoint* const firstNodePos)
+bool RoadPathFinder::FindPathImpl(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal,
+                                  const unsigned max, const T_AdditionalCosts addCosts,
+                                  const T_SegmentConstraints isSegmentAllowed, unsigned* const length,
+                                  RoadPathDirection* const firstDir, MapPoint* const firstNodePos) const
 {
     if(&start == &goal)
     {
@@ -125,61 +126,90 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
         return true;
     }
 
+    const AllocationScope allocationScope(AllocationTag::Pathfinding);
     // If the goal is a flag (unlikely) we have no goal building
     // TODO(Replay): Change RoadPathFinder::FindPath to target flag instead of building for wares
     const noRoadNode* goalBld = (goal.GetGOT() == GO_Type::Flag) ? nullptr : &goal;
 
-    // Use a counter for the visited-states so we don't have to reset them on every invocation
-    currentVisit++;
-    // if the counter reaches its maximum, tidy up
-    if(currentVisit == std::numeric_limits<unsigned>::max())
-    {
-        RTTR_FOREACH_PT(MapPoint, gwb_.GetSize())
-        {
-            auto* const node = gwb_.GetSpecObj<noRoadNode>(pt);
-            if(node)
-                node->last_visit = 0;
-        }
-        currentVisit = 1;
-    }
+    // Roads only connect nodes of the same player, so all visited nodes are indexed by the start player
+    state.StartSearch(gwb_.GetPlayer(start.GetPlayer()).GetNumRoadNodeIndices());
+    std::vector<RoadPathSearchState::Node>& nodes = state.nodes;
+    const unsigned currentVisit = state.currentVisit;
+    auto& todo = state.todo;
 
     // Add start node
-    todo.clear();
-
     const MapPoint goalPos = goal.GetPos();
-    start.targetDistance = gwb_.CalcDistance(start.GetPos(), goalPos);
-    start.estimate = start.targetDistance;
-    start.last_visit = currentVisit;
-    start.prev = nullptr;
-    start.cost = 0;
-    start.dir_ = RoadPathDirection::None;
-
-    todo.push(&start);
+    const unsigned startIdx = start.GetRoadNodeIdx();
+    RoadPathSearchState::Node& startNode = nodes[startIdx];
+    startNode.targetDistance = gwb_.CalcDistance(start.GetPos(), goalPos);
+    startNode.estimate = startNode.targetDistance;
+    startNode.lastVisit = currentVisit;
+    startNode.prev = startIdx;
+    startNode.cost = 0;
+    startNode.dir = RoadPathDirection::None;
+    startNode.roadNode = &start;
+
+    todo.push(startIdx);
+
+    // Adds the neighbour reached from best or updates it if the new costs are lower
+    const auto visitNeighbour = [&](const unsigned bestIdx, const noRoadNode& neighbour, const unsigned cost,
+                                    const RoadPathDirection dir) {
+        RTTR_Assert(neighbour.GetPlayer() == start.GetPlayer());
+        const unsigned nbIdx = neighbour.GetRoadNodeIdx();
+        RoadPathSearchState::Node& nbNode = nodes[nbIdx];
+        // Was node already visited?
+        if(nbNode.lastVisit == currentVisit)
+        {
+            // Update node if costs are lower
+            if(cost < nbNode.cost)
+            {
+                nbNode.cost = cost;
+                nbNode.estimate = nbNode.targetDistance + cost;
+                nbNode.prev = bestIdx;
+                nbNode.dir = dir;
+                todo.rearrange(nbIdx);
+            }
+        } else
+        {
+            // Not visited yet -> Add to list
+            nbNode.cost = cost;
+            nbNode.targetDistance = gwb_.CalcDistance(neighbour.GetPos(), goalPos);
+            nbNode.estimate = nbNode.targetDistance + cost;
+            nbNode.lastVisit = currentVisit;
+            nbNode.prev = bestIdx;
+            nbNode.dir = dir;
+            nbNode.roadNode = &neighbour;
+
+            todo.push(nbIdx);
+        }
+    };
 
     while(!todo.empty())
     {
         // Get node with current least estimate
-        const noRoadNode& best = *todo.pop();
+        const unsigned bestIdx = todo.pop();
+        const RoadPathSearchState::Node& bestNode = nodes[bestIdx];
+        const noRoadNode& best = *bestNode.roadNode;
 
         // Reached goal
         if(&best == &goal)
         {
             if(length)
-                *length = best.cost;
+                *length = bestNode.cost;
 
             // Backtrack to get the last node that is not the start node (has a prev node)
             // --> Next node from start on path
             if(firstDir || firstNodePos)
             {
-                const noRoadNode* firstNode = &best;
-                while(firstNode->prev != &start)
-                    firstNode = firstNode->prev;
+                unsigned firstNodeIdx = bestIdx;
+                while(nodes[firstNodeIdx].prev != startIdx)
+                    firstNodeIdx = nodes[firstNodeIdx].prev;
 
                 if(firstDir)
-                    *firstDir = firstNode->dir_;
+                    *firstDir = nodes[firstNodeIdx].dir;
 
                 if(firstNodePos)
-                    *firstNodePos = firstNode->GetPos();
+                    *firstNodePos = nodes[firstNodeIdx].roadNode->GetPos();
             }
 
             // Done, path found
@@ -187,7 +217,8 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
         }
 
         const helpers::EnumArray<RoadSegment*, Direction> routes = best.getRoutes();
-        const noRoadNode* prevNode = best.prev;
+        const noRoadNode* prevNode = (bestIdx == startIdx) ? nullptr : nodes[bestNode.prev].roadNode;
+        const unsigned bestCost = bestNode.cost;
 
         // Check paths in all directions
         for(const auto dir : helpers::EnumRange<Direction>{})
@@ -197,7 +228,7 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
                 continue;
 
             // Check the 2 flags, one is the current node, so we need the other
-            noRoadNode* neighbour = route->GetF1();
+            const noRoadNode* neighbour = route->GetF1();
             if(neighbour == &best)
                 neighbour = route->GetF2();
 
@@ -218,35 +249,12 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
             if(!isSegmentAllowed(*route))
                 continue;
 
-            const unsigned cost = best.cost + route->GetLength() + (neighbour != goalBld ? addCosts(best, dir) : 0);
+            const unsigned cost = bestCost + route->GetLength() + (neighbour != goalBld ? addCosts(best, dir) : 0);
 
             if(cost > max)
                 continue;
 
-            // Was node already visited?
-            if(neighbour->last_visit == currentVisit)
-            {
-                // Update node if costs are lower
-                if(cost < neighbour->cost)
-                {
-                    neighbour->cost = cost;
-                    neighbour->estimate = neighbour->targetDistance + cost;
-                    neighbour->prev = &best;
-                    neighbour->dir_ = toRoadPathDirection(dir);
-                    todo.rearrange(neighbour);
-                }
-            } else
-            {
-                // Not visited yet -> Add to list
-                neighbour->cost = cost;
-                neighbour->targetDistance = gwb_.CalcDistance(neighbour->GetPos(), goalPos);
-                neighbour->estimate = neighbour->targetDistance + cost;
-                neighbour->last_visit = currentVisit;
-                neighbour->prev = &best;
-                neighbour->dir_ = toRoadPathDirection(dir);
-
-                todo.push(neighbour);
-            }
+            visitNeighbour(bestIdx, *neighbour, cost, toRoadPathDirection(dir));
         }
 
         // For harbors also consider ship connections
@@ -254,36 +262,12 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
             continue;
         for(const auto& sc : static_cast<const nobHarborBuilding&>(best).GetShipConnections())
         {
-            unsigned cost = best.cost + sc.way_costs;
+            unsigned cost = bestCost + sc.way_costs;
 
             if(cost > max)
                 continue;
 
-            noRoadNode& dest = *sc.dest;
-            // Was node already visited?
-            if(dest.last_visit == currentVisit)
-            {
-                // Update node if costs are lower
-                if(cost < dest.cost)
-                {
-                    dest.cost = cost;
-                    dest.estimate = dest.targetDistance + cost;
-                    dest.prev = &best;
-                    dest.dir_ = RoadPathDirection::Ship;
-                    todo.rearrange(&dest);
-                }
-            } else
-            {
-                // Not visited yet -> Add to list
-                dest.cost = cost;
-                dest.targetDistance = gwb_.CalcDistance(dest.GetPos(), goalPos);
-                dest.estimate = dest.targetDistance + cost;
-                dest.last_visit = currentVisit;
-                dest.prev = &best;
-                dest.dir_ = RoadPathDirection::Ship;
-
-                todo.push(&dest);
-            }
+            visitNeighbour(bestIdx, *sc.dest, cost, RoadPathDirection::Ship);
         }
     }
 
@@ -294,6 +278,16 @@ bool RoadPathFinder::FindPathImpl(const noRoadNode& start, const noRoadNode& goa
 bool RoadPathFinder::FindPath(const noRoadNode& start, const noRoadNode& goal, const bool wareMode, const unsigned max,
                               const RoadSegment* const forbidden, unsigned* const length,
                               RoadPathDirection* const firstDir, MapPoint* const firstNodePos)
+{
+    if(useHumanPathCache_ && !wareMode && !forbidden && max == std::numeric_limits<unsigned>::max())
+        return FindHumanPath(start, goal, length, firstDir, firstNodePos);
+    return FindPath(searchState_, start, goal, wareMode, max, forbidden, length, firstDir, firstNodePos);
+}
+
+bool RoadPathFinder::FindPath(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal,
+                              const bool wareMode, const unsigned max, const RoadSegment* const forbidden,
+                              unsigned* const length, RoadPathDirection* const firstDir,
+                              MapPoint* const firstNodePos) const
 {
     RTTR_Assert_Msg(length || firstDir || firstNodePos, "Use PathExists instead!");
 
@@ -301,43 +295,85 @@ bool RoadPathFinder::FindPath(const noRoadNode& start, const noRoadNode& goal, c
     {
         // TODO(Replay): Change to target flag instead of its attached building
         if(forbidden)
-            return FindPathImpl(start, goal, max, AdditonalCosts::Carrier(),
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::Carrier(),
                                 SegmentConstraints::AvoidSegment(forbidden), length, firstDir, firstNodePos);
         else
-            return FindPathImpl(start, goal, max, AdditonalCosts::Carrier(), SegmentConstraints::None(), length,
-                                firstDir, firstNodePos);
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::Carrier(), SegmentConstraints::None(),
+                                length, firstDir, firstNodePos);
     } else
     {
         if(forbidden)
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(),
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(),
                                 SegmentConstraints::And<SegmentConstraints::AvoidSegment,
                                                         SegmentConstraints::AvoidRoadType<RoadType::Water>>(forbidden),
                                 length, firstDir, firstNodePos);
         else
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(),
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(),
                                 SegmentConstraints::AvoidRoadType<RoadType::Water>(), length, firstDir, firstNodePos);
     }
 }
 
+bool RoadPathFinder::FindHumanPath(const noRoadNode& start, const noRoadNode& goal, unsigned* const length,
+                                   RoadPathDirection* const firstDir, MapPoint* const firstNodePos)
+{
+    const uint64_t key = (static_cast<uint64_t>(start.GetObjId()) << 32) | goal.GetObjId();
+    auto it = humanPathCache_.find(key);
+    if(it != humanPathCache_.end() && it->second.roadNetworkVersion == roadNetworkVersion_)
+        ++numCacheHits_;
+    else
+    {
+        if(it == humanPathCache_.end() && humanPathCache_.size() >= MAX_CACHED_HUMAN_PATHS)
+            humanPathCache_.clear();
+        CachedPath path{roadNetworkVersion_, false, 0, RoadPathDirection::None, MapPoint::Invalid()};
+        path.found = FindPath(searchState_, start, goal, false, std::numeric_limits<unsigned>::max(), nullptr,
+                              &path.length, &path.firstDir, &path.firstNodePos);
+        it = humanPathCache_.insert_or_assign(key, path).first;
+    }
+
+    const CachedPath& path = it->second;
+    if(!path.found)
+        return false;
+    if(length)
+        *length = path.length;
+    if(firstDir)
+        *firstDir = path.firstDir;
+    if(firstNodePos)
+        *firstNodePos = path.firstNodePos;
+    return true;
+}
+
+void RoadPathFinder::SetHumanPathCacheEnabled(const bool enabled)
+{
+    useHumanPathCache_ = enabled;
+    humanPathCache_.clear();
+}
+
 bool RoadPathFinder::PathExists(const noRoadNode& start, const noRoadNode& goal, const bool allowWaterRoads,
                                 const unsigned max, const RoadSegment* const forbidden)
+{
+    return PathExists(searchState_, start, goal, allowWaterRoads, max, forbidden);
+}
+
+bool RoadPathFinder::PathExists(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal,
+                                const bool allowWaterRoads, const unsigned max, const RoadSegment* const forbidden) const
 {
     if(allowWaterRoads)
     {
         // TODO(Replay): Change to target flag instead of its attached building.
         // Likely combine with RoadPathFinder::FindPath
         if(forbidden)
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(), SegmentConstraints::AvoidSegment(forbidden));
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(),
+                                SegmentConstraints::AvoidSegment(forbidden));
         else
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(), SegmentConstraints::None());
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(), SegmentConstraints::None());
     } else
     {
         if(forbidden)
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(),
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(),
                                 SegmentConstraints::And<SegmentConstraints::AvoidSegment,
                                                         SegmentConstraints::AvoidRoadType<RoadType::Water>>(forbidden));
         else
-            return FindPathImpl(start, goal, max, AdditonalCosts::None(),
+            return FindPathImpl(state, start, goal, max, AdditonalCosts::None(),
                                 SegmentConstraints::AvoidRoadType<RoadType::Water>());
     }
 }
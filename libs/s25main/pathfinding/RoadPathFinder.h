@@ -1,24 +1,91 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include "pathfinding/OpenListVector.h"
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/RoadPathDirection.h"
+#include <cstdint>
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
 class GameWorldBase;
 class noRoadNode;
 class RoadSegment;
 
+/// Memory used by a search on roads. Reused between searches, so only a few nodes need to be touched per search.
+/// Searches with different states can run concurrently as long as the world is not modified
+class RoadPathSearchState
+{
+    friend class RoadPathFinder;
+
+    /// A* bookkeeping for the road node with the same road node index
+    struct Node
+    {
+        /// Node is valid for the current search only if lastVisit == currentVisit
+        unsigned lastVisit = 0;
+        /// Cost from start
+        unsigned cost;
+        /// Distance to target
+        unsigned targetDistance;
+        /// Estimated total distance (cost + distance)
+        unsigned estimate;
+        /// Road node index of the previous node
+        unsigned prev;
+        /// Direction to previous node, includes SHIP_DIR
+        RoadPathDirection dir;
+        const noRoadNode* roadNode;
+    };
+
+    struct GetEstimate
+    {
+        const std::vector<Node>& nodes;
+        unsigned operator()(unsigned idx) const { return nodes[idx].estimate; }
+    };
+
+    std::vector<Node> nodes;
+    unsigned currentVisit = 0;
+    OpenListVector<unsigned, GetEstimate> todo;
+    unsigned numSearches = 0;
+
+    /// Prepare for a new search over road nodes with indices below numIndices
+    void StartSearch(unsigned numIndices);
+
+public:
+    RoadPathSearchState() : todo(GetEstimate{nodes}) {}
+    RoadPathSearchState(const RoadPathSearchState&) = delete;
+    RoadPathSearchState& operator=(const RoadPathSearchState&) = delete;
+};
+
 class RoadPathFinder
 {
+    /// Result of a path search for humans, valid as long as the road network version is the same
+    struct CachedPath
+    {
+        unsigned roadNetworkVersion;
+        bool found;
+        unsigned length;
+        RoadPathDirection firstDir;
+        MapPoint firstNodePos;
+    };
+
     GameWorldBase& gwb_;
-    unsigned currentVisit;
+    /// Search state used by the game logic
+    RoadPathSearchState searchState_;
+    /// Paths for humans by start and goal object id.
+    /// Figures walking to the same goal ask for the same paths at each flag and human paths only depend on the roads
+    std::unordered_map<uint64_t, CachedPath> humanPathCache_;
+    /// Version of the road networks of all players. Not part of the game state
+    unsigned roadNetworkVersion_;
+    bool useHumanPathCache_;
+    unsigned numCacheHits_;
 
 public:
-    RoadPathFinder(GameWorldBase& gwb) : gwb_(gwb), currentVisit(0) {}
+    RoadPathFinder(GameWorldBase& gwb) : gwb_(gwb), roadNetworkVersion_(0), useHumanPathCache_(true), numCacheHits_(0)
+    {}
 
     /// Calculates the best path from start to goal
     /// Outputs are only valid if true is returned!
@@ -34,6 +101,11 @@ public:
     bool FindPath(const noRoadNode& start, const noRoadNode& goal, bool wareMode,
                   unsigned max = std::numeric_limits<unsigned>::max(), const RoadSegment* forbidden = nullptr,
                   unsigned* length = nullptr, RoadPathDirection* firstDir = nullptr, MapPoint* firstNodePos = nullptr);
+    /// Same as above but using the given search state and without caching, so it can be called from multiple threads
+    bool FindPath(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal, bool wareMode,
+                  unsigned max = std::numeric_limits<unsigned>::max(), const RoadSegment* forbidden = nullptr,
+                  unsigned* length = nullptr, RoadPathDirection* firstDir = nullptr,
+                  MapPoint* firstNodePos = nullptr) const;
 
     /// Checks if there is ANY path from start to goal
     ///
@@ -42,10 +114,27 @@ public:
     /// @param forbidden RoadSegment that will be ignored
     bool PathExists(const noRoadNode& start, const noRoadNode& goal, bool allowWaterRoads,
                     unsigned max = std::numeric_limits<unsigned>::max(), const RoadSegment* forbidden = nullptr);
+    /// Same as above but using the given search state, so it can be called from multiple threads
+    bool PathExists(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal, bool allowWaterRoads,
+                    unsigned max = std::numeric_limits<unsigned>::max(), const RoadSegment* forbidden = nullptr) const;
+
+    /// Notify that a road connection or the owner of a road node or the set of harbors changed.
+    /// Invalidates cached paths on roads of all players as nodes can move between players, e.g. on capture
+    void RoadNetworkChanged() { ++roadNetworkVersion_; }
+    /// Enable or disable reusing paths for humans (for comparisons only, results are the same)
+    void SetHumanPathCacheEnabled(bool enabled);
+    /// Number of actual searches done so far
+    unsigned GetNumSearches() const { return searchState_.numSearches; }
+    /// Number of path requests answered from the cache so far
+    unsigned GetNumCacheHits() const { return numCacheHits_; }
+    void ResetCounters() { searchState_.numSearches = numCacheHits_ = 0; }
 
 private:
+    bool FindHumanPath(const noRoadNode& start, const noRoadNode& goal, unsigned* length, RoadPathDirection* firstDir,
+                       MapPoint* firstNodePos);
+
     template<class T_AdditionalCosts, class T_SegmentConstraints>
-    bool FindPathImpl(const noRoadNode& start, const noRoadNode& goal, unsigned max, T_AdditionalCosts addCosts,
-                      T_SegmentConstraints isSegmentAllowed, unsigned* length = nullptr,
-                      RoadPathDirection* firstDir = nullptr, MapPoint* firstNodePos = nullptr);
+    bool FindPathImpl(RoadPathSearchState& state, const noRoadNode& start, const noRoadNode& goal, unsigned max,
+                      T_AdditionalCosts addCosts, T_SegmentConstraints isSegmentAllowed, unsigned* length = nullptr,
+                      RoadPathDirection* firstDir = nullptr, MapPoint* firstNodePos = nullptr) const;
 };
@@ -0,0 +1,74 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pathfinding/ShipRouteTable.h"
+#include "helpers/EnumRange.h"
+#include "helpers/IdRange.h"
+#include "helpers/containerUtils.h"
+#include "world/World.h"
+
+void ShipRouteTable::Init(const World& world)
+{
+    Clear();
+    size = world.GetSize();
+    isHarborCoast.assign(prodOfComponents(size), false);
+    for(const auto hbId : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+    {
+        for(const auto dir : helpers::EnumRange<Direction>{})
+        {
+            if(world.GetSeaId(hbId, dir))
+                isHarborCoast[world.GetIdx(world.GetNeighbour(world.GetHarborPoint(hbId), dir))] = true;
+        }
+    }
+}
+
+void ShipRouteTable::Clear()
+{
+    size = MapExtent::all(0);
+    isHarborCoast.clear();
+    routes.clear();
+    numRoutes = 0;
+}
+
+bool ShipRouteTable::IsStored(const MapPoint start, const MapPoint dest) const
+{
+    if(isHarborCoast.empty())
+        return false;
+    return isHarborCoast[start.y * size.x + start.x] && isHarborCoast[dest.y * size.x + dest.x];
+}
+
+const ShipRouteTable::Route* ShipRouteTable::Find(const MapPoint start, const MapPoint dest,
+                                                  const unsigned maxDistance, const Direction startDir)
+{
+    const auto itRoutes = routes.find(MakeKey(start, dest));
+    if(itRoutes != routes.end())
+    {
+        const auto it = helpers::find_if(itRoutes->second, [maxDistance, startDir](const Route& route) {
+            return route.maxDistance == maxDistance && route.startDir == startDir;
+        });
+        if(it != itRoutes->second.end())
+        {
+            stats.hits++;
+            return &*it;
+        }
+    }
+    stats.misses++;
+    return nullptr;
+}
+
+const ShipRouteTable::Route& ShipRouteTable::Add(const MapPoint start, const MapPoint dest, Route route)
+{
+    RTTR_Assert(IsStored(start, dest));
+    numRoutes++;
+    std::vector<Route>& destRoutes = routes[MakeKey(start, dest)];
+    destRoutes.push_back(std::move(route));
+    destRoutes.back().dirs.shrink_to_fit();
+    return destRoutes.back();
+}
+
+uint64_t ShipRouteTable::MakeKey(const MapPoint start, const MapPoint dest)
+{
+    return (static_cast<uint64_t>(start.x) << 48) | (static_cast<uint64_t>(start.y) << 32)
+           | (static_cast<uint64_t>(dest.x) << 16) | dest.y;
+}
@@ -0,0 +1,63 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/Direction.h"
+#include "gameTypes/MapCoordinates.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class World;
+
+/// Routes of ships between the coastal points of harbors, shared by all players.
+/// Water is static during a game, so the route found by the FreePathFinder only depends on start, destination,
+/// maximum distance and the direction the search starts with (which changes with the GF).
+/// Hence each route is calculated once on first use and returned from here afterwards.
+class ShipRouteTable
+{
+public:
+    struct Route
+    {
+        unsigned maxDistance;
+        Direction startDir;
+        bool found;
+        std::vector<Direction> dirs;
+    };
+    struct Statistics
+    {
+        /// Route returned from the table
+        uint64_t hits = 0;
+        /// Route had to be calculated
+        uint64_t misses = 0;
+    };
+
+    /// Remember the coastal points of all harbors of the world and remove all routes
+    void Init(const World& world);
+    void Clear();
+
+    /// Return true if routes between these points are stored
+    bool IsStored(MapPoint start, MapPoint dest) const;
+    /// Return the route found before or nullptr if there is none
+    const Route* Find(MapPoint start, MapPoint dest, unsigned maxDistance, Direction startDir);
+    /// Store a route
+    const Route& Add(MapPoint start, MapPoint dest, Route route);
+    /// Number of stored routes
+    unsigned GetNumRoutes() const { return numRoutes; }
+
+    const Statistics& GetStatistics() const { return stats; }
+    void ResetStatistics() { stats = Statistics(); }
+
+private:
+    static uint64_t MakeKey(MapPoint start, MapPoint dest);
+
+    MapExtent size = MapExtent::all(0);
+    /// True for every coastal point of a harbor
+    std::vector<bool> isHarborCoast;
+    /// All routes (for different maximum distances and start directions) between 2 points
+    std::unordered_map<uint64_t, std::vector<Route>> routes;
+    unsigned numRoutes = 0;
+    Statistics stats;
+};
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -37,7 +37,14 @@ void Random<T_PRNG>::ResetState(const PRNG& newState)
 template<class T_PRNG>
 int Random<T_PRNG>::Rand(const RandomContext& context, const int maxExcl)
 {
-    history_[numInvocations_ % history_.size()] = RandomEntry(numInvocations_, maxExcl, rng_, context);
+    // Update the entry in place so the memory of the source name can be reused
+    RandomEntry& entry = history_[numInvocations_ % history_.size()];
+    entry.counter = numInvocations_;
+    entry.maxExcl = maxExcl;
+    entry.rngState = rng_;
+    entry.srcName = context.srcName;
+    entry.srcLine = context.srcLine;
+    entry.objId = context.objId;
     ++numInvocations_;
 
     return calcRandValue(rng_, maxExcl);
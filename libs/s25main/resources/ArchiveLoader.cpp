@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -6,7 +6,6 @@
 #include "ResolvedFile.h"
 #include "Timer.h"
 #include "commonDefines.h"
-#include "helpers/format.hpp"
 #include "mygettext/mygettext.h"
 #include "ogl/glArchivItem_Bob.h"
 #include "libsiedler2/Archiv.h"
@@ -24,9 +23,17 @@
 
 namespace fs = boost::filesystem;
 
-template<typename... T>
-LoadError::LoadError(T&&... args) : std::runtime_error(helpers::format(std::forward<T>(args)...))
-{}
+std::string LoadMessage::format(const bool doTranslate) const
+{
+    if(!fmt_)
+        return text_;
+    boost::format fmt(doTranslate ? _(fmt_) : fmt_);
+    for(const LoadMessage& arg : args_)
+        fmt % arg.format(doTranslate);
+    return fmt.str();
+}
+
+LoadError::LoadError(LoadMessage message) : std::runtime_error(message.str()), message_(std::move(message)) {}
 
 namespace {
 class NestedArchive : public libsiedler2::Archiv, public libsiedler2::ArchivItem
@@ -54,7 +61,7 @@ std::map<uint16_t, uint16_t> extractBobMapping(libsiedler2::Archiv& archive, con
         if(entry && entry->getBobType() == libsiedler2::BobType::Text)
         {
             if(txtItem)
-                throw LoadError(_("Bob-like file contained multiple text entries: %s\n"), filepath);
+                throw LoadError(gettext_noop("Bob-like file contained multiple text entries: %s\n"), filepath);
             txtItem = boost::static_pointer_cast<libsiedler2::ArchivItem_Text>(std::move(entry));
         }
     }
@@ -65,42 +72,59 @@ std::map<uint16_t, uint16_t> extractBobMapping(libsiedler2::Archiv& archive, con
 }
 } // namespace
 
+template<typename... T>
+void ArchiveLoader::log(std::vector<LoadMessage>* deferredLog, const char* fmt, const T&... args) const
+{
+    if(deferredLog)
+        deferredLog->emplace_back(fmt, args...);
+    else
+        logger_.write("%1%") % LoadMessage(fmt, args...).translate();
+}
+
+void ArchiveLoader::writeLog(const std::vector<LoadMessage>& deferredLog) const
+{
+    for(const LoadMessage& msg : deferredLog)
+        logger_.write("%1%") % msg.translate();
+}
+
 /// Load a single file into the archive
-libsiedler2::Archiv ArchiveLoader::loadFile(const fs::path& filePath,
-                                            const libsiedler2::ArchivItem_Palette* palette) const
+libsiedler2::Archiv ArchiveLoader::loadFile(const fs::path& filePath, const libsiedler2::ArchivItem_Palette* palette,
+                                            std::vector<LoadMessage>* deferredLog) const
 {
-    logger_.write(_("Loading %1%: ")) % filePath;
+    log(deferredLog, gettext_noop("Loading %1%: "), filePath);
 
     libsiedler2::Archiv archive;
     if(int ec = libsiedler2::Load(filePath, archive, palette))
-        throw LoadError(libsiedler2::getErrorString(ec));
+        throw LoadError(LoadMessage(std::string(libsiedler2::getErrorString(ec))));
 
     return archive;
 }
 
 libsiedler2::Archiv ArchiveLoader::loadDirectory(const fs::path& filePath,
-                                                 const libsiedler2::ArchivItem_Palette* palette) const
+                                                 const libsiedler2::ArchivItem_Palette* palette,
+                                                 std::vector<LoadMessage>* deferredLog) const
 {
-    logger_.write(_("Loading directory %s\n")) % filePath;
+    log(deferredLog, gettext_noop("Loading directory %s\n"), filePath);
     std::vector<libsiedler2::FileEntry> files = libsiedler2::ReadFolderInfo(filePath);
-    logger_.write(_("  Loading %1% entries: ")) % files.size();
+    log(deferredLog, gettext_noop("  Loading %1% entries: "), files.size());
 
     libsiedler2::Archiv archive;
 
     if(int ec = libsiedler2::LoadFolder(std::move(files), archive, palette))
-        throw LoadError(libsiedler2::getErrorString(ec));
+        throw LoadError(LoadMessage(std::string(libsiedler2::getErrorString(ec))));
 
     return archive;
 }
 
 libsiedler2::Archiv ArchiveLoader::loadFileOrDir(const fs::path& filePath,
-                                                 const libsiedler2::ArchivItem_Palette* palette) const
+                                                 const libsiedler2::ArchivItem_Palette* palette,
+                                                 std::vector<LoadMessage>* deferredLog) const
 {
     const auto fileStatus = status(filePath);
     if(!exists(fileStatus))
-        throw LoadError(_("File or directory does not exist: %s\n"), filePath);
+        throw LoadError(gettext_noop("File or directory does not exist: %s\n"), filePath);
     if(!is_regular_file(fileStatus) && !is_directory(fileStatus))
-        throw LoadError(_("Could not determine type of path %s\n"), filePath);
+        throw LoadError(gettext_noop("Could not determine type of path %s\n"), filePath);
 
     try
     {
@@ -108,18 +132,18 @@ libsiedler2::Archiv ArchiveLoader::loadFileOrDir(const fs::path& filePath,
 
         libsiedler2::Archiv result;
         if(is_directory(fileStatus))
-            result = loadDirectory(filePath, palette);
+            result = loadDirectory(filePath, palette, deferredLog);
         else
-            result = loadFile(filePath, palette);
+            result = loadFile(filePath, palette, deferredLog);
 
         using namespace std::chrono;
         // TODO: Change translations and use chronoIO
-        logger_.write(_("done in %ums\n")) % duration_cast<milliseconds>(timer.getElapsed()).count();
+        log(deferredLog, gettext_noop("done in %ums\n"), duration_cast<milliseconds>(timer.getElapsed()).count());
 
         return result;
     } catch(const LoadError& e)
     {
-        logger_.write(_("failed: %1%\n")) % e.what();
+        log(deferredLog, gettext_noop("failed: %1%\n"), e.message());
         throw LoadError();
     }
 }
@@ -144,7 +168,7 @@ void ArchiveLoader::mergeArchives(libsiedler2::Archiv& targetArchiv, libsiedler2
                 // We have a sub-archiv -> Merge
                 auto* otherSubArchiv = dynamic_cast<libsiedler2::Archiv*>(otherArchiv[i]);
                 if(!otherSubArchiv)
-                    throw LoadError(_("Failed to merge entry %1%. Archive expected!\n"), i);
+                    throw LoadError(gettext_noop("Failed to merge entry %1%. Archive expected!\n"), i);
                 mergeArchives(*subArchiv, *otherSubArchiv);
             } else
                 targetArchiv.set(i, otherArchiv.release(i)); // Just replace
@@ -152,14 +176,15 @@ void ArchiveLoader::mergeArchives(libsiedler2::Archiv& targetArchiv, libsiedler2
     }
 }
 
-libsiedler2::Archiv ArchiveLoader::load(const ResolvedFile& file, const libsiedler2::ArchivItem_Palette* palette) const
+libsiedler2::Archiv ArchiveLoader::load(const ResolvedFile& file, const libsiedler2::ArchivItem_Palette* palette,
+                                        std::vector<LoadMessage>* deferredLog) const
 {
     libsiedler2::Archiv archive;
     for(const fs::path& curFilepath : file)
     {
         try
         {
-            libsiedler2::Archiv newEntries = loadFileOrDir(curFilepath, palette);
+            libsiedler2::Archiv newEntries = loadFileOrDir(curFilepath, palette, deferredLog);
 
             std::map<uint16_t, uint16_t> bobMapping;
             if(isBobOverride(curFilepath))
@@ -176,8 +201,8 @@ libsiedler2::Archiv ArchiveLoader::load(const ResolvedFile& file, const libsiedl
                 checkedCast<glArchivItem_Bob*>(archive[0])->mergeLinks(bobMapping);
         } catch(const LoadError& e)
         {
-            if(e.what() != std::string())
-                logger_.write("Exception caught: %1%\n") % e.what();
+            if(!e.message().empty())
+                log(deferredLog, "Exception caught: %1%\n", e.message());
             throw LoadError();
         }
     }
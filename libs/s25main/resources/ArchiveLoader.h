@@ -1,11 +1,14 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include "helpers/format.hpp"
 #include <boost/filesystem/path.hpp>
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 class Log;
 class ResolvedFile;
@@ -15,13 +18,54 @@ class Archiv;
 class ArchivItem_Palette;
 } // namespace libsiedler2
 
+/// Message with an untranslated format string and its arguments, translated and formatted only when requested.
+/// Used for messages created in worker threads as translations may only be used from the main thread
+class LoadMessage
+{
+public:
+    LoadMessage() = default;
+    /// Plain text which is not translated
+    explicit LoadMessage(std::string text) : text_(std::move(text)) {}
+    /// Format string (marked with gettext_noop) and arguments, which are converted to strings immediately
+    template<typename... T>
+    explicit LoadMessage(const char* fmt, const T&... args) : fmt_(fmt), args_{toArg(args)...}
+    {}
+
+    bool empty() const { return !fmt_ && text_.empty(); }
+    /// Return the translated and formatted message. Main thread only
+    std::string translate() const { return format(true); }
+    /// Return the formatted message without translating it. Can be used from any thread
+    std::string str() const { return format(false); }
+
+private:
+    std::string format(bool doTranslate) const;
+    template<typename T>
+    static LoadMessage toArg(const T& arg)
+    {
+        return LoadMessage(helpers::format("%1%", arg));
+    }
+    static const LoadMessage& toArg(const LoadMessage& arg) { return arg; }
+
+    const char* fmt_ = nullptr;
+    std::string text_;
+    std::vector<LoadMessage> args_;
+};
+
 /// Exception thrown when loading failed
 class LoadError : public std::runtime_error
 {
 public:
     LoadError() : std::runtime_error("") {}
     template<typename... T>
-    explicit LoadError(T&&... args);
+    explicit LoadError(const char* fmt, const T&... args) : LoadError(LoadMessage(fmt, args...))
+    {}
+    explicit LoadError(LoadMessage message);
+
+    /// Reason for the error, empty if it was already logged
+    const LoadMessage& message() const { return message_; }
+
+private:
+    LoadMessage message_;
 };
 
 class ArchiveLoader
@@ -29,20 +73,31 @@ class ArchiveLoader
 public:
     explicit ArchiveLoader(Log& logger) : logger_(logger) {}
     /// Load a resolved file. Throws a LoadError on error.
-    libsiedler2::Archiv load(const ResolvedFile& file, const libsiedler2::ArchivItem_Palette* palette = nullptr) const;
+    /// If deferredLog is given, messages are appended to it instead of being logged, e.g. when loading in a worker
+    /// thread. They need to be translated and written on the main thread, see writeLog
+    libsiedler2::Archiv load(const ResolvedFile& file, const libsiedler2::ArchivItem_Palette* palette = nullptr,
+                             std::vector<LoadMessage>* deferredLog = nullptr) const;
     /// Load a file or directory. Throws a LoadError on error.
     libsiedler2::Archiv loadFileOrDir(const boost::filesystem::path& filePath,
-                                      const libsiedler2::ArchivItem_Palette* palette = nullptr) const;
+                                      const libsiedler2::ArchivItem_Palette* palette = nullptr,
+                                      std::vector<LoadMessage>* deferredLog = nullptr) const;
+    /// Write the messages collected during a load to the log
+    void writeLog(const std::vector<LoadMessage>& deferredLog) const;
     /// Recursively merge 2 archives.
     static void mergeArchives(libsiedler2::Archiv& targetArchiv, libsiedler2::Archiv& otherArchiv);
 
 private:
     /// Load a single file, logs a message without trailing newline on start and throws a LoadError on error.
     libsiedler2::Archiv loadFile(const boost::filesystem::path& filePath,
-                                 const libsiedler2::ArchivItem_Palette* palette) const;
+                                 const libsiedler2::ArchivItem_Palette* palette,
+                                 std::vector<LoadMessage>* deferredLog) const;
     /// Load a single file, logs a message without trailing newline on start and throws a LoadError on error.
     libsiedler2::Archiv loadDirectory(const boost::filesystem::path& filePath,
-                                      const libsiedler2::ArchivItem_Palette* palette) const;
+                                      const libsiedler2::ArchivItem_Palette* palette,
+                                      std::vector<LoadMessage>* deferredLog) const;
+    /// Write the message (untranslated format string and arguments) to the log or append it to deferredLog if given
+    template<typename... T>
+    void log(std::vector<LoadMessage>* deferredLog, const char* fmt, const T&... args) const;
 
     Log& logger_;
 };
@@ -0,0 +1,205 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AssetCache.h"
+#include "RTTR_Version.h"
+#include "ResolvedFile.h"
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/format.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <algorithm>
+#include <array>
+#include <ctime>
+#include <utility>
+
+namespace bfs = boost::filesystem;
+
+namespace {
+constexpr std::array<char, 8> magic = {'R', 'T', 'T', 'R', 'C', 'A', 'C', 'H'};
+
+struct EntryHeader
+{
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t headerChecksum;
+    uint64_t key;
+    uint64_t payloadSize;
+};
+
+/// Checksum of the header without the checksum field
+uint32_t calcChecksum(EntryHeader header)
+{
+    header.headerChecksum = 0;
+    boost::crc_32_type crc;
+    crc.process_bytes(&header, sizeof(header));
+    return crc.checksum();
+}
+
+void addFileInfo(AssetCache::Key& key, const bfs::path& filePath, const std::string& name)
+{
+    boost::system::error_code ec;
+    const auto fileSize = bfs::file_size(filePath, ec);
+    key.addString(name).addValue(ec ? uint64_t(0) : static_cast<uint64_t>(fileSize));
+    const auto lastWrite = bfs::last_write_time(filePath, ec);
+    key.addValue(ec ? int64_t(0) : static_cast<int64_t>(lastWrite));
+}
+} // namespace
+
+AssetCache::Key::Key()
+{
+    addString(rttr::version::GetRevision());
+}
+
+AssetCache::Key& AssetCache::Key::addData(const void* data, size_t size)
+{
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for(size_t i = 0; i < size; ++i)
+        hash_ = (hash_ ^ bytes[i]) * 1099511628211ull;
+    return *this;
+}
+
+AssetCache::Key& AssetCache::Key::addString(const std::string& value)
+{
+    addValue(static_cast<uint64_t>(value.size()));
+    return addData(value.data(), value.size());
+}
+
+AssetCache::Key& AssetCache::Key::addFile(const bfs::path& path)
+{
+    boost::system::error_code ec;
+    if(!bfs::is_directory(path, ec))
+    {
+        addFileInfo(*this, path, path.generic_string());
+        return *this;
+    }
+    // Iteration order is unspecified, so sort the files to get a stable key
+    std::vector<bfs::path> files;
+    for(bfs::recursive_directory_iterator it(path, ec), end; !ec && it != end; it.increment(ec))
+    {
+        if(bfs::is_regular_file(it->path(), ec))
+            files.push_back(it->path());
+    }
+    std::sort(files.begin(), files.end());
+    addString(path.generic_string()).addValue(static_cast<uint64_t>(files.size()));
+    for(const bfs::path& file : files)
+        addFileInfo(*this, file, file.lexically_relative(path).generic_string());
+    return *this;
+}
+
+AssetCache::Key& AssetCache::Key::addFiles(const ResolvedFile& files)
+{
+    addValue(static_cast<uint64_t>(files.size()));
+    for(const bfs::path& file : files)
+        addFile(file);
+    return *this;
+}
+
+AssetCache::Entry::Entry(std::unique_ptr<boost::iostreams::mapped_file_source> file, size_t payloadOffset,
+                         size_t payloadSize)
+    : file_(std::move(file)), payload_(reinterpret_cast<const uint8_t*>(file_->data()) + payloadOffset),
+      payloadSize_(payloadSize)
+{}
+
+AssetCache::Entry::~Entry() = default;
+
+AssetCache::AssetCache(bfs::path cacheDir) : cacheDir_(std::move(cacheDir)) {}
+
+bfs::path AssetCache::getEntryPath(const std::string& name, uint64_t key) const
+{
+    return cacheDir_ / (boost::format("%1%_%2$016x.cache") % name % key).str();
+}
+
+std::unique_ptr<AssetCache::Entry> AssetCache::read(const std::string& name, uint64_t key) const
+{
+    const bfs::path filePath = getEntryPath(name, key);
+    boost::system::error_code ec;
+    if(!bfs::exists(filePath, ec) || bfs::file_size(filePath, ec) < sizeof(EntryHeader) || ec)
+        return nullptr;
+
+    auto file = std::make_unique<boost::iostreams::mapped_file_source>();
+    try
+    {
+        file->open(filePath.string());
+    } catch(const std::exception&)
+    {
+        return nullptr;
+    }
+    if(!file->is_open() || file->size() < sizeof(EntryHeader))
+        return nullptr;
+
+    EntryHeader header;
+    std::memcpy(&header, file->data(), sizeof(header));
+    if(header.magic != magic || header.version != version || header.headerChecksum != calcChecksum(header)
+       || header.key != key || header.payloadSize != file->size() - sizeof(header))
+        return nullptr;
+    // Mark as recently used
+    bfs::last_write_time(filePath, std::time(nullptr), ec);
+    return std::make_unique<Entry>(std::move(file), sizeof(header), header.payloadSize);
+}
+
+bool AssetCache::write(const std::string& name, uint64_t key, const Writer& payload) const
+{
+    boost::system::error_code ec;
+    bfs::create_directories(cacheDir_, ec);
+    if(ec)
+        return false;
+
+    const std::vector<uint8_t>& data = payload.getData();
+    EntryHeader header;
+    header.magic = magic;
+    header.version = version;
+    header.key = key;
+    header.payloadSize = data.size();
+    header.headerChecksum = calcChecksum(header);
+
+    // Write to a temporary file first so a concurrently running instance never sees a partial entry
+    const bfs::path filePath = getEntryPath(name, key);
+    const bfs::path tmpPath = bfs::path(filePath).concat(".tmp");
+    {
+        boost::nowide::ofstream file(tmpPath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        if(!file)
+        {
+            file.close();
+            bfs::remove(tmpPath, ec);
+            return false;
+        }
+    }
+    bfs::rename(tmpPath, filePath, ec);
+    if(ec)
+    {
+        bfs::remove(tmpPath, ec);
+        return false;
+    }
+    removeOldEntries(name);
+    return true;
+}
+
+void AssetCache::removeOldEntries(const std::string& name) const
+{
+    // Entry files are named "<name>_<16 hex digits>.cache"
+    const std::string prefix = name + '_';
+    const size_t fileNameLen = prefix.size() + 16 + std::strlen(".cache");
+    std::vector<std::pair<std::time_t, bfs::path>> entries;
+    boost::system::error_code ec;
+    for(bfs::directory_iterator it(cacheDir_, ec), end; !ec && it != end; it.increment(ec))
+    {
+        const std::string fileName = it->path().filename().string();
+        if(fileName.size() != fileNameLen || fileName.compare(0, prefix.size(), prefix) != 0
+           || it->path().extension() != ".cache")
+            continue;
+        const std::time_t lastUsed = bfs::last_write_time(it->path(), ec);
+        entries.emplace_back(ec ? 0 : lastUsed, it->path());
+        ec.clear();
+    }
+    if(entries.size() <= maxEntriesPerName)
+        return;
+    // Most recently used first
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for(size_t i = maxEntriesPerName; i < entries.size(); i++)
+        bfs::remove(entries[i].second, ec);
+}
@@ -0,0 +1,135 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <boost/filesystem/path.hpp>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class ResolvedFile;
+
+namespace boost::iostreams {
+class mapped_file_source;
+} // namespace boost::iostreams
+
+/// Cache for assets derived from the game files, e.g. converted sounds or packed textures.
+/// Each entry is stored in its own file named after the entry and the key identifying the inputs it was created from,
+/// so e.g. the textures for different nations or the winter set are kept side by side.
+/// The file consists of a header with the cache version, the key and a checksum of the header, followed by the payload.
+/// The payload is not checksummed as it can be large. Changed inputs are detected by the key, which includes the
+/// size and modification time of the source files.
+/// The payload is stored in native byte order as the cache is specific to the machine anyway.
+class AssetCache
+{
+public:
+    /// Version of the cache. Increase whenever the format of any entry or the way it is created changes
+    static constexpr uint32_t version = 2;
+    /// Number of entries with different keys kept per name. The least recently used ones are removed on write
+    static constexpr unsigned maxEntriesPerName = 8;
+
+    /// Identifies the inputs of an entry (FNV-1a hash). Includes the program revision,
+    /// so entries created by other builds are not used
+    class Key
+    {
+        uint64_t hash_ = 14695981039346656037ull;
+
+    public:
+        Key();
+        Key& addData(const void* data, size_t size);
+        template<typename T>
+        Key& addValue(T value)
+        {
+            static_assert(std::is_integral_v<T> || std::is_enum_v<T>);
+            return addData(&value, sizeof(value));
+        }
+        Key& addString(const std::string& value);
+        /// Add the path, size and modification time of the file or all files in the folder
+        Key& addFile(const boost::filesystem::path& path);
+        Key& addFiles(const ResolvedFile& files);
+        uint64_t get() const { return hash_; }
+    };
+
+    /// Helper to create the payload of an entry
+    class Writer
+    {
+        std::vector<uint8_t> data_;
+
+    public:
+        template<typename T>
+        void push(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            pushRaw(&value, sizeof(value));
+        }
+        void pushRaw(const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            data_.insert(data_.end(), bytes, bytes + size);
+        }
+        const std::vector<uint8_t>& getData() const { return data_; }
+    };
+
+    /// Helper to read the payload of an entry. Throws a std::runtime_error when reading past the end
+    class Reader
+    {
+        const uint8_t* data_;
+        size_t size_;
+        size_t pos_ = 0;
+
+    public:
+        Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+        template<typename T>
+        T pop()
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value;
+            std::memcpy(&value, popRaw(sizeof(value)), sizeof(value));
+            return value;
+        }
+        /// Return a pointer to the next size bytes and skip them
+        const uint8_t* popRaw(size_t size)
+        {
+            if(size > size_ - pos_)
+                throw std::runtime_error("Unexpected end of cache entry");
+            const uint8_t* result = data_ + pos_;
+            pos_ += size;
+            return result;
+        }
+        size_t getBytesLeft() const { return size_ - pos_; }
+    };
+
+    /// Memory mapped entry read from the cache
+    class Entry
+    {
+        std::unique_ptr<boost::iostreams::mapped_file_source> file_;
+        const uint8_t* payload_;
+        size_t payloadSize_;
+
+    public:
+        Entry(std::unique_ptr<boost::iostreams::mapped_file_source> file, size_t payloadOffset, size_t payloadSize);
+        ~Entry();
+        Reader getReader() const { return Reader(payload_, payloadSize_); }
+    };
+
+    explicit AssetCache(boost::filesystem::path cacheDir);
+
+    /// Return the entry with the given name and key if it exists and is intact. Otherwise nullptr
+    std::unique_ptr<Entry> read(const std::string& name, uint64_t key) const;
+    /// Store the entry replacing any existing one with the same name and key. Returns false on failure
+    bool write(const std::string& name, uint64_t key, const Writer& payload) const;
+    boost::filesystem::path getEntryPath(const std::string& name, uint64_t key) const;
+
+private:
+    /// Remove the least recently used entries with the given name exceeding maxEntriesPerName
+    void removeOldEntries(const std::string& name) const;
+
+    boost::filesystem::path cacheDir_;
+};
@@ -63,9 +63,16 @@ GameWorld::~GameWorld()
     GameObject::DetachWorld(this);
 }
 
-MilitarySquares& GameWorld::GetMilitarySquares()
+void GameWorld::AddMilitaryBuilding(nobBaseMilitary& building)
 {
-    return militarySquares;
+    militarySquares.Add(&building);
+    territoryClaims.Add(*this, building);
+}
+
+void GameWorld::RemoveMilitaryBuilding(nobBaseMilitary& building)
+{
+    militarySquares.Remove(&building);
+    territoryClaims.Remove(*this, building);
 }
 
 void GameWorld::SetFlag(const MapPoint pt, const unsigned char player)
@@ -414,6 +421,9 @@ void GameWorld::RecalcTerritory(const noBaseBuilding& building, TerritoryChangeR
             sizeChanges[oldOwner - 1]--;
     }
 
+    if(tradePathCache)
+        tradePathCache->onOwnerChanged(ptsWithChangedOwners);
+
     const std::vector<MapPoint> ptsToHandle = GetAllNeighboursUnion(ptsWithChangedOwners);
 
     // Destroy everything from old player on all nodes where the owner has changed
@@ -551,20 +561,10 @@ TerritoryRegion GameWorld::CreateTerritoryRegion(const noBaseBuilding& building,
     const Extent size = elMin(2u * radius2D + Extent(1, 1), Extent(GetSize()));
     TerritoryRegion region(startPt, size, *this);
 
-    // Alle Gebäude ihr Terrain in der Nähe neu berechnen
-    sortedMilitaryBlds buildings = LookForMilitaryBuildings(bldPos, 3);
-    for(const nobBaseMilitary* milBld : buildings)
-    {
-        if(reason != TerritoryChangeReason::Destroyed || milBld != &building)
-            region.CalcTerritoryOfBuilding(*milBld);
-    }
-
-    // Baustellen von Häfen mit einschließen
-    for(const noBuildingSite* bldSite : harbor_building_sites_from_sea)
-    {
-        if(reason != TerritoryChangeReason::Destroyed || bldSite != &building)
-            region.CalcTerritoryOfBuilding(*bldSite);
-    }
+    // Take the territory of all buildings around from their claims instead of adding them one by one
+    const noBaseBuilding* excludedBld = (reason == TerritoryChangeReason::Destroyed) ? &building : nullptr;
+    RTTR_FOREACH_PT(Position, size)
+        region.SetOwner(pt, territoryClaims.GetOwner(*this, MakeMapPoint(pt + startPt), excludedBld));
     CleanTerritoryRegion(region, reason, building);
 
     return region;
@@ -1042,24 +1042,18 @@ bool GameWorld::IsValidPointForFighting(MapPoint pt, const nofActiveSoldier& sol
 bool GameWorld::IsPointCompletelyVisible(const MapPoint& pt, unsigned char player,
                                          const noBaseBuilding* exception) const
 {
-    sortedMilitaryBlds buildings = LookForMilitaryBuildings(pt, 3);
-
     // Sichtbereich von Militärgebäuden
-    for(const nobBaseMilitary* milBld : buildings)
-    {
-        if(milBld->GetPlayer() == player && milBld != exception)
-        {
-            // Prüfen, obs auch unbesetzt ist
-            if(milBld->GetGOT() == GO_Type::NobMilitary)
-            {
-                if(static_cast<const nobMilitary*>(milBld)->IsNewBuilt())
-                    continue;
-            }
-
-            if(CalcDistance(pt, milBld->GetPos()) <= unsigned(milBld->GetMilitaryRadius() + VISUALRANGE_MILITARY))
-                return true;
-        }
-    }
+    // Checked without creating a list of them as this is done for many points whenever soldiers or scouts walk
+    const auto isVisibleFromMilBld = [&](const nobBaseMilitary* milBld) {
+        if(milBld->GetPlayer() != player || milBld == exception)
+            return false;
+        // Prüfen, obs auch unbesetzt ist
+        if(milBld->GetGOT() == GO_Type::NobMilitary && static_cast<const nobMilitary*>(milBld)->IsNewBuilt())
+            return false;
+        return CalcDistance(pt, milBld->GetPos()) <= unsigned(milBld->GetMilitaryRadius() + VISUALRANGE_MILITARY);
+    };
+    if(militarySquares.CheckBuildingsInRange(pt, 3, isVisibleFromMilBld))
+        return true;
 
     // Sichtbereich von Hafenbaustellen
     for(const noBuildingSite* bldSite : harbor_building_sites_from_sea)
@@ -1190,17 +1184,14 @@ void GameWorld::MakeVisible(const MapPoint pt, const unsigned char player)
 void GameWorld::RecalcVisibilitiesAroundPoint(const MapPoint pt, const MapCoord radius, const unsigned char player,
                                               const noBaseBuilding* const exception)
 {
-    std::vector<MapPoint> pts = GetPointsInRadiusWithCenter(pt, radius);
-    for(const MapPoint& pt : pts)
-        RecalcVisibility(pt, player, exception);
+    ForEachPointInRadius(
+      pt, radius, [&](const MapPoint curPt, unsigned) { RecalcVisibility(curPt, player, exception); }, true);
 }
 
 /// Setzt die Sichtbarkeiten um einen Punkt auf sichtbar (aus Performancegründen Alternative zu oberem)
 void GameWorld::MakeVisibleAroundPoint(const MapPoint pt, const MapCoord radius, const unsigned char player)
 {
-    std::vector<MapPoint> pts = GetPointsInRadiusWithCenter(pt, radius);
-    for(const MapPoint& curPt : pts)
-        MakeVisible(curPt, player);
+    ForEachPointInRadius(pt, radius, [&](const MapPoint curPt, unsigned) { MakeVisible(curPt, player); }, true);
 }
 
 /// Bestimmt bei der Bewegung eines spähenden Objekts die Sichtbarkeiten an
@@ -1321,10 +1312,19 @@ bool GameWorld::FoundColony(const HarborId harbor, const unsigned char player, c
     return true;
 }
 
+void GameWorld::AddHarborBuildingSiteFromSea(noBuildingSite* building_site)
+{
+    harbor_building_sites_from_sea.push_back(building_site);
+    territoryClaims.Add(*this, *building_site);
+}
+
 void GameWorld::RemoveHarborBuildingSiteFromSea(noBuildingSite* building_site)
 {
     RTTR_Assert(building_site->GetBuildingType() == BuildingType::HarborBuilding);
+    if(!IsHarborBuildingSiteFromSea(building_site))
+        return;
     harbor_building_sites_from_sea.remove(building_site);
+    territoryClaims.Remove(*this, *building_site);
 }
 
 bool GameWorld::IsHarborBuildingSiteFromSea(const noBuildingSite* building_site) const
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -11,12 +11,12 @@
 #include <vector>
 
 class GameInterface;
-class MilitarySquares;
 class noBaseBuilding;
 class noBuildingSite;
 class noRoadNode;
 class nofActiveSoldier;
 class nofAttacker;
+class nobBaseMilitary;
 struct PlayerInfo;
 class RoadSegment;
 class TerritoryRegion;
@@ -120,7 +120,9 @@ public:
     /// Greift ein Militäregebäude mit Schiffen an
     void AttackViaSea(unsigned char player_attacker, MapPoint pt, unsigned short soldiers_count, bool strong_soldiers);
 
-    MilitarySquares& GetMilitarySquares();
+    /// Add a military building (including HQs and harbors) to the military squares and the territory claims
+    void AddMilitaryBuilding(nobBaseMilitary& building);
+    void RemoveMilitaryBuilding(nobBaseMilitary& building);
 
     /// Lässt alles spielerische abbrennen, indem es alle Flaggen der Spieler zerstört
     void Armageddon();
@@ -148,10 +150,7 @@ public:
     /// Gründet vom Schiff aus eine neue Kolonie, gibt true zurück bei Erfolg
     bool FoundColony(HarborId harbor, unsigned char player, SeaId seaId);
     /// Registriert eine Baustelle eines Hafens, die vom Schiff aus gesetzt worden ist
-    void AddHarborBuildingSiteFromSea(noBuildingSite* building_site)
-    {
-        harbor_building_sites_from_sea.push_back(building_site);
-    }
+    void AddHarborBuildingSiteFromSea(noBuildingSite* building_site);
     /// Removes it. It is allowed to be called with a regular harbor building site (no-op in that case)
     void RemoveHarborBuildingSiteFromSea(noBuildingSite* building_site);
     /// Gibt zurück, ob eine bestimmte Baustellen eine Baustelle ist, die vom Schiff aus errichtet wurde
@@ -416,6 +416,20 @@ unsigned GameWorldBase::CalcDistanceToNearestHarbor(const MapPoint pos) const
     return min_distance;
 }
 
+bool GameWorldBase::IsReachableForSeaAttack(const MapPoint pt, const MapPoint harborOrCoastPt) const
+{
+    if(seaAttackDistances.IsUsable(GetSize()))
+        return seaAttackDistances.IsReachable(*this, harborOrCoastPt, pt);
+    return pt == harborOrCoastPt || FindHumanPath(pt, harborOrCoastPt, SEAATTACK_DISTANCE);
+}
+
+bool GameWorldBase::IsReachableForAttack(const MapPoint bldPos, const MapPoint targetPt) const
+{
+    if(attackDistances.IsUsable(GetSize()))
+        return attackDistances.IsReachable(*this, bldPos, targetPt);
+    return bldPos == targetPt || FindHumanPath(bldPos, targetPt, MAX_ATTACKING_RUN_DISTANCE);
+}
+
 /// returns true when a harborpoint is in SEAATTACK_DISTANCE for figures!
 bool GameWorldBase::IsAHarborInSeaAttackDistance(const MapPoint pos) const
 {
@@ -423,7 +437,7 @@ bool GameWorldBase::IsAHarborInSeaAttackDistance(const MapPoint pos) const
     {
         if(CalcDistance(pos, GetHarborPoint(i)) < SEAATTACK_DISTANCE)
         {
-            if(FindHumanPath(pos, GetHarborPoint(i), SEAATTACK_DISTANCE))
+            if(IsReachableForSeaAttack(pos, GetHarborPoint(i)))
                 return true;
         }
     }
@@ -477,7 +491,7 @@ std::vector<HarborId> GameWorldBase::GetUsableTargetHarborsForAttack(const MapPo
 
             // Can figures reach flag from coast
             const MapPoint coastalPt = GetCoastalPoint(curHbId, seaId);
-            if((flagPt == coastalPt) || FindHumanPath(flagPt, coastalPt, SEAATTACK_DISTANCE))
+            if(IsReachableForSeaAttack(flagPt, coastalPt))
             {
                 use_seas.at(seaId.value() - 1) = true;
                 if(!harborinlist)
@@ -540,7 +554,7 @@ std::vector<SeaId> GameWorldBase::GetFilteredSeaIDsForAttack(const MapPoint targ
 
             // Can figures reach flag from coast
             MapPoint coastalPt = GetCoastalPoint(curHbId, seaId);
-            if((flagPt == coastalPt) || FindHumanPath(flagPt, coastalPt, SEAATTACK_DISTANCE))
+            if(IsReachableForSeaAttack(flagPt, coastalPt))
             {
                 confirmedSeaIds.push_back(seaId);
                 // all sea ids confirmed? return without changes
@@ -565,7 +579,7 @@ std::vector<HarborId> GameWorldBase::GetHarborPointsAroundMilitaryBuilding(const
         if(CalcDistance(harborPt, pt) <= SEAATTACK_DISTANCE)
         {
             // Wird ein Weg vom Militärgebäude zum Hafen gefunden bzw. Ziel = Hafen?
-            if(pt == harborPt || FindHumanPath(pt, harborPt, SEAATTACK_DISTANCE))
+            if(IsReachableForSeaAttack(pt, harborPt))
                 harbor_points.push_back(i);
         }
     }
@@ -581,7 +595,7 @@ unsigned GameWorldBase::GetNumSoldiersForSeaAttackAtSea(const unsigned char play
     std::vector<nobHarborBuilding::SeaAttackerBuilding> buildings;
     unsigned attackercount = 0;
     // Angrenzende Häfen des Angreifers an den entsprechenden Meeren herausfinden
-    const std::list<nobHarborBuilding*>& harbors = GetPlayer(player_attacker).GetBuildingRegister().GetHarbors();
+    const auto& harbors = GetPlayer(player_attacker).GetBuildingRegister().GetHarbors();
     for(auto* harbor : harbors)
     {
         // Bestimmen, ob Hafen an einem der Meere liegt, über die sich auch die gegnerischen
@@ -637,7 +651,7 @@ GameWorldBase::GetSoldiersForSeaAttack(const unsigned char player_attacker, cons
     std::vector<nobHarborBuilding::SeaAttackerBuilding> buildings;
 
     // Angrenzende Häfen des Angreifers an den entsprechenden Meeren herausfinden
-    const std::list<nobHarborBuilding*>& harbors = GetPlayer(player_attacker).GetBuildingRegister().GetHarbors();
+    const auto& harbors = GetPlayer(player_attacker).GetBuildingRegister().GetHarbors();
     for(auto* harbor : harbors)
     {
         // Bestimmen, ob Hafen an einem der Meere liegt, über die sich auch die gegnerischen
@@ -705,8 +719,8 @@ void GameWorldBase::RecalcBQ(const MapPoint pt)
 
 void GameWorldBase::SetComputerBarrier(const MapPoint& pt, unsigned radius)
 {
-    for(const auto& pt : GetPointsInRadiusWithCenter(pt, radius))
-        ptsInsideComputerBarriers.insert(pt);
+    ForEachPointInRadius(
+      pt, radius, [this](const MapPoint curPt, unsigned) { ptsInsideComputerBarriers.insert(curPt); }, true);
 }
 
 bool GameWorldBase::IsInsideComputerBarrier(const MapPoint& pt) const
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -120,6 +120,7 @@ public:
     bool FindShipPathToHarbor(MapPoint start, HarborId harborId, SeaId seaId, std::vector<Direction>* route,
                               unsigned* length);
     /// Find path for ships with a limited distance. Return true on success
+    /// Routes between coastal points of harbors are calculated only once and then taken from the ShipRouteTable
     bool FindShipPath(MapPoint start, MapPoint dest, unsigned maxDistance, std::vector<Direction>* route,
                       unsigned* length);
     RoadPathFinder& GetRoadPathFinder() const { return *roadPathFinder; }
@@ -195,6 +196,8 @@ public:
         {}
     };
 
+    /// Return true if soldiers can walk from the military building to the target within MAX_ATTACKING_RUN_DISTANCE
+    bool IsReachableForAttack(MapPoint bldPos, MapPoint targetPt) const;
     /// Liefert Hafenpunkte im Umkreis von einem bestimmten Milit�rgeb�ude
     std::vector<HarborId> GetHarborPointsAroundMilitaryBuilding(MapPoint pt) const;
     /// Return all harbor Ids that can be used as a landing site for attacking the given point
@@ -233,4 +236,6 @@ private:
     template<typename T_IsHarborOk>
     HarborId GetHarborInDir(MapPoint pt, HarborId originHarborId, const ShipDirection& dir,
                             T_IsHarborOk isHarborOk) const;
+    /// Return true if a figure can walk from the point to the harbor or coastal point within SEAATTACK_DISTANCE
+    bool IsReachableForSeaAttack(MapPoint pt, MapPoint harborOrCoastPt) const;
 };
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2024 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -29,60 +29,6 @@ void MapBase::Resize(const MapExtent& newSize)
     size_ = newSize;
 }
 
-MapPoint MapBase::GetNeighbour(const MapPoint pt, const Direction dir) const
-{
-    /*  Note that every 2nd row is shifted by half a triangle to the left, therefore:
-    Modifications for the dirs:
-    current row:    Even    Odd
-                 W  -1|0   -1|0
-    D           NW  -1|-1   0|-1
-    I           NE   0|-1   1|-1
-    R            E   1|0    1|0
-                SE   0|1    1|1
-                SW  -1|1    0|1
-    */
-
-    MapPoint res;
-    switch(dir)
-    {
-        case Direction::West: // -1|0   -1|0
-            res.x = ((pt.x == 0) ? size_.x : pt.x) - 1;
-            res.y = pt.y;
-            break;
-        case Direction::NorthWest: // -1|-1   0|-1
-            res.x = (pt.y & 1) ? pt.x : (((pt.x == 0) ? size_.x : pt.x) - 1);
-            res.y = ((pt.y == 0) ? size_.y : pt.y) - 1;
-            break;
-        case Direction::NorthEast: // 0|-1  -1|-1
-            res.x = (!(pt.y & 1)) ? pt.x : ((pt.x == size_.x - 1) ? 0 : pt.x + 1);
-            res.y = ((pt.y == 0) ? size_.y : pt.y) - 1;
-            break;
-        case Direction::East: // 1|0    1|0
-            res.x = pt.x + 1;
-            if(res.x == size_.x)
-                res.x = 0;
-            res.y = pt.y;
-            break;
-        case Direction::SouthEast: // 1|1    0|1
-            res.x = (!(pt.y & 1)) ? pt.x : ((pt.x == size_.x - 1) ? 0 : pt.x + 1);
-            res.y = pt.y + 1;
-            if(res.y == size_.y)
-                res.y = 0;
-            break;
-        default:
-            RTTR_Assert(dir == Direction::SouthWest);                         // 0|1   -1|1
-            res.x = (pt.y & 1) ? pt.x : (((pt.x == 0) ? size_.x : pt.x) - 1); //-V537
-            res.y = pt.y + 1;
-            if(res.y == size_.y)
-                res.y = 0;
-            break;
-    }
-
-    // This should be the same, but faster
-    // RTTR_Assert(res == MakeMapPoint(::GetNeighbour(Position(pt), dir)));
-    return res;
-}
-
 MapPoint MapBase::GetNeighbour2(const MapPoint pt, unsigned dir) const
 {
     return MakeMapPoint(::GetNeighbour2(Position(pt), dir));
@@ -1,16 +1,19 @@
-// Copyright (C) 2005 - 2025 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
 #include "RTTR_Assert.h"
+#include "enum_cast.hpp"
 #include "helpers/EnumArray.h"
 #include "helpers/EnumRange.h"
 #include "gameTypes/Direction.h"
 #include "gameTypes/MapCoordinates.h"
 #include "gameTypes/ShipDirection.h"
 #include <array>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 struct AlwaysTrue
@@ -28,7 +31,73 @@ struct ReturnMapPoint
 namespace detail {
 template<typename T_TransformPt>
 using GetPointsResult_t = std::vector<decltype(std::declval<T_TransformPt>()(MapPoint{}, unsigned{}))>;
+
+/*  Note that every 2nd row is shifted by half a triangle to the left, therefore:
+Modifications for the dirs:
+current row:    Even    Odd
+             W  -1|0   -1|0
+D           NW  -1|-1   0|-1
+I           NE   0|-1   1|-1
+R            E   1|0    1|0
+            SE   0|1    1|1
+            SW  -1|1    0|1
+*/
+/// X offset of the neighbour in each direction, indexed by the parity of the row
+constexpr std::array<std::array<int8_t, helpers::NumEnumValues_v<Direction>>, 2> neighbourOffsetsX = {{
+  {-1, -1, 0, 1, 0, -1}, // Even row
+  {-1, 0, 1, 1, 1, 0}    // Odd row
+}};
+/// Y offset of the neighbour in each direction
+constexpr std::array<int8_t, helpers::NumEnumValues_v<Direction>> neighbourOffsetsY = {0, -1, -1, 0, 1, 1};
+
+/// Bring a coordinate which is at most one map size outside the map back into it
+constexpr MapCoord wrapCoord(int coord, MapCoord size)
+{
+    return static_cast<MapCoord>(coord < 0 ? coord + size : (coord >= size ? coord - size : coord));
+}
+
+/// Offset of a point relative to the center of a radius and its distance to it
+struct RadiusOffset
+{
+    int16_t dx, dy;
+    unsigned radius;
+};
+template<unsigned T_radius>
+using RadiusOffsets = std::array<RadiusOffset, 3u * T_radius * (T_radius + 1u)>;
+
+/// Create the offsets of all points in the radius around a point in an even or odd row,
+/// in the same order as the hull walk of MapBase::CheckPointsInRadius
+template<unsigned T_radius>
+constexpr RadiusOffsets<T_radius> makeRadiusOffsets(const bool isOddRow)
+{
+    RadiusOffsets<T_radius> result{};
+    const int startY = isOddRow ? 1 : 0;
+    int startX = 0;
+    unsigned idx = 0;
+    for(unsigned r = 1; r <= T_radius; ++r)
+    {
+        // Go one level/hull to the left
+        startX += neighbourOffsetsX[startY & 1][rttr::enum_cast(Direction::West)];
+        int x = startX, y = startY;
+        // Go r steps in each direction starting at NorthEast
+        for(unsigned i = 0; i < helpers::NumEnumValues_v<Direction>; ++i)
+        {
+            const unsigned dir = (rttr::enum_cast(Direction::NorthEast) + i) % helpers::NumEnumValues_v<Direction>;
+            for(unsigned step = 0; step < r; ++step)
+            {
+                result[idx++] = RadiusOffset{static_cast<int16_t>(x), static_cast<int16_t>(y - startY), r};
+                x += neighbourOffsetsX[y & 1][dir];
+                y += neighbourOffsetsY[dir];
+            }
+        }
+    }
+    return result;
 }
+/// Offsets of the points in the radius, indexed by the parity of the row of the center point
+template<unsigned T_radius>
+inline constexpr std::array<RadiusOffsets<T_radius>, 2> radiusOffsets = {makeRadiusOffsets<T_radius>(false),
+                                                                          makeRadiusOffsets<T_radius>(true)};
+} // namespace detail
 
 /// Base class for a map. A map has a size and functions for getting from one point to another in that map
 class MapBase
@@ -53,7 +122,12 @@ public:
     unsigned GetIdx(MapPoint pt) const;
 
     /// Get coordinates of neighbor in the given direction
-    MapPoint GetNeighbour(MapPoint pt, Direction dir) const;
+    MapPoint GetNeighbour(MapPoint pt, Direction dir) const
+    {
+        const auto iDir = rttr::enum_cast(dir);
+        return MapPoint(detail::wrapCoord(pt.x + detail::neighbourOffsetsX[pt.y & 1][iDir], size_.x),
+                        detail::wrapCoord(pt.y + detail::neighbourOffsetsY[iDir], size_.y));
+    }
     /// Return neighboring point (2nd layer: dir 0-11)
     MapPoint GetNeighbour2(MapPoint, unsigned dir) const;
     // Convenience functions for the above function
@@ -88,6 +162,33 @@ public:
     /// If includePt is true, then the point itself is also checked
     template<class T_IsValidPt>
     bool CheckPointsInRadius(MapPoint pt, unsigned radius, T_IsValidPt&& isValid, bool includePt) const;
+    /// Same as above for a radius known at compile time using precomputed offsets instead of walking the hulls
+    template<unsigned T_radius, class T_IsValidPt>
+    bool CheckPointsInRadius(MapPoint pt, T_IsValidPt&& isValid, bool includePt) const;
+    /// Call the functor with each point in the radius and its distance to pt without allocating memory.
+    /// Points are visited in the same order as returned by GetPointsInRadius
+    template<class T_Func>
+    void ForEachPointInRadius(MapPoint pt, unsigned radius, T_Func&& func, bool includePt = false) const
+    {
+        CheckPointsInRadius(
+          pt, radius,
+          [&func](const MapPoint curPt, const unsigned r) {
+              func(curPt, r);
+              return false;
+          },
+          includePt);
+    }
+    template<unsigned T_radius, class T_Func>
+    void ForEachPointInRadius(MapPoint pt, T_Func&& func, bool includePt = false) const
+    {
+        CheckPointsInRadius<T_radius>(
+          pt,
+          [&func](const MapPoint curPt, const unsigned r) {
+              func(curPt, r);
+              return false;
+          },
+          includePt);
+    }
 
     /// Return the distance between 2 points on the map (includes wrapping around map borders)
     unsigned CalcDistance(const Position& p1, const Position& p2) const;
@@ -129,38 +230,16 @@ detail::GetPointsResult_t<T_TransformPt> MapBase::GetPointsInRadius(const MapPoi
         // center point if requested This can be reduced via the gauss formula to the following:
         result.reserve((radius * radius + radius) * 3u + (includePt ? 1u : 0u));
     }
-    if(includePt)
-    {
-        const auto el = transformPt(pt, 0);
-        if(isValid(el))
-        {
-            result.push_back(el);
-            if(T_maxResults == 1)
-                return result;
-        }
-    }
-    MapPoint curStartPt = pt;
-    for(unsigned r = 1; r <= radius; ++r)
-    {
-        // Go one level/hull to the left
-        curStartPt = GetNeighbour(curStartPt, Direction::West);
-        // Now iterate over the "circle" of radius r by going r steps in one direction, turn right and repeat
-        MapPoint curPt = curStartPt;
-        for(const auto dir : helpers::enumRange(Direction::NorthEast))
-        {
-            for(unsigned step = 0; step < r; ++step)
-            {
-                const auto el = transformPt(curPt, r);
-                if(isValid(el))
-                {
-                    result.push_back(el);
-                    if(T_maxResults > 0 && static_cast<int>(result.size()) >= T_maxResults)
-                        return result;
-                }
-                curPt = GetNeighbour(curPt, dir);
-            }
-        }
-    }
+    CheckPointsInRadius(
+      pt, radius,
+      [&](const MapPoint curPt, const unsigned r) {
+          const auto el = transformPt(curPt, r);
+          if(!isValid(el))
+              return false;
+          result.push_back(el);
+          return T_maxResults > 0 && static_cast<int>(result.size()) >= T_maxResults;
+      },
+      includePt);
     return result;
 }
 
@@ -189,3 +268,21 @@ inline bool MapBase::CheckPointsInRadius(const MapPoint pt, unsigned radius, T_I
     }
     return false;
 }
+
+template<unsigned T_radius, class T_IsValidPt>
+bool MapBase::CheckPointsInRadius(const MapPoint pt, T_IsValidPt&& isValid, bool includePt) const
+{
+    // The offsets may only wrap once around the map
+    if(T_radius >= size_.x || T_radius >= size_.y)
+        return CheckPointsInRadius(pt, T_radius, std::forward<T_IsValidPt>(isValid), includePt);
+    if(includePt && isValid(pt, 0))
+        return true;
+    for(const detail::RadiusOffset& offset : detail::radiusOffsets<T_radius>[pt.y & 1])
+    {
+        const MapPoint curPt(detail::wrapCoord(pt.x + offset.dx, size_.x),
+                             detail::wrapCoord(pt.y + offset.dy, size_.y));
+        if(isValid(curPt, offset.radius))
+            return true;
+    }
+    return false;
+}
@@ -588,6 +588,10 @@ bool MapLoader::InitSeasAndHarbors(World& world, const std::vector<MapPoint>& ad
 
     // Calculate the neighbors and distances
     CalcHarborPosNeighbors(world);
+    // Stored routes and distances might be from different terrain or harbors
+    world.shipRouteTable.Init(world);
+    world.seaAttackDistances.Clear();
+    world.attackDistances.Clear();
 
     // Validate
     for(const auto startHbId : helpers::idRange<HarborId>(world.harborData.size()))
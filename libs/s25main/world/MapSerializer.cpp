@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -74,6 +74,7 @@ void MapSerializer::Serialize(const GameWorldBase& world, SerializedGameData& sg
         sgd.PushUnsignedInt(luaSaveState.GetLength());
         sgd.PushRawData(luaSaveState.GetData(), luaSaveState.GetLength());
         sgd.PushUnsignedInt(0xC001C0DE); // End Lua identifier
+        world.GetLua().SerializeBatchedEvents(sgd);
     }
 }
 
@@ -158,8 +159,11 @@ void MapSerializer::Deserialize(GameWorldBase& world, SerializedGameData& sgd, G
         if(!world.harborData.front().pos.isValid())
             world.harborData.erase(world.harborData.begin());
     }
+    world.shipRouteTable.Init(world);
 
     sgd.PopObjectContainer(world.harbor_building_sites_from_sea, GO_Type::Buildingsite);
+    for(const noBuildingSite* bldSite : world.harbor_building_sites_from_sea)
+        world.territoryClaims.Add(world, *bldSite);
 
     const std::string luaScript = sgd.PopLongString();
     if(!luaScript.empty())
@@ -186,6 +190,8 @@ void MapSerializer::Deserialize(GameWorldBase& world, SerializedGameData& sgd, G
         {
             throw SerializedGameData::Error(std::string(_("Failed to load lua state!")) + _("Error: ") + e.what());
         }
+        if(sgd.GetGameDataVersion() >= 15)
+            lua->DeserializeBatchedEvents(sgd);
         game.SetLua(std::move(lua));
     }
     world.CreateTradeGraphs();
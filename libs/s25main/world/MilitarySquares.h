@@ -1,10 +1,12 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #pragma once
 
+#include "RTTR_Assert.h"
 #include "gameTypes/MapCoordinates.h"
+#include "gameData/MilitaryConsts.h"
 #include <list>
 #include <vector>
 
@@ -26,4 +28,47 @@ public:
     void Add(nobBaseMilitary* bld);
     void Remove(nobBaseMilitary* bld);
     sortedMilitaryBlds GetBuildingsInRange(MapPoint pt, unsigned short radius) const;
+    /// Return true if the predicate returns true for any military building in range.
+    /// Same buildings as GetBuildingsInRange but without creating a list of them, so they might be checked in any order
+    template<class T_Predicate>
+    bool CheckBuildingsInRange(MapPoint pt, unsigned short radius, T_Predicate&& predicate) const;
 };
+
+template<class T_Predicate>
+bool MilitarySquares::CheckBuildingsInRange(const MapPoint pt, unsigned short radius, T_Predicate&& predicate) const
+{
+    // maximum radius is half the size (rounded up) to avoid overlapping
+    const Position offsets = elMin((size_ + Position::all(1)) / 2, Position::all(radius));
+
+    // Convert to military coords
+    const Position milPos(pt / MILITARY_SQUARE_SIZE);
+
+    const Position firstPt = milPos - offsets;
+    const Position lastPt = milPos + offsets;
+
+    for(int cy = firstPt.y; cy <= lastPt.y; ++cy)
+    {
+        // Handle wrap-around
+        int realY = cy;
+        if(realY < 0)
+            realY += size_.y;
+        else if(realY >= static_cast<int>(size_.y))
+            realY -= size_.y;
+        RTTR_Assert(realY >= 0 && realY < static_cast<int>(size_.y));
+        for(int cx = firstPt.x; cx <= lastPt.x; ++cx)
+        {
+            int realX = cx;
+            if(realX < 0)
+                realX += size_.x;
+            else if(realX >= static_cast<int>(size_.x))
+                realX -= size_.x;
+            RTTR_Assert(realX >= 0 && realX < static_cast<int>(size_.x));
+            for(nobBaseMilitary* milBuilding : squares[realY * size_.x + realX])
+            {
+                if(predicate(milBuilding))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
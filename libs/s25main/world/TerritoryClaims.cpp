@@ -0,0 +1,93 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "world/TerritoryClaims.h"
+#include "GamePlayer.h"
+#include "buildings/noBaseBuilding.h"
+#include "buildings/nobMilitary.h"
+#include "helpers/containerUtils.h"
+#include "world/GameWorldBase.h"
+#include "world/MapBase.h"
+#include "world/TerritoryRegion.h"
+#include "gameTypes/GO_Type.h"
+
+void TerritoryClaims::Init(const MapExtent& mapSize)
+{
+    RTTR_Assert(claims.empty()); // Already initialized
+    claims.resize(prodOfComponents(mapSize));
+}
+
+void TerritoryClaims::Clear()
+{
+    claims.clear();
+}
+
+void TerritoryClaims::Add(const MapBase& world, const noBaseBuilding& building)
+{
+    const bool isHarborSite = building.GetGOT() == GO_Type::Buildingsite;
+    world.ForEachPointInRadius(
+      building.GetPos(), building.GetMilitaryRadius(),
+      [&](const MapPoint pt, const unsigned r) {
+          std::vector<Claim>& nodeClaims = claims[world.GetIdx(pt)];
+          // On small maps a point can be reached multiple times, but only the shortest distance counts
+          const auto it = helpers::find_if(nodeClaims, [&building](const Claim& claim) {
+              return claim.building == &building;
+          });
+          if(it == nodeClaims.end())
+              nodeClaims.push_back(Claim{&building, static_cast<uint16_t>(r), isHarborSite});
+          else if(r < it->radius)
+              it->radius = static_cast<uint16_t>(r);
+      },
+      true);
+}
+
+void TerritoryClaims::Remove(const MapBase& world, const noBaseBuilding& building)
+{
+    world.ForEachPointInRadius(
+      building.GetPos(), building.GetMilitaryRadius(),
+      [&](const MapPoint pt, unsigned) {
+          helpers::erase_if(claims[world.GetIdx(pt)],
+                            [&building](const Claim& claim) { return claim.building == &building; });
+      },
+      true);
+}
+
+bool TerritoryClaims::IsBetter(const Claim& claim, const Claim& other)
+{
+    if(claim.radius != other.radius)
+        return claim.radius < other.radius;
+    // Same order as the buildings are added to the TerritoryRegion:
+    // Military buildings from the youngest to the oldest, then the harbor building sites in the order they were founded
+    if(claim.isHarborSite != other.isHarborSite)
+        return !claim.isHarborSite;
+    if(claim.isHarborSite)
+        return claim.building->GetObjId() < other.building->GetObjId();
+    return claim.building->GetObjId() > other.building->GetObjId();
+}
+
+bool TerritoryClaims::IsActive(const noBaseBuilding& building)
+{
+    // Military buildings hold territory once the first soldier arrived
+    return building.GetGOT() != GO_Type::NobMilitary || !static_cast<const nobMilitary&>(building).IsNewBuilt();
+}
+
+uint8_t TerritoryClaims::GetOwner(const GameWorldBase& world, const MapPoint pt,
+                                  const noBaseBuilding* const excludedBld) const
+{
+    const Claim* bestClaim = nullptr;
+    for(const Claim& claim : claims[world.GetIdx(pt)])
+    {
+        if(claim.building == excludedBld || (bestClaim && !IsBetter(claim, *bestClaim)) || !IsActive(*claim.building))
+            continue;
+        // The building itself is always on its territory
+        if(claim.radius > 0u)
+        {
+            const std::vector<MapPoint>& allowedArea = world.GetPlayer(claim.building->GetPlayer()).GetRestrictedArea();
+            if(!allowedArea.empty() && !TerritoryRegion::IsPointValid(world.GetSize(), allowedArea, pt))
+                continue;
+        }
+        bestClaim = &claim;
+    }
+    return bestClaim ? bestClaim->building->GetPlayer() + 1 : 0;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/MapCoordinates.h"
+#include <cstdint>
+#include <vector>
+
+class GameWorldBase;
+class MapBase;
+class noBaseBuilding;
+
+/// Claims of the military buildings (including HQs, harbors and harbor building sites from sea) on the points in their
+/// military radius. The owner of a point is the player of the closest claim, so the territory of a region can be
+/// read from here instead of adding the territory of all buildings around it to a TerritoryRegion.
+/// Claims only depend on position and radius of a building and are only added or removed when the building is.
+/// Everything else (player, occupation, restricted area) is checked when getting the owner.
+class TerritoryClaims
+{
+    struct Claim
+    {
+        const noBaseBuilding* building;
+        /// Distance of the point to the building
+        uint16_t radius;
+        bool isHarborSite;
+    };
+    /// Claims per node
+    std::vector<std::vector<Claim>> claims;
+
+    /// Return true if the claim takes precedence over the other one, i.e. the building would get the point when added
+    /// to a TerritoryRegion
+    static bool IsBetter(const Claim& claim, const Claim& other);
+    /// Return true if the building currently holds territory
+    static bool IsActive(const noBaseBuilding& building);
+
+public:
+    void Init(const MapExtent& mapSize);
+    void Clear();
+    /// Add the claims of the building to all points in its military radius
+    void Add(const MapBase& world, const noBaseBuilding& building);
+    /// Remove the claims of the building if there are any
+    void Remove(const MapBase& world, const noBaseBuilding& building);
+    /// Return the owner (player index + 1, 0 = no owner) of the point by the closest claim ignoring the excluded
+    /// building (e.g. a destroyed one).
+    /// This is the same owner as when adding the buildings to a TerritoryRegion
+    uint8_t GetOwner(const GameWorldBase& world, MapPoint pt, const noBaseBuilding* excludedBld = nullptr) const;
+};
@@ -1,11 +1,10 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "world/TerritoryRegion.h"
 #include "GamePlayer.h"
 #include "MapGeometry.h"
-#include "ReturnMapPointWithRadius.h"
 #include "buildings/noBaseBuilding.h"
 #include "buildings/nobMilitary.h"
 #include "helpers/EnumRange.h"
@@ -151,9 +150,9 @@ void TerritoryRegion::CalcTerritoryOfBuilding(const noBaseBuilding& building)
     AdjustNode(bldPos, building.GetPlayer(), 0,
                nullptr); // no need to check barriers here. this point is on our territory.
 
-    const auto pts = world.GetPointsInRadius(bldPos, radius, ReturnMapPointWithRadius{});
-    for(const auto& ptWithRadius : pts)
-        AdjustNode(ptWithRadius.first, building.GetPlayer(), ptWithRadius.second, allowedArea);
+    world.ForEachPointInRadius(bldPos, radius, [&](const MapPoint pt, const unsigned r) {
+        AdjustNode(pt, building.GetPlayer(), r, allowedArea);
+    });
 }
 
 uint8_t TerritoryRegion::SafeGetOwner(const Position& pt) const
@@ -0,0 +1,125 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "world/WalkingDistances.h"
+#include "helpers/EnumRange.h"
+#include "pathfinding/PathConditionHuman.h"
+#include "world/World.h"
+
+WalkingDistances::WalkingDistances(const unsigned maxDistance)
+    : maxDistance(maxDistance), fieldSize(2 * maxDistance + 1)
+{
+    RTTR_Assert(maxDistance < unreachable);
+}
+
+bool WalkingDistances::IsUsable(const MapExtent& mapSize) const
+{
+    return mapSize.x >= fieldSize && mapSize.y >= fieldSize;
+}
+
+void WalkingDistances::Clear()
+{
+    fields.clear();
+}
+
+bool WalkingDistances::IsReachable(const World& world, const MapPoint start, const MapPoint pt)
+{
+    RTTR_Assert(IsUsable(world.GetSize()));
+    if(pt == start)
+        return true;
+    const int idx = GetFieldIdx(world, start, pt);
+    if(idx < 0)
+        return false;
+    auto it = fields.find(world.GetIdx(start));
+    if(it == fields.end())
+    {
+        it = fields.emplace(world.GetIdx(start), Field{start, {}}).first;
+        Calculate(world, it->second);
+    }
+    return it->second.distances[idx] <= maxDistance;
+}
+
+void WalkingDistances::OnNodeChanged(const MapBase& world, const MapPoint pt)
+{
+    for(auto it = fields.begin(); it != fields.end();)
+    {
+        if(DependsOn(world, it->second, pt))
+            it = fields.erase(it);
+        else
+            ++it;
+    }
+}
+
+void WalkingDistances::OnRoadChanged(const MapBase& world, const MapPoint pt)
+{
+    const auto neighbours = world.GetNeighbours(pt);
+    for(auto it = fields.begin(); it != fields.end();)
+    {
+        // The road might be used between the point and any of its neighbours
+        bool dependsOnRoad = DependsOn(world, it->second, pt);
+        for(const MapPoint nb : neighbours)
+            dependsOnRoad = dependsOnRoad || DependsOn(world, it->second, nb);
+        if(dependsOnRoad)
+            it = fields.erase(it);
+        else
+            ++it;
+    }
+}
+
+int WalkingDistances::GetFieldIdx(const MapBase& world, const MapPoint start, const MapPoint pt) const
+{
+    const MapExtent size = world.GetSize();
+    int dx = static_cast<int>(pt.x) - start.x;
+    if(dx > size.x / 2)
+        dx -= size.x;
+    else if(dx < -(size.x / 2))
+        dx += size.x;
+    int dy = static_cast<int>(pt.y) - start.y;
+    if(dy > size.y / 2)
+        dy -= size.y;
+    else if(dy < -(size.y / 2))
+        dy += size.y;
+    const auto maxOffset = static_cast<int>(maxDistance);
+    if(dx < -maxOffset || dx > maxOffset || dy < -maxOffset || dy > maxOffset)
+        return -1;
+    return (dy + maxOffset) * static_cast<int>(fieldSize) + dx + maxOffset;
+}
+
+bool WalkingDistances::DependsOn(const MapBase& world, const Field& field, const MapPoint pt) const
+{
+    // Only points reached before the maximum distance are walked over.
+    // Points not reached at all stay unreachable as none of their neighbours is walked over
+    const int idx = GetFieldIdx(world, field.start, pt);
+    return idx >= 0 && field.distances[idx] < maxDistance;
+}
+
+void WalkingDistances::Calculate(const World& world, Field& field)
+{
+    // Breadth first search from the start point. Like the path finder all points but the start and the goal must be
+    // usable, so points which are not usable get a distance but are not walked over
+    const PathConditionHuman pathCondition(world);
+    field.distances.assign(fieldSize * fieldSize, unreachable);
+    field.distances[GetFieldIdx(world, field.start, field.start)] = 0;
+    todo.clear();
+    todo.push_back(field.start);
+    for(unsigned i = 0; i < todo.size(); i++)
+    {
+        const MapPoint curPt = todo[i];
+        const uint8_t curDistance = field.distances[GetFieldIdx(world, field.start, curPt)];
+        if(curDistance >= maxDistance || (curPt != field.start && !pathCondition.IsNodeOk(curPt)))
+            continue;
+        for(const auto dir : helpers::EnumRange<Direction>{})
+        {
+            if(!pathCondition.IsEdgeOk(curPt, dir))
+                continue;
+            const MapPoint nb = world.GetNeighbour(curPt, dir);
+            const int nbIdx = GetFieldIdx(world, field.start, nb);
+            RTTR_Assert(nbIdx >= 0);
+            if(field.distances[nbIdx] != unreachable)
+                continue;
+            field.distances[nbIdx] = curDistance + 1;
+            todo.push_back(nb);
+        }
+    }
+}
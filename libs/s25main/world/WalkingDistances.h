@@ -0,0 +1,64 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/MapCoordinates.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class MapBase;
+class World;
+
+/// Walking distances of figures from all points around some start points up to a maximum distance.
+/// Used when it is checked for many points whether figures can walk from the same start point to them, e.g. from a
+/// harbor for sea attacks or from a military building for attacks, instead of running the path finder each time.
+/// The distances around a start point are calculated on first use and dropped when an object or road close to it
+/// changes whether figures can walk there.
+class WalkingDistances
+{
+public:
+    explicit WalkingDistances(unsigned maxDistance);
+
+    unsigned GetMaxDistance() const { return maxDistance; }
+    /// Return true if the distances can be used on a map of that size.
+    /// On small maps points would be reached from multiple sides
+    bool IsUsable(const MapExtent& mapSize) const;
+
+    void Clear();
+    /// Return true if a figure can walk from the start point to the point in at most maxDistance steps.
+    /// Same as FindHumanPath(start, pt, maxDistance) (and the other way round) but usually without the path finder
+    bool IsReachable(const World& world, MapPoint start, MapPoint pt);
+    /// Figures can now walk over the point but could not before or the other way round
+    void OnNodeChanged(const MapBase& world, MapPoint pt);
+    /// A road at the point was built or removed
+    void OnRoadChanged(const MapBase& world, MapPoint pt);
+    /// Number of start points with calculated distances
+    unsigned GetNumStartPoints() const { return static_cast<unsigned>(fields.size()); }
+
+private:
+    static constexpr uint8_t unreachable = 0xFF;
+
+    struct Field
+    {
+        MapPoint start;
+        /// Distances of the points in a square around the start point
+        std::vector<uint8_t> distances;
+    };
+
+    /// Return the index of the point in the distances of the field around the start point or -1 if it is too far away
+    int GetFieldIdx(const MapBase& world, MapPoint start, MapPoint pt) const;
+    /// Return true if the distances of the field depend on whether figures can walk over the point
+    bool DependsOn(const MapBase& world, const Field& field, MapPoint pt) const;
+    void Calculate(const World& world, Field& field);
+
+    unsigned maxDistance;
+    /// Width and height of the square around a start point
+    unsigned fieldSize;
+    /// Fields by the index of their start point
+    std::unordered_map<unsigned, Field> fields;
+    /// Points to visit when calculating a field
+    std::vector<MapPoint> todo;
+};
@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -13,13 +13,17 @@
 #include "enum_cast.hpp"
 #include "helpers/containerUtils.h"
 #include "helpers/pointerContainerUtils.h"
+#include "pathfinding/PathConditionHuman.h"
 #include "gameTypes/ShipDirection.h"
+#include "gameData/MilitaryConsts.h"
 #include "gameData/TerrainDesc.h"
 #include <memory>
 #include <set>
 #include <stdexcept>
 
-World::World() : noNodeObj(nullptr) {}
+World::World()
+    : noNodeObj(nullptr), seaAttackDistances(SEAATTACK_DISTANCE), attackDistances(MAX_ATTACKING_RUN_DISTANCE)
+{}
 
 World::~World()
 {
@@ -79,10 +83,15 @@ void World::Resize(const MapExtent& newSize)
     MapBase::Resize(newSize);
     nodes.clear();
     militarySquares.Clear();
+    territoryClaims.Clear();
+    shipRouteTable.Clear();
+    seaAttackDistances.Clear();
+    attackDistances.Clear();
     if(GetSize().x > 0)
     {
         nodes.resize(prodOfComponents(GetSize()));
         militarySquares.Init(GetSize());
+        territoryClaims.Init(GetSize());
     }
 }
 
@@ -107,6 +116,16 @@ noBase* World::RemoveFigureImpl(const MapPoint pt, noBase& fig)
     return helpers::extractPtr(GetNodeInt(pt).figures, &fig).release();
 }
 
+void World::MoveFigure(const MapPoint from, const MapPoint to, noBase& fig)
+{
+    auto& oldFigures = GetNodeInt(from).figures;
+    auto& newFigures = GetNodeInt(to).figures;
+    const auto it = helpers::findPtr(oldFigures, &fig);
+    RTTR_Assert(it != oldFigures.end());
+    RTTR_Assert(!helpers::containsPtr(newFigures, &fig));
+    newFigures.splice(newFigures.end(), oldFigures, it);
+}
+
 noBase* World::GetNO(const MapPoint pt)
 {
     if(GetNode(pt).obj)
@@ -129,7 +148,13 @@ void World::SetNO(const MapPoint pt, noBase* obj, const bool replace /* = false*
 #if RTTR_ENABLE_ASSERTS
     RTTR_Assert(!dynamic_cast<noMovable*>(obj)); // It should be a static, non-movable object
 #endif
+    const bool wasPassable = PathConditionHuman::IsPassable(GetNode(pt).obj);
     GetNodeInt(pt).obj = obj;
+    if(PathConditionHuman::IsPassable(obj) != wasPassable)
+    {
+        seaAttackDistances.OnNodeChanged(*this, pt);
+        attackDistances.OnNodeChanged(*this, pt);
+    }
 }
 
 void World::DestroyNO(const MapPoint pt, const bool checkExists /* = true*/)
@@ -140,6 +165,11 @@ void World::DestroyNO(const MapPoint pt, const bool checkExists /* = true*/)
         // Destroy may remove the NO already from the map or replace it (e.g. building -> fire)
         // So remove from map, then destroy and free
         GetNodeInt(pt).obj = nullptr;
+        if(!PathConditionHuman::IsPassable(obj))
+        {
+            seaAttackDistances.OnNodeChanged(*this, pt);
+            attackDistances.OnNodeChanged(*this, pt);
+        }
         obj->Destroy();
         deletePtr(obj);
     } else
@@ -455,7 +485,13 @@ SeaId World::GetSeaFromCoastalPoint(const MapPoint pt) const
 
 void World::SetRoad(const MapPoint pt, RoadDir roadDir, PointRoad type)
 {
-    GetNodeInt(pt).roads[roadDir] = type;
+    PointRoad& road = GetNodeInt(pt).roads[roadDir];
+    if(PathConditionHuman::IsUsableRoad(road) != PathConditionHuman::IsUsableRoad(type))
+    {
+        seaAttackDistances.OnRoadChanged(*this, pt);
+        attackDistances.OnRoadChanged(*this, pt);
+    }
+    road = type;
 }
 
 bool World::SetBQ(const MapPoint pt, BuildingQuality bq)
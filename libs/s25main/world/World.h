@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -7,8 +7,11 @@
 #include "enum_cast.hpp"
 #include "helpers/PtrSpan.h"
 #include "helpers/StrongIdVector.h"
+#include "pathfinding/ShipRouteTable.h"
 #include "world/MapBase.h"
 #include "world/MilitarySquares.h"
+#include "world/TerritoryClaims.h"
+#include "world/WalkingDistances.h"
 #include "gameTypes/Direction.h"
 #include "gameTypes/GO_Type.h"
 #include "gameTypes/HarborPos.h"
@@ -70,6 +73,14 @@ class World : public MapBase
 protected:
     /// harbor building sites created by ships
     std::list<noBuildingSite*> harbor_building_sites_from_sea;
+    /// Territory claims of all military buildings and harbor building sites from sea
+    TerritoryClaims territoryClaims;
+    /// Routes of ships between harbors
+    ShipRouteTable shipRouteTable;
+    /// Walking distances to harbors for sea attacks
+    mutable WalkingDistances seaAttackDistances;
+    /// Walking distances from military buildings to their attack targets
+    mutable WalkingDistances attackDistances;
 
 public:
     /// Currently flying catapult stones
@@ -86,6 +97,9 @@ public:
 
     /// Return the type of the landscape
     DescIdx<LandscapeDesc> GetLandscapeType() const { return lt; }
+    const TerritoryClaims& GetTerritoryClaims() const { return territoryClaims; }
+    const ShipRouteTable& GetShipRouteTable() const { return shipRouteTable; }
+    ShipRouteTable& GetShipRouteTable() { return shipRouteTable; }
 
     const WorldDescription& GetDescription() const { return description_; }
     WorldDescription& GetDescriptionWriteable() { return description_; }
@@ -108,6 +122,9 @@ public:
     }
     template<typename T>
     std::unique_ptr<T> RemoveFigure(MapPoint pt, T*& fig) = delete;
+    /// Move a figure from one node to the end of the figure list of another node.
+    /// Same as removing and adding it again but without allocating memory
+    void MoveFigure(MapPoint from, MapPoint to, noBase& fig);
     /// Return the NO from that point or a "nothing"-object if there is none
     noBase* GetNO(MapPoint pt);
     /// Return the NO from that point or a "nothing"-object if there is none
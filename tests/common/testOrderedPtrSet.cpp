@@ -0,0 +1,160 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "helpers/OrderedPtrSet.h"
+#include "helpers/containerUtils.h"
+#include <boost/test/unit_test.hpp>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+struct TestObject
+{
+    int value;
+};
+
+template<class T>
+std::vector<TestObject*> toVector(const T& container)
+{
+    return std::vector<TestObject*>(container.begin(), container.end());
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(OrderedPtrSetSuite)
+
+BOOST_AUTO_TEST_CASE(KeepsInsertionOrder)
+{
+    std::vector<TestObject> objects(5);
+    helpers::OrderedPtrSet<TestObject> set;
+    BOOST_TEST(set.empty());
+    BOOST_TEST(set.size() == 0u);
+    BOOST_TEST((set.begin() == set.end()));
+
+    for(int i : {3, 1, 4, 0, 2})
+        set.push_back(&objects[i]);
+    BOOST_TEST(set.size() == 5u);
+    BOOST_TEST(set.front() == &objects[3]);
+    BOOST_TEST(set.back() == &objects[2]);
+    const std::vector<TestObject*> expected{&objects[3], &objects[1], &objects[4], &objects[0], &objects[2]};
+    BOOST_TEST(toVector(set) == expected, boost::test_tools::per_element());
+    BOOST_TEST(helpers::indexOf(set, &objects[4]) == 2);
+
+    // Iterate backwards
+    auto it = set.end();
+    for(auto itExp = expected.rbegin(); itExp != expected.rend(); ++itExp)
+        BOOST_TEST(*--it == *itExp);
+    BOOST_TEST((it == set.begin()));
+
+    for(TestObject& obj : objects)
+    {
+        BOOST_TEST(set.contains(&obj));
+        BOOST_TEST(helpers::contains(set, &obj));
+        BOOST_TEST(*set.find(&obj) == &obj);
+    }
+    const TestObject other{};
+    BOOST_TEST(!set.contains(&other));
+    BOOST_TEST((set.find(&other) == set.end()));
+
+    set.clear();
+    BOOST_TEST(set.empty());
+    BOOST_TEST((set.begin() == set.end()));
+    set.push_back(&objects[1]);
+    BOOST_TEST(toVector(set) == std::vector<TestObject*>{&objects[1]}, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RemoveKeepsOrder)
+{
+    std::vector<TestObject> objects(5);
+    helpers::OrderedPtrSet<TestObject> set;
+    for(TestObject& obj : objects)
+        set.push_back(&obj);
+
+    set.remove(&objects[2]);
+    BOOST_TEST(!set.contains(&objects[2]));
+    BOOST_TEST(toVector(set) == (std::vector<TestObject*>{&objects[0], &objects[1], &objects[3], &objects[4]}),
+               boost::test_tools::per_element());
+    // Not contained -> Nothing happens
+    set.remove(&objects[2]);
+    BOOST_TEST(set.size() == 4u);
+
+    // Removing front and back
+    set.remove(&objects[0]);
+    set.remove(&objects[4]);
+    BOOST_TEST(set.front() == &objects[1]);
+    BOOST_TEST(set.back() == &objects[3]);
+
+    // Freed slots are reused but readded elements are at the end
+    set.push_back(&objects[0]);
+    set.push_back(&objects[2]);
+    BOOST_TEST(toVector(set) == (std::vector<TestObject*>{&objects[1], &objects[3], &objects[0], &objects[2]}),
+               boost::test_tools::per_element());
+
+    // Erase returns the next element
+    auto it = set.erase(set.find(&objects[3]));
+    BOOST_TEST(*it == &objects[0]);
+    it = set.erase(set.find(&objects[2]));
+    BOOST_TEST((it == set.end()));
+    BOOST_TEST(toVector(set) == (std::vector<TestObject*>{&objects[1], &objects[0]}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(ModifyWhileIterating)
+{
+    std::vector<TestObject> objects(6);
+    helpers::OrderedPtrSet<TestObject> set;
+    for(unsigned i = 0; i < 4; i++)
+        set.push_back(&objects[i]);
+
+    std::vector<TestObject*> visited;
+    for(TestObject* obj : set)
+    {
+        visited.push_back(obj);
+        // Remove an element not yet visited and add new ones which get visited
+        if(obj == &objects[0])
+        {
+            set.remove(&objects[2]);
+            set.push_back(&objects[4]);
+        } else if(obj == &objects[4])
+            set.push_back(&objects[5]);
+    }
+    BOOST_TEST(visited == (std::vector<TestObject*>{&objects[0], &objects[1], &objects[3], &objects[4], &objects[5]}),
+               boost::test_tools::per_element());
+
+    // Erase while iterating
+    for(auto it = set.begin(); it != set.end();)
+    {
+        if(*it == &objects[1] || *it == &objects[5])
+            it = set.erase(it);
+        else
+            ++it;
+    }
+    BOOST_TEST(toVector(set) == (std::vector<TestObject*>{&objects[0], &objects[3], &objects[4]}),
+               boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(SameOrderAsList)
+{
+    std::vector<TestObject> objects(100);
+    helpers::OrderedPtrSet<TestObject> set;
+    std::list<TestObject*> list;
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<size_t> distr(0, objects.size() - 1);
+    for(unsigned i = 0; i < 1000; i++)
+    {
+        TestObject* obj = &objects[distr(rng)];
+        if(set.contains(obj))
+        {
+            set.remove(obj);
+            list.remove(obj);
+        } else
+        {
+            set.push_back(obj);
+            list.push_back(obj);
+        }
+        BOOST_TEST_REQUIRE(set.size() == list.size());
+    }
+    BOOST_TEST(toVector(set) == toVector(list), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,10 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+namespace rttr::test {
+/// Return the number of allocations by the global operator new since the start of the program
+unsigned getNumAllocations();
+} // namespace rttr::test
@@ -0,0 +1,47 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#define BOOST_TEST_MODULE RTTR_Allocations
+
+#include "AllocationCounter.h"
+#include "AllocationStatistics.h"
+#include <rttr/test/Fixture.hpp>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<unsigned> numAllocations(0);
+} // namespace
+
+unsigned rttr::test::getNumAllocations()
+{
+    return numAllocations;
+}
+
+// All other allocation functions (array, nothrow) forward to these by default
+void* operator new(std::size_t size)
+{
+    ++numAllocations;
+    AllocationStatistics::onAllocation(size);
+    if(void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+struct Fixture : rttr::test::Fixture
+{};
+
+BOOST_GLOBAL_FIXTURE(Fixture);
@@ -0,0 +1,101 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AllocationStatistics.h"
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(AllocationStatisticsSuite)
+
+namespace {
+struct AllocationStatisticsFixture
+{
+    std::ostringstream csv;
+    AllocationStatisticsFixture() { AllocationStatistics::enable(true, &csv); }
+    ~AllocationStatisticsFixture() { AllocationStatistics::enable(false); }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(CountsAllocationsOfInnermostScope, AllocationStatisticsFixture)
+{
+    std::unique_ptr<char[]> outerData, innerData;
+    {
+        const AllocationScope aiScope(AllocationTag::AI);
+        outerData = std::make_unique<char[]>(100);
+        {
+            const AllocationScope pathfindingScope(AllocationTag::Pathfinding);
+            innerData = std::make_unique<char[]>(200);
+        }
+    }
+    AllocationStatistics::onGFFinished(42);
+    const auto& entry = AllocationStatistics::getLastGFEntry();
+    BOOST_TEST(entry.gf == 42u);
+    BOOST_TEST(entry.counters[AllocationTag::AI].numAllocations == 1u);
+    BOOST_TEST(entry.counters[AllocationTag::AI].numBytes == 100u);
+    BOOST_TEST(entry.counters[AllocationTag::Pathfinding].numAllocations == 1u);
+    BOOST_TEST(entry.counters[AllocationTag::Pathfinding].numBytes == 200u);
+    BOOST_TEST(entry.counters[AllocationTag::Events].numAllocations == 0u);
+    BOOST_TEST(entry.counters[AllocationTag::Serialization].numAllocations == 0u);
+
+    // Counters are reset for each GF
+    AllocationStatistics::onGFFinished(43);
+    BOOST_TEST(entry.gf == 43u);
+    BOOST_TEST(entry.counters[AllocationTag::AI].numAllocations == 0u);
+    const auto& total = AllocationStatistics::getTotal();
+    BOOST_TEST(total[AllocationTag::AI].numBytes == 100u);
+    BOOST_TEST(total[AllocationTag::Pathfinding].numBytes == 200u);
+
+    std::istringstream lines(csv.str());
+    std::string line;
+    std::getline(lines, line);
+    BOOST_TEST(line
+               == "GF,PeakRSS,OtherAllocations,OtherBytes,EventsAllocations,EventsBytes,PathfindingAllocations,"
+                  "PathfindingBytes,AIAllocations,AIBytes,SerializationAllocations,SerializationBytes");
+    std::getline(lines, line);
+    BOOST_TEST(line.substr(0, 3) == "42,");
+    BOOST_TEST(line.find(",0,0,1,200,1,100,0,0") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(NothingCountedWhenDisabled)
+{
+    AllocationStatistics::enable(false);
+    const auto data = std::make_unique<char[]>(100);
+    AllocationStatistics::onGFFinished(1);
+    BOOST_TEST(AllocationStatistics::getLastGFEntry().gf == 0u);
+    BOOST_TEST(AllocationStatistics::getTotal()[AllocationTag::Other].numAllocations == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(WritesLineForEachGF, AllocationStatisticsFixture)
+{
+    for(unsigned gf = 1; gf <= 10; gf++)
+    {
+        std::unique_ptr<char[]> data;
+        {
+            const AllocationScope aiScope(AllocationTag::AI);
+            data = std::make_unique<char[]>(gf);
+        }
+        AllocationStatistics::onGFFinished(gf);
+    }
+    BOOST_TEST(AllocationStatistics::getLastGFEntry().peakRSS > 0u);
+    BOOST_TEST(AllocationStatistics::getTotal()[AllocationTag::AI].numAllocations == 10u);
+    BOOST_TEST(AllocationStatistics::getTotal()[AllocationTag::AI].numBytes == 55u);
+
+    std::istringstream lines(csv.str());
+    std::string line;
+    std::getline(lines, line);
+    for(unsigned gf = 1; gf <= 10; gf++)
+    {
+        BOOST_TEST_REQUIRE(std::getline(lines, line).good());
+        BOOST_TEST(line.substr(0, line.find(',')) == std::to_string(gf));
+        // AI and serialization are the last columns
+        const std::string lastColumns = ",1," + std::to_string(gf) + ",0,0";
+        BOOST_TEST_REQUIRE(line.size() > lastColumns.size());
+        BOOST_TEST(line.substr(line.size() - lastColumns.size()) == lastColumns);
+    }
+    BOOST_TEST(!std::getline(lines, line));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
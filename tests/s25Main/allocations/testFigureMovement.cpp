@@ -0,0 +1,89 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AllocationCounter.h"
+#include "GamePlayer.h"
+#include "RttrForeachPt.h"
+#include "buildings/nobBaseMilitary.h"
+#include "figures/nofAttacker.h"
+#include "figures/nofPassiveSoldier.h"
+#include "figures/nofScout_Free.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "worldFixtures/WorldFixture.h"
+#include "worldFixtures/initGameRNG.hpp"
+#include "nodeObjs/noAnimal.h"
+#include <boost/test/unit_test.hpp>
+#include <memory>
+
+BOOST_AUTO_TEST_SUITE(FigureMovementAllocations)
+
+namespace {
+using EmptyWorldFixture = WorldFixture<CreateEmptyWorld, 0, 32, 32>;
+using EmptyWorldFixture2P = WorldFixture<CreateEmptyWorld, 2, 96, 96>;
+
+unsigned countFigures(const GameWorld& world)
+{
+    unsigned numFigures = 0;
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
+        numFigures += static_cast<unsigned>(world.GetFigures(pt).size());
+    return numFigures;
+}
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(WalkingAnimalsDoNotAllocate, EmptyWorldFixture)
+{
+    initGameRNG();
+    unsigned numAnimals = 0;
+    for(MapCoord y = 2; y < world.GetHeight(); y += 8)
+    {
+        for(MapCoord x = 2; x < world.GetWidth(); x += 8)
+        {
+            const MapPoint pt(x, y);
+            world.AddFigure(pt, std::make_unique<noAnimal>(Species::Deer, pt)).StartLiving();
+            numAnimals++;
+        }
+    }
+    // Let the animals walk for a while, so the storage of events and the RNG log can be reused afterwards
+    RTTR_SKIP_GFS(5000);
+    const unsigned numAllocationsBefore = rttr::test::getNumAllocations();
+    RTTR_SKIP_GFS(20000);
+    const unsigned numAllocations = rttr::test::getNumAllocations() - numAllocationsBefore;
+    BOOST_TEST(numAllocations == 0u);
+    // All animals are still walking around
+    BOOST_TEST(countFigures(world) == numAnimals);
+}
+
+BOOST_FIXTURE_TEST_CASE(WalkingScoutsAndSoldiersDoNotAllocate, EmptyWorldFixture2P)
+{
+    initGameRNG();
+    auto& enemyHQ = *world.GetSpecObj<nobBaseMilitary>(world.GetPlayer(1).GetHQPos());
+    // Wandering scouts and attackers of player 0 far away from the HQs (at y=48), i.e. from any flag they could walk
+    // to or any object leaving their sight. Each of their steps recalculates the visibility at the edge of their sight
+    unsigned numFigures = 0;
+    for(MapCoord x = 4; x < world.GetWidth(); x += 8)
+    {
+        const MapPoint scoutPos(x, 8);
+        auto& scout = world.AddFigure(scoutPos, std::make_unique<nofScout_Free>(scoutPos, 0, nullptr));
+        scout.StartWandering();
+        scout.ActAtFirst();
+
+        // Attacker which lost its home building on the way to the enemy
+        const MapPoint soldierPos(x, 16);
+        const nofPassiveSoldier soldier(soldierPos, 0, nullptr, nullptr, 0);
+        auto attacker = std::make_unique<nofAttacker>(soldier, enemyHQ);
+        attacker->InformTargetsAboutCancelling();
+        attacker->StartWandering();
+        world.AddFigure(soldierPos, std::move(attacker)).ActAtFirst();
+        numFigures += 2;
+    }
+    // Figures wander at least 3 times 20 steps (20 GFs each) before they give up and die, so measure less than that
+    RTTR_SKIP_GFS(200);
+    const unsigned numAllocationsBefore = rttr::test::getNumAllocations();
+    RTTR_SKIP_GFS(600);
+    const unsigned numAllocations = rttr::test::getNumAllocations() - numAllocationsBefore;
+    BOOST_TEST(numAllocations == 0u);
+    BOOST_TEST(countFigures(world) == numFigures);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AllocationCounter.h"
+#include "AllocationStatistics.h"
+#include "GameObjectPool.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "worldFixtures/WorldFixture.h"
+#include "nodeObjs/noNothing.h"
+#include <boost/test/unit_test.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+BOOST_AUTO_TEST_SUITE(GameObjectPoolTests)
+
+namespace {
+using EmptyWorldFixture = WorldFixture<CreateEmptyWorld, 0, 10, 10>;
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(ObjectsOfSameTypeAreContiguous, EmptyWorldFixture)
+{
+    std::vector<std::unique_ptr<noNothing>> objects;
+    for(unsigned i = 0; i < 100; i++)
+        objects.push_back(std::make_unique<noNothing>());
+    for(unsigned i = 1; i < objects.size(); i++)
+    {
+        const auto* prevObj = reinterpret_cast<const std::byte*>(objects[i - 1].get());
+        const auto* curObj = reinterpret_cast<const std::byte*>(objects[i].get());
+        BOOST_TEST_REQUIRE(curObj > prevObj);
+        BOOST_TEST(static_cast<size_t>(curObj - prevObj) < sizeof(noNothing) + alignof(std::max_align_t));
+    }
+
+    // Memory of destroyed objects is reused without allocating
+    const unsigned numAllocationsBefore = rttr::test::getNumAllocations();
+    const noNothing* oldObj = objects[42].get();
+    objects[42].reset();
+    objects[42] = std::make_unique<noNothing>();
+    BOOST_TEST(objects[42].get() == oldObj);
+    objects.clear();
+    for(unsigned i = 0; i < 100; i++)
+        objects.push_back(std::make_unique<noNothing>());
+    BOOST_TEST(rttr::test::getNumAllocations() - numAllocationsBefore == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(SlabsAreFreedWithLastObject)
+{
+    BOOST_TEST_REQUIRE(GameObjectPool::getNumObjects() == 0u);
+    BOOST_TEST(GameObjectPool::getNumSlabs() == 0u);
+    {
+        EmptyWorldFixture fixture;
+        std::vector<std::unique_ptr<noNothing>> objects;
+        for(unsigned i = 0; i < 10000; i++)
+            objects.push_back(std::make_unique<noNothing>());
+        BOOST_TEST(GameObjectPool::getNumObjects() > objects.size());
+        BOOST_TEST(GameObjectPool::getNumSlabs() > 1u);
+    }
+    BOOST_TEST(GameObjectPool::getNumObjects() == 0u);
+    BOOST_TEST(GameObjectPool::getNumSlabs() == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(StatisticsCountOnlySlabs, EmptyWorldFixture)
+{
+    std::vector<std::unique_ptr<noNothing>> objects;
+    objects.reserve(10000);
+    AllocationStatistics::enable(true);
+    const size_t numSlabs = GameObjectPool::getNumSlabs();
+    // No checks in the loop as they might allocate
+    while(GameObjectPool::getNumSlabs() < numSlabs + 2u && objects.size() < objects.capacity())
+        objects.push_back(std::make_unique<noNothing>());
+    AllocationStatistics::onGFFinished(1);
+    AllocationStatistics::enable(false);
+    BOOST_TEST_REQUIRE(GameObjectPool::getNumSlabs() == numSlabs + 2u);
+    const auto& counters = AllocationStatistics::getLastGFEntry().counters[AllocationTag::Other];
+    BOOST_TEST(counters.numAllocations < objects.size());
+    // The slabs hold all new objects
+    BOOST_TEST(counters.numBytes >= objects.size() * sizeof(noNothing));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,82 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "buildings/nobBaseMilitary.h"
+#include "buildings/nobMilitary.h"
+#include "ogl/glAllocator.h"
+#include "world/GameWorld.h"
+#include "gameTypes/GO_Type.h"
+#include "gameData/MilitaryConsts.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace {
+/// Pairs of military buildings and enemy buildings close enough to be attacked from them
+std::vector<std::pair<MapPoint, MapPoint>> getAttackCandidates(const GameWorld& world)
+{
+    std::vector<std::pair<MapPoint, MapPoint>> result;
+    const auto buildings = world.LookForMilitaryBuildings(MapPoint(0, 0), std::numeric_limits<unsigned short>::max());
+    for(const nobBaseMilitary* bld : buildings)
+    {
+        if(bld->GetGOT() != GO_Type::NobMilitary)
+            continue;
+        for(const nobBaseMilitary* target : buildings)
+        {
+            if(target->GetPlayer() != bld->GetPlayer()
+               && world.CalcDistance(bld->GetPos(), target->GetPos()) <= MAX_ATTACKING_RUN_DISTANCE)
+                result.emplace_back(bld->GetPos(), target->GetPos());
+        }
+    }
+    return result;
+}
+} // namespace
+
+/// Checking whether soldiers can walk from military buildings to enemy buildings as done for every attack and by the
+/// AI when looking for attack targets. The AI players of the replay are in contact with each other after the given
+/// number of GFs. A few GFs are run between the iterations so objects and roads change as in a running game.
+/// Argument 0 runs the path finder for every check as done without stored distances, argument 1 uses the distances
+/// stored in the world
+static void BM_AttackReachability(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    benchmarkHelpers::ReplayGame replayGame;
+    if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    replayGame.runGFs(static_cast<unsigned>(state.range(0)));
+    const GameWorld& world = replayGame.game->world_;
+    const bool useStoredDistances = state.range(1) != 0;
+
+    size_t numChecks = 0;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        replayGame.runGFs(20);
+        const auto candidates = getAttackCandidates(world);
+        state.ResumeTiming();
+        for(const auto& candidate : candidates)
+        {
+            if(useStoredDistances)
+                benchmark::DoNotOptimize(world.IsReachableForAttack(candidate.first, candidate.second));
+            else
+                benchmark::DoNotOptimize(
+                  world.FindHumanPath(candidate.first, candidate.second, MAX_ATTACKING_RUN_DISTANCE));
+        }
+        numChecks += candidates.size();
+    }
+    state.SetItemsProcessed(numChecks);
+}
+BENCHMARK(BM_AttackReachability)
+  ->Args({150000, 0})
+  ->Args({150000, 1})
+  ->Iterations(200)
+  ->Unit(benchmark::kMillisecond);
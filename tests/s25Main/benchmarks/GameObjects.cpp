@@ -0,0 +1,98 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "GameObjectPool.h"
+#include "GlobalGameSettings.h"
+#include "SerializedGameData.h"
+#include "ogl/glAllocator.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+/// Savegame of the long replay after some GFs, i.e. with a large number of game objects
+struct LateGameSnapshot
+{
+    GlobalGameSettings ggs;
+    std::vector<PlayerInfo> players;
+    std::vector<char> data;
+    /// Used by the loaded games
+    benchmarkHelpers::LocalGameState localGameState;
+
+    bool create(const unsigned numGFs)
+    {
+        benchmarkHelpers::ReplayGame replayGame;
+        if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+            return false;
+        replayGame.runGFs(numGFs);
+        SerializedGameData sgd;
+        sgd.MakeSnapshot(*replayGame.game);
+        ggs = replayGame.replay.ggs;
+        for(unsigned i = 0; i < replayGame.replay.GetNumPlayers(); i++)
+            players.emplace_back(replayGame.replay.GetPlayer(i));
+        data.assign(sgd.GetData(), sgd.GetData() + sgd.GetLength());
+        return true;
+    }
+
+    std::unique_ptr<Game> load()
+    {
+        SerializedGameData sgd;
+        sgd.PushRawData(data.data(), data.size());
+        auto game = std::make_unique<Game>(ggs, /*startGF*/ 0, players);
+        sgd.ReadSnapshot(*game, localGameState);
+        game->world_.InitAfterLoad();
+        return game;
+    }
+};
+} // namespace
+
+/// Loading a savegame with many game objects, i.e. the time to create all objects.
+/// See BM_LateGameGFs for the time of running GFs with those objects
+static void BM_LoadLateGame(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    LateGameSnapshot snapshot;
+    if(!snapshot.create(static_cast<unsigned>(state.range(0))))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    size_t numSlabs = 0;
+    for(auto _ : state)
+    {
+        auto game = snapshot.load();
+        state.PauseTiming();
+        numSlabs = GameObjectPool::getNumSlabs();
+        game.reset();
+        state.ResumeTiming();
+    }
+    state.counters["Slabs"] = static_cast<double>(numSlabs);
+}
+BENCHMARK(BM_LoadLateGame)->Arg(50000)->Iterations(10)->Unit(benchmark::kMillisecond);
+
+/// Destroying a game with many game objects as done when a game ends
+static void BM_TeardownLateGame(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    LateGameSnapshot snapshot;
+    if(!snapshot.create(static_cast<unsigned>(state.range(0))))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto game = snapshot.load();
+        state.ResumeTiming();
+        game.reset();
+    }
+}
+BENCHMARK(BM_TeardownLateGame)->Arg(50000)->Iterations(10)->Unit(benchmark::kMillisecond);
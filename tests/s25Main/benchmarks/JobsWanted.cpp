@@ -0,0 +1,103 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Game.h"
+#include "GamePlayer.h"
+#include "GlobalGameSettings.h"
+#include "PlayerInfo.h"
+#include "RttrForeachPt.h"
+#include "buildings/nobBaseWarehouse.h"
+#include "factories/BuildingFactory.h"
+#include "helpers/EnumRange.h"
+#include "lua/GameDataLoader.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "gameTypes/GoodsAndPeopleArray.h"
+#include "gameData/TerrainDesc.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+namespace {
+/// Buildings whose workers need a tool
+constexpr std::array<BuildingType, 8> bldTypes = {
+  BuildingType::Woodcutter, BuildingType::Forester, BuildingType::Quarry,         BuildingType::Fishery,
+  BuildingType::Hunter,     BuildingType::Farm,     BuildingType::Slaughterhouse, BuildingType::Sawmill};
+
+/// Game with an economy blocked on tools: The HQ has only helpers and there are numBuildings buildings waiting for
+/// their workers. The buildings are not connected, so only the handling of the requests is measured
+std::shared_ptr<Game> createGame(unsigned numBuildings)
+{
+    PlayerInfo player;
+    player.ps = PlayerState::Occupied;
+    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, std::vector<PlayerInfo>(1, player));
+    GameWorld& world = game->world_;
+    loadGameData(world.GetDescriptionWriteable());
+
+    const auto numCols = static_cast<unsigned>(std::ceil(std::sqrt(numBuildings)));
+    const unsigned numRows = (numBuildings + numCols - 1) / numCols;
+    const MapExtent size(numCols * 4 + 8, numRows * 4 + 16);
+    world.Init(size);
+    const auto t = world.GetDescription().terrain.find(
+      [](const TerrainDesc& desc) { return desc.kind == TerrainKind::Land && desc.Is(ETerrain::Buildable); });
+    RTTR_FOREACH_PT(MapPoint, size)
+    {
+        MapNode& node = world.GetNodeWriteable(pt);
+        node.t1 = node.t2 = t;
+    }
+    if(!MapLoader::PlaceHQs(world, {MapPoint(size.x / 2, 4)}, false))
+        return nullptr;
+    world.InitAfterLoad();
+
+    for(unsigned i = 0; i < numBuildings; i++)
+    {
+        const MapPoint pt(2 + (i % numCols) * 4, 12 + (i / numCols) * 4);
+        BuildingFactory::CreateBuilding(world, bldTypes[i % bldTypes.size()], pt, 0, Nation::Romans);
+    }
+    PeopleCounts people;
+    people[Job::Helper] = 50;
+    world.GetPlayer(0).GetFirstWH()->AddToInventory(people, true);
+    return game;
+}
+} // namespace
+
+/// Checking all jobs after new figures or tools arrived in a warehouse, as done for each incoming tool
+static void BM_FindWarehouseForJobs(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createGame(static_cast<unsigned>(state.range(0)));
+    if(!game)
+    {
+        state.SkipWithError("Failed to create world");
+        return;
+    }
+    GamePlayer& player = game->world_.GetPlayer(0);
+    for(auto _ : state)
+    {
+        for(const auto job : helpers::EnumRange<Job>{})
+            player.FindWarehouseForAllJobs(job);
+    }
+    state.SetItemsProcessed(state.iterations() * helpers::NumEnumValues_v<Job>);
+}
+BENCHMARK(BM_FindWarehouseForJobs)->Range(64, 4 << 10);
+
+/// Checking all jobs after e.g. a new road was built
+static void BM_FindWarehouseForAllJobs(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = createGame(static_cast<unsigned>(state.range(0)));
+    if(!game)
+    {
+        state.SkipWithError("Failed to create world");
+        return;
+    }
+    GamePlayer& player = game->world_.GetPlayer(0);
+    for(auto _ : state)
+        player.FindWarehouseForAllJobs();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FindWarehouseForAllJobs)->Range(64, 4 << 10);
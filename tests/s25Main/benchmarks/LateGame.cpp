@@ -0,0 +1,115 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "helpers/OrderedPtrSet.h"
+#include "ogl/glAllocator.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <random>
+#include <vector>
+
+/// Time for GFs of a game with a large economy, i.e. many buildings, roads, wares and figures
+static void BM_LateGameGFs(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    const auto startGF = static_cast<unsigned>(state.range(0));
+    constexpr unsigned numGFs = 2000;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto replayGame = std::make_unique<benchmarkHelpers::ReplayGame>();
+        if(!replayGame->load(benchmarkHelpers::getLongReplayPath()))
+        {
+            state.SkipWithError("Failed to load replay");
+            return;
+        }
+        replayGame->runGFs(startGF);
+        state.ResumeTiming();
+
+        replayGame->runGFs(numGFs);
+
+        state.PauseTiming();
+        replayGame.reset();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * numGFs);
+}
+BENCHMARK(BM_LateGameGFs)->Arg(10000)->Arg(50000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+namespace {
+struct Object
+{
+    unsigned value;
+};
+
+struct Objects
+{
+    std::vector<Object> objects;
+    /// Objects in the order they are added to the register
+    std::vector<Object*> addOrder;
+
+    explicit Objects(unsigned numObjects) : objects(numObjects)
+    {
+        std::mt19937 rng(42);
+        for(Object& obj : objects)
+        {
+            obj.value = rng() % 100;
+            addOrder.push_back(&obj);
+        }
+        std::shuffle(addOrder.begin(), addOrder.end(), rng);
+    }
+};
+
+template<class T_Register>
+void addAll(T_Register& reg, const std::vector<Object*>& objects)
+{
+    for(Object* obj : objects)
+        reg.push_back(obj);
+}
+} // namespace
+
+/// Iterating over all objects in a register like the buildings of a player
+template<class T_Register>
+static void BM_RegisterIterate(benchmark::State& state)
+{
+    const Objects objects(state.range(0));
+    T_Register reg;
+    addAll(reg, objects.addOrder);
+    for(auto _ : state)
+    {
+        unsigned sum = 0;
+        for(const Object* obj : reg)
+            sum += obj->value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RegisterIterate, std::list<Object*>)->Range(64, 16 << 10);
+BENCHMARK_TEMPLATE(BM_RegisterIterate, helpers::OrderedPtrSet<Object>)->Range(64, 16 << 10);
+
+/// Removing all objects in random order and adding them again, like wares being created and consumed
+template<class T_Register>
+static void BM_RegisterAddRemove(benchmark::State& state)
+{
+    const Objects objects(state.range(0));
+    std::vector<Object*> removeOrder = objects.addOrder;
+    std::shuffle(removeOrder.begin(), removeOrder.end(), std::mt19937(1337));
+    T_Register reg;
+    addAll(reg, objects.addOrder);
+    for(auto _ : state)
+    {
+        for(Object* obj : removeOrder)
+            reg.remove(obj);
+        addAll(reg, objects.addOrder);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RegisterAddRemove, std::list<Object*>)->Range(64, 4 << 10);
+BENCHMARK_TEMPLATE(BM_RegisterAddRemove, helpers::OrderedPtrSet<Object>)->Range(64, 4 << 10);
@@ -0,0 +1,100 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "RttrForeachPt.h"
+#include "helpers/EnumRange.h"
+#include "world/MapBase.h"
+#include <benchmark/benchmark.h>
+
+namespace {
+MapBase createMap()
+{
+    MapBase map;
+    map.Resize(MapExtent(256, 256));
+    return map;
+}
+} // namespace
+
+/// Neighbours of all points in all directions, including the wrapping at the map borders
+static void BM_GetNeighbour(benchmark::State& state)
+{
+    const MapBase map = createMap();
+    for(auto _ : state)
+    {
+        RTTR_FOREACH_PT(MapPoint, map.GetSize())
+        {
+            for(const auto dir : helpers::EnumRange<Direction>{})
+                benchmark::DoNotOptimize(map.GetNeighbour(pt, dir));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * map.GetSize().x * map.GetSize().y
+                            * helpers::NumEnumValues_v<Direction>);
+}
+BENCHMARK(BM_GetNeighbour);
+
+/// Points in the radius around every 7th point, returned as a vector
+static void BM_GetPointsInRadius(benchmark::State& state)
+{
+    const MapBase map = createMap();
+    const auto radius = static_cast<unsigned>(state.range(0));
+    unsigned numPts = 0;
+    for(auto _ : state)
+    {
+        for(unsigned i = 0; i < map.GetSize().x * map.GetSize().y; i += 7)
+        {
+            const MapPoint center(i % map.GetSize().x, i / map.GetSize().x);
+            for(const MapPoint pt : map.GetPointsInRadius(center, radius))
+            {
+                benchmark::DoNotOptimize(pt);
+                numPts++;
+            }
+        }
+    }
+    state.SetItemsProcessed(numPts);
+}
+BENCHMARK(BM_GetPointsInRadius)->Arg(2)->Arg(4)->Arg(9);
+
+/// Same as BM_GetPointsInRadius but without allocating
+static void BM_ForEachPointInRadius(benchmark::State& state)
+{
+    const MapBase map = createMap();
+    const auto radius = static_cast<unsigned>(state.range(0));
+    unsigned numPts = 0;
+    for(auto _ : state)
+    {
+        for(unsigned i = 0; i < map.GetSize().x * map.GetSize().y; i += 7)
+        {
+            const MapPoint center(i % map.GetSize().x, i / map.GetSize().x);
+            map.ForEachPointInRadius(center, radius, [&numPts](const MapPoint pt, unsigned) {
+                benchmark::DoNotOptimize(pt);
+                numPts++;
+            });
+        }
+    }
+    state.SetItemsProcessed(numPts);
+}
+BENCHMARK(BM_ForEachPointInRadius)->Arg(2)->Arg(4)->Arg(9);
+
+/// Same as BM_ForEachPointInRadius with the precomputed offsets for a radius known at compile time
+template<unsigned T_radius>
+static void BM_ForEachPointInFixedRadius(benchmark::State& state)
+{
+    const MapBase map = createMap();
+    unsigned numPts = 0;
+    for(auto _ : state)
+    {
+        for(unsigned i = 0; i < map.GetSize().x * map.GetSize().y; i += 7)
+        {
+            const MapPoint center(i % map.GetSize().x, i / map.GetSize().x);
+            map.ForEachPointInRadius<T_radius>(center, [&numPts](const MapPoint pt, unsigned) {
+                benchmark::DoNotOptimize(pt);
+                numPts++;
+            });
+        }
+    }
+    state.SetItemsProcessed(numPts);
+}
+BENCHMARK_TEMPLATE(BM_ForEachPointInFixedRadius, 2);
+BENCHMARK_TEMPLATE(BM_ForEachPointInFixedRadius, 4);
+BENCHMARK_TEMPLATE(BM_ForEachPointInFixedRadius, 9);
@@ -0,0 +1,84 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "EventManager.h"
+#include "Game.h"
+#include "ILocalGameState.h"
+#include "PlayerInfo.h"
+#include "Replay.h"
+#include "Savegame.h"
+#include "network/PlayerGameCommands.h"
+#include "random/Random.h"
+#include "variant.h"
+#include "world/GameWorld.h"
+#include "gameTypes/MapInfo.h"
+#include "test/testConfig.h"
+#include <boost/filesystem/path.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace benchmarkHelpers {
+struct LocalGameState : ILocalGameState
+{
+    unsigned GetPlayerId() const override { return 0; }
+    bool IsHost() const override { return true; }
+    std::string FormatGFTime(unsigned) const override { return ""; }
+    void SystemChat(const std::string&) override {}
+};
+
+/// Replay of a long game with a busy economy
+inline boost::filesystem::path getLongReplayPath()
+{
+    return rttr::test::rttrBaseDir / "tests" / "testData" / "200kGFs.rpl";
+}
+
+/// Game started from the savegame in a replay and running its commands
+struct ReplayGame
+{
+    Replay replay;
+    std::unique_ptr<Game> game;
+    std::optional<unsigned> nextGF;
+    LocalGameState localGameState;
+
+    bool load(const boost::filesystem::path& replayPath)
+    {
+        MapInfo mapInfo;
+        if(!replay.LoadHeader(replayPath) || !replay.LoadGameData(mapInfo) || !mapInfo.savegame)
+            return false;
+        std::vector<PlayerInfo> players;
+        for(unsigned i = 0; i < replay.GetNumPlayers(); i++)
+            players.emplace_back(replay.GetPlayer(i));
+        game = std::make_unique<Game>(replay.ggs, /*startGF*/ 0, players);
+        RANDOM.Init(replay.getSeed());
+        mapInfo.savegame->sgd.ReadSnapshot(*game, localGameState);
+        game->world_.InitAfterLoad();
+        nextGF = replay.ReadGF();
+        return true;
+    }
+
+    void runGFs(const unsigned numGFs)
+    {
+        for(unsigned i = 0; i < numGFs; i++)
+        {
+            const unsigned curGF = game->em_->GetCurrentGF();
+            while(nextGF == curGF)
+            {
+                const auto cmd = replay.ReadCommand();
+                visit(composeVisitor([](const Replay::ChatCommand&) {},
+                                     [this](const Replay::GameCommand& cmd) {
+                                         for(const gc::GameCommandPtr& gc : cmd.cmds.gcs)
+                                             gc->Execute(game->world_, cmd.player);
+                                     }),
+                      cmd);
+                nextGF = replay.ReadGF();
+            }
+            game->RunGF();
+        }
+    }
+};
+} // namespace benchmarkHelpers
@@ -0,0 +1,125 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "RttrForeachPt.h"
+#include "ogl/glAllocator.h"
+#include "pathfinding/RoadPathFinder.h"
+#include "world/GameWorld.h"
+#include "nodeObjs/noFlag.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+/// Number of road path searches per 1000 GFs in a running game with and without reusing human paths
+static void BM_RoadPathSearches(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    const bool useCache = state.range(0) != 0;
+    for(auto _ : state)
+    {
+        state.PauseTiming();
+        auto replayGame = std::make_unique<benchmarkHelpers::ReplayGame>();
+        if(!replayGame->load(benchmarkHelpers::getLongReplayPath()))
+        {
+            state.SkipWithError("Failed to load replay");
+            return;
+        }
+        // Get a busy economy first
+        replayGame->runGFs(10000);
+        RoadPathFinder& pathFinder = replayGame->game->world_.GetRoadPathFinder();
+        pathFinder.SetHumanPathCacheEnabled(useCache);
+        pathFinder.ResetCounters();
+        state.ResumeTiming();
+
+        replayGame->runGFs(1000);
+
+        state.PauseTiming();
+        state.counters["searches"] = pathFinder.GetNumSearches();
+        state.counters["cacheHits"] = pathFinder.GetNumCacheHits();
+        replayGame.reset();
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_RoadPathSearches)->Arg(0)->Arg(1)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+namespace {
+/// Game of the replay after a long time, i.e. with large road networks, and pairs of flags to search paths between
+struct LateGame
+{
+    std::unique_ptr<benchmarkHelpers::ReplayGame> replayGame;
+    std::vector<std::pair<const noRoadNode*, const noRoadNode*>> flagPairs;
+};
+
+const LateGame& getLateGame()
+{
+    static const LateGame lateGame = [] {
+        rttr::test::Fixture f;
+        libsiedler2::setAllocator(new GlAllocator);
+        LateGame result;
+        result.replayGame = std::make_unique<benchmarkHelpers::ReplayGame>();
+        if(!result.replayGame->load(benchmarkHelpers::getLongReplayPath()))
+            return result;
+        result.replayGame->runGFs(50000);
+        const GameWorld& world = result.replayGame->game->world_;
+        std::vector<std::vector<const noRoadNode*>> flagsPerPlayer(world.GetNumPlayers());
+        RTTR_FOREACH_PT(MapPoint, world.GetSize())
+        {
+            if(const auto* flag = world.GetSpecObj<noFlag>(pt))
+                flagsPerPlayer[flag->GetPlayer()].push_back(flag);
+        }
+        std::mt19937 rng(42);
+        for(const auto& flags : flagsPerPlayer)
+        {
+            if(flags.size() < 2u)
+                continue;
+            std::uniform_int_distribution<size_t> distr(0, flags.size() - 1);
+            for(unsigned i = 0; i < 1000; i++)
+            {
+                const noRoadNode* start = flags[distr(rng)];
+                const noRoadNode* goal = flags[distr(rng)];
+                if(start != goal)
+                    result.flagPairs.emplace_back(start, goal);
+            }
+        }
+        return result;
+    }();
+    return lateGame;
+}
+} // namespace
+
+/// Road path searches between random flags of the same player. Each thread uses its own search state
+static void BM_RoadPathSearchesConcurrent(benchmark::State& state)
+{
+    const LateGame& lateGame = getLateGame();
+    if(lateGame.flagPairs.empty())
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    const RoadPathFinder& pathFinder = lateGame.replayGame->game->world_.GetRoadPathFinder();
+    const bool wareMode = state.range(0) != 0;
+    RoadPathSearchState searchState;
+    size_t pairIdx = 0;
+    unsigned numFound = 0;
+    for(auto _ : state)
+    {
+        const auto& flagPair = lateGame.flagPairs[pairIdx];
+        if(++pairIdx == lateGame.flagPairs.size())
+            pairIdx = 0;
+        unsigned length = 0;
+        if(pathFinder.FindPath(searchState, *flagPair.first, *flagPair.second, wareMode,
+                               std::numeric_limits<unsigned>::max(), nullptr, &length))
+            numFound++;
+        benchmark::DoNotOptimize(length);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["found"] = benchmark::Counter(numFound, benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_RoadPathSearchesConcurrent)->Arg(0)->Arg(1)->ThreadRange(1, 8)->UseRealTime();
@@ -0,0 +1,71 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Game.h"
+#include "PlayerInfo.h"
+#include "helpers/IdRange.h"
+#include "ogl/glAllocator.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "gameData/MilitaryConsts.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <test/testConfig.h>
+#include <vector>
+
+/// Check for every 3rd point of a map with many harbors which harbors can be reached for a sea attack, as done by the
+/// AI for its attack targets. Argument 0 runs the path finder for every check as done without stored distances,
+/// argument 1 uses the distances stored in the world
+static void BM_HarborPointsAroundMilitaryBuilding(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    std::vector<PlayerInfo> players(7);
+    for(auto& player : players)
+        player.ps = PlayerState::Occupied;
+    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, players);
+    GameWorld& world = game->world_;
+    MapLoader loader(world);
+    if(!loader.Load(rttr::test::rttrBaseDir / "data/RTTR/MAPS/NEW/AM_FANGDERZEIT.SWD"))
+    {
+        state.SkipWithError("Map failed to load");
+        return;
+    }
+    world.InitAfterLoad();
+    if(world.GetNumHarborPoints() == 0u)
+    {
+        state.SkipWithError("Map has no harbors");
+        return;
+    }
+
+    const bool useStoredDistances = state.range(0) != 0;
+    const unsigned numPts = prodOfComponents(world.GetSize());
+    unsigned numChecks = 0;
+    for(auto _ : state)
+    {
+        for(unsigned i = 0; i < numPts; i += 3)
+        {
+            const MapPoint pt(i % world.GetWidth(), i / world.GetWidth());
+            if(useStoredDistances)
+                benchmark::DoNotOptimize(world.GetHarborPointsAroundMilitaryBuilding(pt));
+            else
+            {
+                std::vector<HarborId> harborPoints;
+                for(const auto hbId : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+                {
+                    const MapPoint harborPt = world.GetHarborPoint(hbId);
+                    if(world.CalcDistance(harborPt, pt) <= SEAATTACK_DISTANCE
+                       && (pt == harborPt || world.FindHumanPath(pt, harborPt, SEAATTACK_DISTANCE)))
+                        harborPoints.push_back(hbId);
+                }
+                benchmark::DoNotOptimize(harborPoints);
+            }
+            numChecks++;
+        }
+    }
+    state.SetItemsProcessed(numChecks);
+}
+BENCHMARK(BM_HarborPointsAroundMilitaryBuilding)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,110 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Game.h"
+#include "PlayerInfo.h"
+#include "helpers/EnumRange.h"
+#include "helpers/IdRange.h"
+#include "ogl/glAllocator.h"
+#include "pathfinding/ShipRouteTable.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <test/testConfig.h>
+#include <vector>
+
+namespace {
+std::shared_ptr<Game> loadSeafaringGame(benchmark::State& state)
+{
+    std::vector<PlayerInfo> players(7);
+    for(auto& player : players)
+        player.ps = PlayerState::Occupied;
+    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, players);
+    GameWorld& world = game->world_;
+    MapLoader loader(world);
+    if(!loader.Load(rttr::test::rttrBaseDir / "data/RTTR/MAPS/NEW/AM_FANGDERZEIT.SWD"))
+    {
+        state.SkipWithError("Map failed to load");
+        return nullptr;
+    }
+    world.InitAfterLoad();
+    if(world.GetNumHarborPoints() < 2u)
+    {
+        state.SkipWithError("Map has no harbors");
+        return nullptr;
+    }
+    return game;
+}
+
+/// Find the routes from each harbor to all other harbors at the same sea as done when ordering a ship or looking for
+/// a harbor to unload at. Return the number of routes
+unsigned findAllHarborRoutes(GameWorld& world)
+{
+    unsigned numRoutes = 0;
+    for(const auto startHb : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+    {
+        for(const auto dir : helpers::EnumRange<Direction>{})
+        {
+            const SeaId seaId = world.GetSeaId(startHb, dir);
+            if(!seaId)
+                continue;
+            const MapPoint startPt = world.GetCoastalPoint(startHb, seaId);
+            for(const auto targetHb : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+            {
+                if(targetHb == startHb || !world.IsHarborAtSea(targetHb, seaId))
+                    continue;
+                unsigned length;
+                benchmark::DoNotOptimize(world.FindShipPathToHarbor(startPt, targetHb, seaId, nullptr, &length));
+                numRoutes++;
+            }
+        }
+    }
+    return numRoutes;
+}
+} // namespace
+
+/// Routes of ships between all harbors. Argument 0 clears the route table before each iteration, so all routes are
+/// calculated by the path finder as without the table. Argument 1 keeps the routes of the previous iteration.
+static void BM_ShipPathToHarbor(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    const auto game = loadSeafaringGame(state);
+    if(!game)
+        return;
+    GameWorld& world = game->world_;
+    ShipRouteTable& routeTable = world.GetShipRouteTable();
+    const bool keepRoutes = state.range(0) != 0;
+    unsigned numRoutes = 0;
+    for(auto _ : state)
+    {
+        if(!keepRoutes)
+        {
+            state.PauseTiming();
+            routeTable.Init(world);
+            state.ResumeTiming();
+        }
+        numRoutes += findAllHarborRoutes(world);
+    }
+    state.SetItemsProcessed(numRoutes);
+    state.counters["storedRoutes"] = routeTable.GetNumRoutes();
+}
+BENCHMARK(BM_ShipPathToHarbor)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+/// Initializing the route table when a map is loaded
+static void BM_ShipRouteTableInit(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    const auto game = loadSeafaringGame(state);
+    if(!game)
+        return;
+    GameWorld& world = game->world_;
+    for(auto _ : state)
+        world.GetShipRouteTable().Init(world);
+}
+BENCHMARK(BM_ShipRouteTableInit)->Unit(benchmark::kMicrosecond);
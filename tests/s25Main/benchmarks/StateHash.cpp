@@ -0,0 +1,89 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "AsyncChecksum.h"
+#include "Game.h"
+#include "PlayerInfo.h"
+#include "StateHash.h"
+#include "network/GameProtocol.h"
+#include "ogl/glAllocator.h"
+#include "world/MapLoader.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <memory>
+#include <test/testConfig.h>
+#include <utility>
+
+namespace {
+constexpr std::array<std::pair<const char*, unsigned>, 2> maps = {{{"AM_FANGDERZEIT", 7}, {"Suedameri", 5}}};
+/// GFs per NWF as used by the headless AI battles
+constexpr unsigned nwfLength = 20;
+
+std::shared_ptr<Game> startGame(benchmark::State& state)
+{
+    libsiedler2::setAllocator(new GlAllocator);
+    const auto& curValues = maps[static_cast<size_t>(state.range(0))];
+    std::vector<PlayerInfo> players(curValues.second);
+    for(auto& player : players)
+        player.ps = PlayerState::Occupied;
+    auto game = std::make_shared<Game>(GlobalGameSettings(), 0, players);
+    MapLoader loader(game->world_);
+    const std::string curMap = curValues.first;
+    state.SetLabel(curMap);
+    if(!loader.Load(rttr::test::rttrBaseDir / ("data/RTTR/MAPS/NEW/" + curMap + ".SWD")))
+    {
+        state.SkipWithError(("Map " + curMap + " failed to load").c_str());
+        return nullptr;
+    }
+    game->world_.InitAfterLoad();
+    game->Start(false);
+    // Get some figures on the map
+    for(unsigned gf = 0; gf < 500; gf++)
+        game->RunGF();
+    return game;
+}
+} // namespace
+
+static void BM_AsyncChecksum(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = startGame(state);
+    if(!game)
+        return;
+    for(auto _ : state)
+    {
+        AsyncChecksum checksum = AsyncChecksum::create(*game);
+        if(state.range(1))
+            checksum.stateHash = StateHash::create(game->world_);
+        benchmark::DoNotOptimize(checksum);
+    }
+}
+BENCHMARK(BM_AsyncChecksum)->ArgsProduct({{0, 1}, {0, 1}});
+
+/// Run the GF loop with and without creating the state hash in the interval used ingame
+static void BM_GFLoopWithStateHash(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    const auto game = startGame(state);
+    if(!game)
+        return;
+    const bool useStateHash = state.range(1) != 0;
+    unsigned numNWFs = 0;
+    for(auto _ : state)
+    {
+        for(unsigned gf = 0; gf < nwfLength; gf++)
+            game->RunGF();
+        AsyncChecksum checksum = AsyncChecksum::create(*game);
+        if(useStateHash && ++numNWFs >= STATE_HASH_INTERVAL)
+        {
+            numNWFs = 0;
+            checksum.stateHash = StateHash::create(game->world_);
+        }
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * nwfLength);
+}
+BENCHMARK(BM_GFLoopWithStateHash)->ArgsProduct({{0, 1}, {0, 1}});
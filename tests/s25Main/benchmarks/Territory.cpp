@@ -0,0 +1,85 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "buildings/nobBaseMilitary.h"
+#include "buildings/nobMilitary.h"
+#include "ogl/glAllocator.h"
+#include "world/GameWorld.h"
+#include "gameTypes/GO_Type.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <limits>
+#include <vector>
+
+namespace {
+/// All military buildings holding territory in the game
+std::vector<const nobBaseMilitary*> getMilitaryBuildings(const GameWorld& world)
+{
+    std::vector<const nobBaseMilitary*> result;
+    for(const nobBaseMilitary* bld :
+        world.LookForMilitaryBuildings(MapPoint(0, 0), std::numeric_limits<unsigned short>::max()))
+    {
+        if(bld->GetGOT() != GO_Type::NobMilitary || !static_cast<const nobMilitary*>(bld)->IsNewBuilt())
+            result.push_back(bld);
+    }
+    return result;
+}
+} // namespace
+
+/// Recalculating the territory around each military building of the replay after the given number of GFs as done after
+/// a building was built or captured. Many buildings of different players are close to each other by then
+static void BM_RecalcTerritory(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    benchmarkHelpers::ReplayGame replayGame;
+    if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    replayGame.runGFs(static_cast<unsigned>(state.range(0)));
+    GameWorld& world = replayGame.game->world_;
+    const std::vector<const nobBaseMilitary*> buildings = getMilitaryBuildings(world);
+    // The first recalculation might still clean up some territory, afterwards it stays the same
+    for(const nobBaseMilitary* bld : buildings)
+        world.RecalcTerritory(*bld, TerritoryChangeReason::Build);
+
+    for(auto _ : state)
+    {
+        for(const nobBaseMilitary* bld : buildings)
+            world.RecalcTerritory(*bld, TerritoryChangeReason::Build);
+    }
+    state.SetItemsProcessed(state.iterations() * buildings.size());
+    state.counters["buildings"] = buildings.size();
+}
+BENCHMARK(BM_RecalcTerritory)->Arg(50000)->Arg(150000)->Unit(benchmark::kMillisecond);
+
+/// Checking whether destroying a building would change the territory as done by the AI and for the demolition of
+/// military buildings
+static void BM_DoesDestructionChangeTerritory(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    benchmarkHelpers::ReplayGame replayGame;
+    if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    replayGame.runGFs(static_cast<unsigned>(state.range(0)));
+    const GameWorld& world = replayGame.game->world_;
+    const std::vector<const nobBaseMilitary*> buildings = getMilitaryBuildings(world);
+
+    for(auto _ : state)
+    {
+        for(const nobBaseMilitary* bld : buildings)
+            benchmark::DoNotOptimize(world.DoesDestructionChangeTerritory(*bld));
+    }
+    state.SetItemsProcessed(state.iterations() * buildings.size());
+    state.counters["buildings"] = buildings.size();
+}
+BENCHMARK(BM_DoesDestructionChangeTerritory)->Arg(50000)->Arg(150000)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,71 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "TradePathCache.h"
+#include "Game.h"
+#include "GamePlayer.h"
+#include "GlobalGameSettings.h"
+#include "PlayerInfo.h"
+#include "addons/const_addons.h"
+#include "buildings/nobBaseWarehouse.h"
+#include "ogl/glAllocator.h"
+#include "world/GameWorld.h"
+#include "world/MapLoader.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <test/testConfig.h>
+#include <vector>
+
+/// All players of a big map are allied and check for trade paths from each of their warehouses to the warehouses of all
+/// other players, as done when opening the trade window. Argument is the size of the cache
+static void BM_TradePathExists(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    GlobalGameSettings ggs;
+    ggs.setSelection(AddonId::TRADE, 1);
+    std::vector<PlayerInfo> players(7);
+    for(auto& player : players)
+    {
+        player.ps = PlayerState::Occupied;
+        player.team = Team::Team1;
+    }
+    auto game = std::make_shared<Game>(ggs, 0, players);
+    GameWorld& world = game->world_;
+    MapLoader loader(world);
+    if(!loader.Load(rttr::test::rttrBaseDir / "data/RTTR/MAPS/NEW/AM_FANGDERZEIT.SWD"))
+    {
+        state.SkipWithError("Map failed to load");
+        return;
+    }
+    world.InitAfterLoad();
+    game->Start(false);
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        world.GetPlayer(i).MakeStartPacts();
+
+    TradePathCache& cache = world.GetTradePathCache();
+    cache.setMaxSize(static_cast<unsigned>(state.range(0)));
+    unsigned numChecks = 0;
+    for(auto _ : state)
+    {
+        for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        {
+            for(unsigned j = 0; j < world.GetNumPlayers(); j++)
+            {
+                if(i == j)
+                    continue;
+                for(const nobBaseWarehouse* goalWh : world.GetPlayer(j).GetBuildingRegister().GetStorehouses())
+                {
+                    benchmark::DoNotOptimize(world.GetPlayer(i).GetWarehousesForTrading(*goalWh));
+                    numChecks++;
+                }
+            }
+        }
+    }
+    state.SetItemsProcessed(numChecks);
+    state.counters["hitRate"] = cache.getStatistics().getHitRate();
+}
+BENCHMARK(BM_TradePathExists)->Arg(10)->Arg(TradePathCache::DEFAULT_MAX_SIZE)->Unit(benchmark::kMicrosecond);
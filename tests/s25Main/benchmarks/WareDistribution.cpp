@@ -0,0 +1,68 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GamePlayer.h"
+#include "ReplayGame.h"
+#include "Ware.h"
+#include "buildings/nobBaseWarehouse.h"
+#include "ogl/glAllocator.h"
+#include "world/GameWorld.h"
+#include "gameTypes/GoodTypes.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+/// Finding the goal for new wares in the economy of the replay after the given number of GFs.
+/// The game has several hundred buildings by then
+static void BM_FindClientForWare(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    benchmarkHelpers::ReplayGame replayGame;
+    if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    replayGame.runGFs(static_cast<unsigned>(state.range(0)));
+    GameWorld& world = replayGame.game->world_;
+
+    // Wares which are distributed between many buildings in a typical economy
+    constexpr std::array<GoodType, 12> goods = {GoodType::Grain,   GoodType::Flour, GoodType::Water,  GoodType::Fish,
+                                                GoodType::Meat,    GoodType::Bread, GoodType::Coal,   GoodType::Iron,
+                                                GoodType::IronOre, GoodType::Wood,  GoodType::Boards, GoodType::Stones};
+    std::vector<nobBaseWarehouse*> warehouses;
+    unsigned numBuildings = 0;
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+    {
+        const BuildingRegister& buildings = world.GetPlayer(i).GetBuildingRegister();
+        if(buildings.GetStorehouses().empty())
+            continue;
+        warehouses.push_back(buildings.GetStorehouses().front());
+        const BuildingCount bldCounts = buildings.GetBuildingNums();
+        numBuildings += std::accumulate(bldCounts.buildings.begin(), bldCounts.buildings.end(), 0u);
+    }
+
+    for(auto _ : state)
+    {
+        for(nobBaseWarehouse* wh : warehouses)
+        {
+            GamePlayer& player = world.GetPlayer(wh->GetPlayer());
+            for(const GoodType good : goods)
+            {
+                // New ware without a goal waiting in the warehouse
+                auto ware = std::make_unique<Ware>(good, nullptr, wh);
+                benchmark::DoNotOptimize(player.FindClientForWare(*ware));
+                player.RemoveWare(*ware);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * warehouses.size() * goods.size());
+    state.counters["buildings"] = numBuildings;
+}
+BENCHMARK(BM_FindClientForWare)->Arg(10000)->Arg(50000)->Unit(benchmark::kMicrosecond);
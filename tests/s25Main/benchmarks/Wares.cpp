@@ -0,0 +1,40 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "ReplayGame.h"
+#include "AllocationStatistics.h"
+#include "GameObjectPool.h"
+#include "GamePlayer.h"
+#include "ogl/glAllocator.h"
+#include "libsiedler2/libsiedler2.h"
+#include <rttr/test/Fixture.hpp>
+#include <benchmark/benchmark.h>
+
+/// GFs of a game with a busy economy, i.e. many wares being ordered, carried and delivered.
+/// Reports the number of wares and game objects and the peak memory usage after the last iteration
+static void BM_WareEconomyGFs(benchmark::State& state)
+{
+    rttr::test::Fixture f;
+    libsiedler2::setAllocator(new GlAllocator);
+    benchmarkHelpers::ReplayGame replayGame;
+    if(!replayGame.load(benchmarkHelpers::getLongReplayPath()))
+    {
+        state.SkipWithError("Failed to load replay");
+        return;
+    }
+    replayGame.runGFs(static_cast<unsigned>(state.range(0)));
+    constexpr unsigned numGFs = 500;
+    for(auto _ : state)
+        replayGame.runGFs(numGFs);
+    state.SetItemsProcessed(state.iterations() * numGFs);
+
+    const GameWorld& world = replayGame.game->world_;
+    unsigned numWares = 0;
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        numWares += world.GetPlayer(i).GetNumWares();
+    state.counters["Wares"] = numWares;
+    state.counters["GameObjects"] = static_cast<double>(GameObjectPool::getNumObjects());
+    state.counters["PeakRSS_MiB"] = static_cast<double>(AllocationStatistics::getPeakRSS()) / (1024. * 1024.);
+}
+BENCHMARK(BM_WareEconomyGFs)->Arg(50000)->Arg(150000)->Iterations(4)->Unit(benchmark::kMillisecond);
@@ -316,7 +316,7 @@ void forceExpansion(const GamePlayer& player, GameWorld& world)
 }
 
 void runUntilMilitaryBuildingSiteFound(TestEventManager& em, unsigned curPlayer, GameWorld& world,
-                                       const std::list<noBuildingSite*>& bldSites)
+                                       const helpers::OrderedPtrSet<noBuildingSite>& bldSites)
 {
     auto ai = AIFactory::Create(AI::Info(AI::Type::Default, AI::Level::Hard), curPlayer, world);
     for(unsigned gf = 0; gf < 2000;)
@@ -19,6 +19,7 @@
 #include "pathfinding/FindPathForRoad.h"
 #include "worldFixtures/WorldWithGCExecution.h"
 #include "worldFixtures/initGameRNG.hpp"
+#include "worldFixtures/reachabilityHelpers.h"
 #include "worldFixtures/terrainHelpers.h"
 #include "world/GameWorldViewer.h"
 #include "nodeObjs/noFlag.h"
@@ -1399,4 +1400,34 @@ BOOST_FIXTURE_TEST_CASE(AgressiveDefender_Returns_When_Attacker_Aborts, FreeFigh
     RTTR_EXEC_TILL(100, attackerBld.GetNumTroops() == 6u);
 }
 
+// Map must be big enough to use the stored walking distances for the maximum attacking distance
+using BigAttackFixture = AttackFixture<2, 84, 84>;
+BOOST_FIXTURE_TEST_CASE(AttackReachabilityMatchesPathFinder, BigAttackFixture)
+{
+    // Return the number of points soldiers can walk to from the military building of player 0
+    const auto checkAroundBld = [this]() {
+        return CheckReachability(world, milBld0Pos, MAX_ATTACKING_RUN_DISTANCE, true, [this](const MapPoint pt) {
+            return world.IsReachableForAttack(milBld0Pos, pt);
+        });
+    };
+    const ReachabilityCounts counts = checkAroundBld();
+    const unsigned numReachable = counts.numReachable;
+    BOOST_TEST_REQUIRE(numReachable > 0u);
+    // Points at the maximum distance are reachable but not those one step further
+    BOOST_TEST(counts.numAtMaxLength > 0u);
+    BOOST_TEST(counts.numBeyondMaxLength > 0u);
+
+    // Block the way around the building, then remove the blocking objects again
+    const std::vector<MapPoint> blockedPts = BlockPointsAround(world, milBld0Pos);
+    BOOST_TEST_REQUIRE(!blockedPts.empty());
+    BOOST_TEST(checkAroundBld().numReachable < numReachable);
+    UnblockPoints(world, blockedPts);
+    BOOST_TEST(checkAroundBld().numReachable == numReachable);
+
+    // New flags and roads keep the points reachable
+    this->BuildRoad(milBld0->GetFlagPos(), false, std::vector<Direction>(2, Direction::East));
+    BOOST_TEST_REQUIRE(world.GetSpecObj<noFlag>(world.MakeMapPoint(milBld0->GetFlagPos() + Position(2, 0))));
+    BOOST_TEST(checkAroundBld().numReachable == numReachable);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -2,6 +2,9 @@
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "GameCommandFactory.h"
+#include "GameCommands.h"
+#include "GameEvent.h"
 #include "GamePlayer.h"
 #include "PointOutput.h"
 #include "RttrForeachPt.h"
@@ -27,6 +30,7 @@
 #include "rttr/test/random.hpp"
 #include <boost/test/unit_test.hpp>
 #include <iostream>
+#include <tuple>
 
 #if defined(PVS_STUDIO) || defined(__clang_analyzer__)
 #    undef BOOST_TEST_REQUIRE
@@ -892,6 +896,69 @@ BOOST_FIXTURE_TEST_CASE(SetInventorySettingTest, WorldWithGCExecution2P)
     this->SetInventorySetting(hqPos, Job::Woodcutter, InventorySetting());
 }
 
+namespace {
+struct StoreGCFactory : public GameCommandFactory
+{
+    std::vector<gc::GameCommandPtr> gcs;
+
+protected:
+    bool AddGC(gc::GameCommandPtr gc) override
+    {
+        gcs.push_back(gc);
+        return true;
+    }
+};
+
+/// Target GF, ID and object type of the events after executing the commands in a new world
+std::vector<std::tuple<unsigned, unsigned, GO_Type>> getEventsAfter(const std::vector<gc::GameCommandPtr>& gcs)
+{
+    WorldWithGCExecution2P fixture;
+    fixture.addStartResources();
+    for(const gc::GameCommandPtr& gc : gcs)
+        gc->Execute(fixture.world, fixture.curPlayer);
+    std::vector<std::tuple<unsigned, unsigned, GO_Type>> result;
+    for(const GameEvent* ev : fixture.em.GetEvents())
+        result.emplace_back(ev->GetTargetGF(), ev->id, ev->obj->GetGOT());
+    return result;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(RemovingRedundantInventorySettingsKeepsEvents)
+{
+    MapPoint hqPos;
+    {
+        WorldWithGCExecution2P fixture;
+        hqPos = fixture.hqPos;
+    }
+    StoreGCFactory factory;
+    factory.SetInventorySetting(hqPos, GoodType::Boards, EInventorySetting::Send);
+    factory.SetInventorySetting(hqPos, GoodType::Boards, EInventorySetting::Send);
+    factory.SetInventorySetting(hqPos, GoodType::Boards, InventorySetting());
+    // Adds an event even though it is reverted right away
+    factory.SetInventorySetting(hqPos, GoodType::Wood, EInventorySetting::Collect);
+    factory.SetInventorySetting(hqPos, GoodType::Wood, InventorySetting());
+    factory.SetInventorySetting(hqPos, GoodType::Wood, InventorySetting());
+    factory.SetInventorySetting(hqPos, Job::Helper, EInventorySetting::Stop);
+    factory.SetInventorySetting(hqPos, Job::Helper, EInventorySetting::Stop);
+    std::vector<gc::GameCommandPtr> gcs = factory.gcs;
+    gc::removeRedundantCommands(gcs);
+    BOOST_TEST_REQUIRE(gcs.size() == 5u);
+
+    const auto expectedEvents = getEventsAfter(factory.gcs);
+    BOOST_TEST_REQUIRE(!expectedEvents.empty());
+    const auto events = getEventsAfter(gcs);
+    BOOST_TEST_REQUIRE(events.size() == expectedEvents.size());
+    for(unsigned i = 0; i < events.size(); i++)
+    {
+        BOOST_TEST_CONTEXT("Event " << i)
+        {
+            BOOST_TEST(std::get<0>(events[i]) == std::get<0>(expectedEvents[i]));
+            BOOST_TEST(std::get<1>(events[i]) == std::get<1>(expectedEvents[i]));
+            BOOST_TEST((std::get<2>(events[i]) == std::get<2>(expectedEvents[i])));
+        }
+    }
+}
+
 BOOST_FIXTURE_TEST_CASE(ChangeReserveTest, WorldWithGCExecution2P)
 {
     GamePlayer& player = world.GetPlayer(curPlayer);
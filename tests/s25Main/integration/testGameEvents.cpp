@@ -1,13 +1,15 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include "EventStatistics.h"
 #include "GameEvent.h"
 #include "GameObject.h"
 #include "RTTR_AssertError.h"
 #include "worldFixtures/TestEventManager.h"
 #include <rttr/test/LogAccessor.hpp>
 #include <boost/test/unit_test.hpp>
+#include <sstream>
 
 BOOST_AUTO_TEST_SUITE(GameEventsTestSuite)
 
@@ -226,4 +228,66 @@ BOOST_AUTO_TEST_CASE(InvalidEvent)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(CollectStatistics)
+{
+    TestEventManager evMgr(0);
+    TestEventHandler obj;
+    BOOST_TEST(!evMgr.GetStatistics());
+    // Not counted
+    evMgr.AddEvent(&obj, 1, 1);
+    evMgr.ExecuteNextGF();
+    evMgr.EnableStatistics(true);
+    BOOST_TEST_REQUIRE(evMgr.GetStatistics());
+    const EventStatistics& stats = *evMgr.GetStatistics();
+
+    evMgr.AddEvent(&obj, 2, 1);
+    evMgr.AddEvent(&obj, 2, 1);
+    evMgr.AddEvent(&obj, 4, 3);
+    const GameEvent* ev = evMgr.AddEvent(&obj, 10, 3);
+    evMgr.ExecuteNextGF();
+    evMgr.RemoveEvent(ev);
+    for(unsigned i = 0; i < 3; i++)
+        evMgr.ExecuteNextGF();
+
+    BOOST_TEST(stats.getNumGFs() == 4u);
+    BOOST_TEST(stats.getMaxEventsPerGF() == 2u);
+    // GFs with 0 events, 1 event and 2-3 events
+    BOOST_TEST(stats.getEventsPerGF()[0] == 2u);
+    BOOST_TEST(stats.getEventsPerGF()[1] == 1u);
+    BOOST_TEST(stats.getEventsPerGF()[2] == 1u);
+
+    const auto entries = stats.getEntries();
+    BOOST_TEST_REQUIRE(entries.size() == 2u);
+    // Sorted by executed events
+    BOOST_TEST((entries[0].type == GO_Type::Staticobject));
+    BOOST_TEST(entries[0].eventId == 1u);
+    BOOST_TEST(entries[0].counters.added == 2u);
+    BOOST_TEST(entries[0].counters.executed == 2u);
+    BOOST_TEST(entries[0].counters.removed == 0u);
+    BOOST_TEST(entries[0].counters.getAvgLifetime() == 2.);
+    BOOST_TEST(entries[1].eventId == 3u);
+    BOOST_TEST(entries[1].counters.added == 2u);
+    BOOST_TEST(entries[1].counters.executed == 1u);
+    BOOST_TEST(entries[1].counters.removed == 1u);
+    // Executed after 4 GFs, removed after 1
+    BOOST_TEST(entries[1].counters.getAvgLifetime() == 2.5);
+
+    const EventStatistics::Counters total = stats.getTotal();
+    BOOST_TEST(total.added == 4u);
+    BOOST_TEST(total.executed == 3u);
+    BOOST_TEST(total.removed == 1u);
+    BOOST_TEST(stats.getCounters(GO_Type::Staticobject).executed == 3u);
+    BOOST_TEST(stats.getCounters(GO_Type::Tree).added == 0u);
+
+    std::stringstream report;
+    stats.print(report);
+    BOOST_TEST(report.str().find("Staticobject") != std::string::npos);
+
+    evMgr.ResetStatistics();
+    BOOST_TEST(evMgr.GetStatistics()->getNumGFs() == 0u);
+    BOOST_TEST(evMgr.GetStatistics()->getEntries().empty());
+    evMgr.EnableStatistics(false);
+    BOOST_TEST(!evMgr.GetStatistics());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -1,8 +1,9 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "GamePlayer.h"
+#include "Ware.h"
 #include "buildings/nobBaseWarehouse.h"
 #include "buildings/nobHQ.h"
 #include "buildings/nobMilitary.h"
@@ -10,12 +11,17 @@
 #include "factories/BuildingFactory.h"
 #include "figures/nofPassiveSoldier.h"
 #include "ingameWindows/iwBuildingProductivities.h"
+#include "nodeObjs/noFlag.h"
+#include "pathfinding/RoadPathFinder.h"
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/WorldFixture.h"
+#include "worldFixtures/WorldWithGCExecution.h"
+#include "gameData/BuildingConsts.h"
 #include "gameData/BuildingProperties.h"
 #include "rttr/test/random.hpp"
 #include "s25util/warningSuppression.h"
 #include <boost/test/unit_test.hpp>
+#include <limits>
 #include <numeric>
 
 using WorldFixtureEmpty2P = WorldFixture<CreateEmptyWorld, 2>;
@@ -149,3 +155,180 @@ BOOST_FIXTURE_TEST_CASE(IsHQTent_ReturnsTrue_IfPrimaryHQIsTent, WorldFixtureEmpt
 
     BOOST_TEST_REQUIRE(p1.IsHQTent() == true);
 }
+
+BOOST_FIXTURE_TEST_CASE(WareClients, WorldFixtureEmpty2P)
+{
+    GamePlayer& player = world.GetPlayer(0);
+    const BuildingRegister& buildingRegister = player.GetBuildingRegister();
+    nobBaseWarehouse* hq = player.GetFirstWH();
+    // The index must contain exactly the buildings requesting a ware
+    const auto checkWareClients = [&]() {
+        for(const auto bldType : helpers::enumRange<BuildingType>())
+        {
+            if(!BuildingProperties::IsUsual(bldType))
+                continue;
+            for(nobUsual* bld : buildingRegister.GetBuildings(bldType))
+            {
+                for(const auto ware : helpers::enumRange<GoodType>())
+                {
+                    BOOST_TEST(buildingRegister.GetWareClients(ware).contains(bld)
+                               == (bld->CalcDistributionPoints(ware) != 0));
+                }
+            }
+        }
+    };
+
+    auto* mill = static_cast<nobUsual*>(BuildingFactory::CreateBuilding(
+      world, BuildingType::Mill, world.MakeMapPoint(hq->GetPos() + Position(4, 0)), 0, Nation::Babylonians));
+    auto* bakery = static_cast<nobUsual*>(BuildingFactory::CreateBuilding(
+      world, BuildingType::Bakery, world.MakeMapPoint(hq->GetPos() - Position(4, 0)), 0, Nation::Babylonians));
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Flour).contains(bakery));
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Water).contains(bakery));
+    BOOST_TEST(!buildingRegister.GetWareClients(GoodType::Grain).contains(bakery));
+    checkWareClients();
+
+    mill->SetProductionEnabled(false);
+    BOOST_TEST(!buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+    checkWareClients();
+    mill->SetProductionEnabled(true);
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+
+    // Order wares until the mill is full
+    Ware* lastWare = nullptr;
+    for(unsigned i = 0; i < BLD_WORK_DESC[BuildingType::Mill].numSpacesPerWare; i++)
+    {
+        BOOST_TEST_REQUIRE(buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+        auto ware = std::make_unique<Ware>(GoodType::Grain, mill, hq);
+        lastWare = ware.get();
+        hq->AddWaitingWare(std::move(ware));
+    }
+    BOOST_TEST(!buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+    checkWareClients();
+    // Lost ware -> Space again
+    lastWare->NotifyGoalAboutLostWare();
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Grain).contains(mill));
+    checkWareClients();
+
+    world.DestroyNO(mill->GetPos());
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Grain).empty());
+    BOOST_TEST(buildingRegister.GetWareClients(GoodType::Flour).contains(bakery));
+    checkWareClients();
+}
+
+BOOST_FIXTURE_TEST_CASE(JobsWanted, WorldWithGCExecution2P)
+{
+    nobBaseWarehouse* hq = world.GetPlayer(0).GetFirstWH();
+    BOOST_TEST_REQUIRE(hq->GetNumRealFigures(Job::Woodcutter) == 0u);
+    const auto addToHQ = [hq](auto what, unsigned amount) {
+        GoodsAndPeopleCounts counts;
+        counts[what] = amount;
+        hq->AddToInventory(counts, true);
+    };
+    const auto createWoodcutter = [this](MapPoint pos) {
+        return static_cast<nobUsual*>(
+          BuildingFactory::CreateBuilding(world, BuildingType::Woodcutter, pos, 0, Nation::Romans));
+    };
+    // Carriers for the roads
+    addToHQ(Job::Helper, 5);
+
+    // 2 connected woodcutters waiting for their worker
+    const MapPoint hqFlagPos = world.GetNeighbour(hqPos, Direction::SouthEast);
+    const MapPoint bldPos1 = world.MakeMapPoint(hqPos + Position(4, 0));
+    const MapPoint bldPos2 = world.MakeMapPoint(hqPos - Position(4, 0));
+    const nobUsual* woodcutter1 = createWoodcutter(bldPos1);
+    const nobUsual* woodcutter2 = createWoodcutter(bldPos2);
+    this->BuildRoad(hqFlagPos, false, std::vector<Direction>(4, Direction::East));
+    this->BuildRoad(hqFlagPos, false, std::vector<Direction>(4, Direction::West));
+    BOOST_TEST_REQUIRE(woodcutter1->IsConnected());
+    BOOST_TEST_REQUIRE(woodcutter2->IsConnected());
+    BOOST_TEST(!woodcutter1->GetWorker());
+    BOOST_TEST(!woodcutter2->GetWorker());
+
+    // First request gets the first worker
+    addToHQ(Job::Woodcutter, 1);
+    BOOST_TEST(woodcutter1->GetWorker());
+    BOOST_TEST(!woodcutter2->GetWorker());
+    BOOST_TEST(hq->GetNumRealFigures(Job::Woodcutter) == 0u);
+    // Other jobs are not used
+    addToHQ(Job::Forester, 1);
+    BOOST_TEST(!woodcutter2->GetWorker());
+    BOOST_TEST(hq->GetNumRealFigures(Job::Forester) == 1u);
+
+    // Destroyed building doesn't want the worker anymore
+    world.DestroyNO(bldPos2);
+    addToHQ(GoodType::Axe, 1);
+    BOOST_TEST(hq->GetNumRealWares(GoodType::Axe) == 1u);
+
+    // New building gets a recruited worker as soon as it is connected
+    const nobUsual* woodcutter3 = createWoodcutter(world.MakeMapPoint(bldPos2 + Position(0, 4)));
+    BOOST_TEST_REQUIRE(!woodcutter3->IsConnected());
+    BOOST_TEST(!woodcutter3->GetWorker());
+    BOOST_TEST(hq->GetNumRealWares(GoodType::Axe) == 1u);
+    this->BuildRoad(world.GetNeighbour(bldPos2, Direction::SouthEast), false,
+                    {Direction::SouthEast, Direction::SouthWest, Direction::SouthEast, Direction::SouthWest});
+    BOOST_TEST_REQUIRE(woodcutter3->IsConnected());
+    BOOST_TEST(woodcutter3->GetWorker());
+    BOOST_TEST(hq->GetNumRealWares(GoodType::Axe) == 0u);
+    BOOST_TEST(hq->GetNumRealFigures(Job::Forester) == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(RoadNodeIndices, WorldWithGCExecution2P)
+{
+    const GamePlayer& player = world.GetPlayer(curPlayer);
+    const nobBaseWarehouse* hq = world.GetSpecObj<nobBaseWarehouse>(hqPos);
+    const MapPoint hqFlagPos = world.GetNeighbour(hqPos, Direction::SouthEast);
+    BOOST_TEST_REQUIRE(hq);
+    // HQ and its flag
+    const unsigned numIndices = player.GetNumRoadNodeIndices();
+    BOOST_TEST(numIndices == 2u);
+    BOOST_TEST(hq->GetRoadNodeIdx() != hq->GetFlag()->GetRoadNodeIdx());
+
+    const MapPoint flagPos1 = world.MakeMapPoint(hqFlagPos + Position(4, 0));
+    const MapPoint flagPos2 = world.MakeMapPoint(hqFlagPos - Position(4, 0));
+    this->SetFlag(flagPos1);
+    const noFlag* flag1 = world.GetSpecObj<noFlag>(flagPos1);
+    BOOST_TEST_REQUIRE(flag1);
+    BOOST_TEST(flag1->GetRoadNodeIdx() == numIndices);
+    BOOST_TEST(player.GetNumRoadNodeIndices() == numIndices + 1u);
+    // Indices are per player
+    BOOST_TEST(world.GetPlayer(1).GetNumRoadNodeIndices() == 2u);
+
+    // Index of a removed node is reused
+    this->DestroyFlag(flagPos1);
+    this->SetFlag(flagPos2);
+    const noFlag* flag2 = world.GetSpecObj<noFlag>(flagPos2);
+    BOOST_TEST_REQUIRE(flag2);
+    BOOST_TEST(flag2->GetRoadNodeIdx() == numIndices);
+    BOOST_TEST(player.GetNumRoadNodeIndices() == numIndices + 1u);
+
+    // Paths are still found using the new indices
+    this->BuildRoad(hqFlagPos, false, std::vector<Direction>(4, Direction::West));
+    unsigned length;
+    BOOST_TEST(world.GetRoadPathFinder().FindPath(*flag2, *hq, false, std::numeric_limits<unsigned>::max(), nullptr,
+                                                  &length));
+    BOOST_TEST(length == 5u);
+}
+
+BOOST_FIXTURE_TEST_CASE(HumanPathCacheInvalidatedOnOwnerChange, WorldWithGCExecution2P)
+{
+    RoadPathFinder& pathFinder = world.GetRoadPathFinder();
+    const nobBaseWarehouse* hq = world.GetSpecObj<nobBaseWarehouse>(hqPos);
+    BOOST_TEST_REQUIRE(hq);
+    const MapPoint hqFlagPos = world.GetNeighbour(hqPos, Direction::SouthEast);
+    const MapPoint flagPos = world.MakeMapPoint(hqFlagPos + Position(4, 0));
+    this->BuildRoad(hqFlagPos, false, std::vector<Direction>(4, Direction::East));
+    noFlag* flag = world.GetSpecObj<noFlag>(flagPos);
+    BOOST_TEST_REQUIRE(flag);
+
+    pathFinder.ResetCounters();
+    BOOST_TEST(pathFinder.FindPath(*flag, *hq, false));
+    BOOST_TEST(pathFinder.FindPath(*flag, *hq, false));
+    BOOST_TEST(pathFinder.GetNumCacheHits() == 1u);
+
+    // Capturing moves nodes to another player whose road network might not have changed since the path was cached
+    flag->SetPlayer(1);
+    flag->SetPlayer(curPlayer);
+    BOOST_TEST(pathFinder.FindPath(*flag, *hq, false));
+    BOOST_TEST(pathFinder.GetNumCacheHits() == 1u);
+}
@@ -12,16 +12,19 @@
 #include "factories/BuildingFactory.h"
 #include "figures/nofAttacker.h"
 #include "figures/nofPassiveSoldier.h"
+#include "helpers/IdRange.h"
 #include "helpers/containerUtils.h"
 #include "pathfinding/FindPathForRoad.h"
 #include "worldFixtures/SeaWorldWithGCExecution.h"
 #include "worldFixtures/initGameRNG.hpp"
+#include "worldFixtures/reachabilityHelpers.h"
 #include "worldFixtures/terrainHelpers.h"
 #include "world/GameWorldViewer.h"
 #include "world/MapLoader.h"
 #include "nodeObjs/noGranite.h"
 #include "nodeObjs/noShip.h"
 #include "gameTypes/GameTypesOutput.h"
+#include "gameData/MilitaryConsts.h"
 #include "gameData/SettingTypeConv.h"
 #include <boost/test/unit_test.hpp>
 
@@ -641,4 +644,42 @@ BOOST_FIXTURE_TEST_CASE(HarborBlocksSpots, SeaAttackFixture)
     BOOST_TEST_REQUIRE(world.GetNO(harborPos[1])->GetGOT() == GO_Type::Fire);
 }
 
+BOOST_FIXTURE_TEST_CASE(HarborReachabilityMatchesPathFinder, SeaAttackFixture)
+{
+    // Return the number of points from which soldiers can walk to a harbor for a sea attack
+    const auto checkAroundHarbors = [this]() {
+        unsigned numReachable = 0;
+        for(const auto hbId : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+        {
+            const auto isReachable = [this, hbId](const MapPoint pt) {
+                return helpers::contains(world.GetHarborPointsAroundMilitaryBuilding(pt), hbId);
+            };
+            numReachable +=
+              CheckReachability(world, world.GetHarborPoint(hbId), SEAATTACK_DISTANCE, false, isReachable).numReachable;
+        }
+        return numReachable;
+    };
+    const unsigned numReachable = checkAroundHarbors();
+    BOOST_TEST_REQUIRE(numReachable > 0u);
+
+    // Block the way around a harbor, then remove the blocking objects again
+    const std::vector<MapPoint> blockedPts = BlockPointsAround(world, harborPos[0]);
+    BOOST_TEST_REQUIRE(!blockedPts.empty());
+    BOOST_TEST(checkAroundHarbors() < numReachable);
+    UnblockPoints(world, blockedPts);
+    BOOST_TEST(checkAroundHarbors() == numReachable);
+
+    // The harbor point itself is the goal, so destroying the harbor (leaving a fire), removing the fire and building
+    // it again changes nothing
+    world.DestroyNO(harborPos[1]);
+    BOOST_TEST_REQUIRE(world.GetNO(harborPos[1])->GetGOT() == GO_Type::Fire);
+    BOOST_TEST(checkAroundHarbors() == numReachable);
+    world.DestroyNO(harborPos[1]);
+    BOOST_TEST_REQUIRE(!world.GetNode(harborPos[1]).obj);
+    BOOST_TEST(checkAroundHarbors() == numReachable);
+    BOOST_TEST_REQUIRE(
+      BuildingFactory::CreateBuilding(world, BuildingType::HarborBuilding, harborPos[1], 1, Nation::Romans));
+    BOOST_TEST(checkAroundHarbors() == numReachable);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -12,6 +12,9 @@
 #include "helpers/IdRange.h"
 #include "helpers/Range.h"
 #include "pathfinding/FindPathForRoad.h"
+#include "pathfinding/FreePathFinderImpl.h"
+#include "pathfinding/PathConditionShip.h"
+#include "pathfinding/ShipRouteTable.h"
 #include "postSystem/PostBox.h"
 #include "postSystem/ShipPostMsg.h"
 #include "worldFixtures/SeaWorldWithGCExecution.h"
@@ -825,4 +828,62 @@ BOOST_FIXTURE_TEST_CASE(GoToNeighborHarbor, ShipReadyFixture<1>)
     BOOST_TEST_REQUIRE(ship.IsMoving());
 }
 
+BOOST_FIXTURE_TEST_CASE(ShipRouteTableMatchesPathFinder, SeaWorldWithGCExecution<>)
+{
+    const ShipRouteTable& routeTable = world.GetShipRouteTable();
+    BOOST_TEST_REQUIRE(routeTable.GetNumRoutes() == 0u);
+    const SeaId seaId(1);
+    // A few GFs, so different start directions are used
+    for(unsigned gf = 0; gf < 3; gf++)
+    {
+        for(const auto startHb : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+        {
+            for(const auto targetHb : helpers::idRange<HarborId>(world.GetNumHarborPoints()))
+            {
+                if(!world.IsHarborAtSea(startHb, seaId) || !world.IsHarborAtSea(targetHb, seaId))
+                    continue;
+                const MapPoint startPt = world.GetCoastalPoint(startHb, seaId);
+                const MapPoint destPt = world.GetCoastalPoint(targetHb, seaId);
+                if(startHb == targetHb || startPt == destPt)
+                    continue;
+                BOOST_TEST_REQUIRE(routeTable.IsStored(startPt, destPt));
+                // A short maximum distance with no route found is stored too
+                for(const unsigned maxDistance : {3u, 10000u})
+                {
+                    std::vector<Direction> expectedRoute;
+                    unsigned expectedLength = 0;
+                    const bool expectedFound =
+                      world.GetFreePathFinder().FindPath(startPt, destPt, true, maxDistance, &expectedRoute,
+                                                         &expectedLength, nullptr, PathConditionShip(world));
+                    // First call calculates the route, second one takes it from the table
+                    for(unsigned i = 0; i < 2; i++)
+                    {
+                        std::vector<Direction> route;
+                        unsigned length = 0;
+                        BOOST_TEST_REQUIRE(world.FindShipPath(startPt, destPt, maxDistance, &route, &length)
+                                           == expectedFound);
+                        if(expectedFound)
+                        {
+                            BOOST_TEST(length == expectedLength);
+                            BOOST_TEST(route == expectedRoute, boost::test_tools::per_element());
+                        }
+                    }
+                }
+            }
+        }
+        RTTR_SKIP_GFS(1);
+    }
+    BOOST_TEST(routeTable.GetNumRoutes() > 0u);
+    BOOST_TEST(routeTable.GetStatistics().hits == routeTable.GetStatistics().misses);
+
+    // Routes from other points are not stored
+    const MapPoint seaPt(0, 0);
+    const MapPoint destPt = world.GetCoastalPoint(HarborId(1), seaId);
+    BOOST_TEST_REQUIRE(world.IsSeaPoint(seaPt));
+    BOOST_TEST(!routeTable.IsStored(seaPt, destPt));
+    const unsigned numRoutes = routeTable.GetNumRoutes();
+    BOOST_TEST(world.FindShipPath(seaPt, destPt, 10000, nullptr, nullptr));
+    BOOST_TEST(routeTable.GetNumRoutes() == numRoutes);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
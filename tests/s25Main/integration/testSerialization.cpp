@@ -21,6 +21,8 @@
 #include "helpers/format.hpp"
 #include "network/GameMessage_Chat.h"
 #include "network/PlayerGameCommands.h"
+#include "random/Random.h"
+#include "variant.h"
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/MockLocalGameState.h"
 #include "worldFixtures/WorldFixture.h"
@@ -35,6 +37,7 @@
 #include <rttr/test/testHelpers.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/test/unit_test.hpp>
+#include <map>
 #include <memory>
 
 // LCOV_EXCL_START
@@ -45,6 +48,7 @@ BOOST_TEST_DONT_PRINT_LOG_VALUE(nofBuildingWorker::State)
 
 namespace {
 using EmptyWorldFixture1P = WorldFixture<CreateEmptyWorld, 1>;
+using EmptyWorldFixture2P = WorldFixture<CreateEmptyWorld, 2>;
 struct RandWorldFixture : public WorldFixture<CreateEmptyWorld, 4>
 {
     RandWorldFixture()
@@ -654,6 +658,156 @@ BOOST_FIXTURE_TEST_CASE(ReplayWithSavegame, RandWorldFixture)
     }
 }
 
+namespace {
+struct StoreGCs : public GameCommandFactory
+{
+    std::vector<gc::GameCommandPtr> gcs;
+
+protected:
+    bool AddGC(gc::GameCommandPtr gc) override
+    {
+        gcs.push_back(gc);
+        return true;
+    }
+};
+
+/// Execute the commands from the replay and run the game till it reaches the given GF
+void runReplayTill(Replay& replay, std::optional<unsigned>& nextGF, Game& game, const unsigned gf)
+{
+    while(game.em_->GetCurrentGF() < gf)
+    {
+        const unsigned curGF = game.em_->GetCurrentGF();
+        while(nextGF == curGF)
+        {
+            const auto cmd = replay.ReadCommand();
+            visit(composeVisitor([](const Replay::ChatCommand&) {},
+                                 [&game](const Replay::GameCommand& cmd) {
+                                     for(const gc::GameCommandPtr& gc : cmd.cmds.gcs)
+                                         gc->Execute(game.world_, cmd.player);
+                                 }),
+                  cmd);
+            nextGF = replay.ReadGF();
+        }
+        game.RunGF();
+    }
+}
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(ReplaySeekToSnapshot, EmptyWorldFixture2P)
+{
+    addStartResources();
+    MapInfo map;
+    map.type = MapType::Savegame;
+    map.title = "MapTitle";
+    map.filepath = "Map.swd";
+    map.savegame = std::make_unique<Savegame>();
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        map.savegame->AddPlayer(world.GetPlayer(i));
+    map.savegame->ggs = ggs;
+    map.savegame->start_gf = em.GetCurrentGF();
+    map.savegame->sgd.MakeSnapshot(*game);
+
+    Replay replay;
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        replay.AddPlayer(world.GetPlayer(i));
+    replay.ggs = ggs;
+
+    TmpFile tmpFile(".rpl");
+    BOOST_TEST_REQUIRE(tmpFile.isValid());
+    tmpFile.close();
+    bfs::remove(tmpFile.filePath);
+    const auto seed = rttr::test::randomValue<unsigned>();
+    BOOST_TEST_REQUIRE(replay.StartRecording(tmpFile.filePath, map, seed));
+    RANDOM.Init(seed);
+
+    const auto addCommands = [&](const unsigned char playerId, const int xOffset, const BuildingType bt) {
+        StoreGCs factory;
+        const MapPoint hqPos = world.GetPlayer(playerId).GetHQPos();
+        factory.SetBuildingSite(world.MakeMapPoint(hqPos + Position(xOffset, 0)), bt);
+        factory.BuildRoad(world.GetNeighbour(hqPos, Direction::SouthEast), false,
+                          std::vector<Direction>(std::abs(xOffset), xOffset > 0 ? Direction::East : Direction::West));
+        const PlayerGameCommands cmds(AsyncChecksum::create(*game), factory.gcs);
+        replay.AddGameCommand(em.GetCurrentGF(), playerId, cmds);
+        for(const gc::GameCommandPtr& gc : cmds.gcs)
+            gc->Execute(world, playerId);
+    };
+
+    constexpr unsigned snapshotInterval = 100;
+    const unsigned startGF = em.GetCurrentGF();
+    const unsigned endGF = startGF + 1000;
+    std::vector<unsigned> expectedSnapshotGFs;
+    while(em.GetCurrentGF() < endGF)
+    {
+        const unsigned curGF = em.GetCurrentGF();
+        if(curGF > startGF && curGF % snapshotInterval == 0)
+        {
+            replay.AddSnapshot(*game);
+            expectedSnapshotGFs.push_back(curGF);
+        }
+        if(curGF == startGF + 10)
+        {
+            addCommands(0, 4, BuildingType::Forester);
+            addCommands(1, -4, BuildingType::Forester);
+        } else if(curGF == startGF + 250)
+            addCommands(0, -4, BuildingType::Woodcutter);
+        game->RunGF();
+        replay.UpdateLastGF(em.GetCurrentGF());
+    }
+    BOOST_TEST_REQUIRE(replay.StopRecording());
+    BOOST_TEST_REQUIRE(expectedSnapshotGFs.size() >= 5u);
+
+    Replay loadReplay;
+    BOOST_TEST_REQUIRE(loadReplay.LoadHeader(tmpFile.filePath));
+    MapInfo newMap;
+    BOOST_TEST_REQUIRE(loadReplay.LoadGameData(newMap));
+    BOOST_TEST(loadReplay.GetSnapshotGFs() == expectedSnapshotGFs, boost::test_tools::per_element());
+    std::vector<PlayerInfo> players;
+    for(unsigned i = 0; i < loadReplay.GetNumPlayers(); i++)
+        players.emplace_back(loadReplay.GetPlayer(i));
+
+    const std::vector<unsigned> seekGFs{expectedSnapshotGFs[0], expectedSnapshotGFs[1] + 50,
+                                        expectedSnapshotGFs[3] + 1, endGF};
+    // Linear playback from the start
+    std::map<unsigned, std::pair<AsyncChecksum, StateHash>> expectedStates;
+    {
+        Game linearGame(loadReplay.ggs, newMap.savegame->start_gf, players);
+        RANDOM.Init(loadReplay.getSeed());
+        MockLocalGameState localGameState;
+        newMap.savegame->sgd.ReadSnapshot(linearGame, localGameState);
+        linearGame.world_.InitAfterLoad();
+        auto nextGF = loadReplay.ReadGF();
+        for(const unsigned gf : seekGFs)
+        {
+            runReplayTill(loadReplay, nextGF, linearGame, gf);
+            expectedStates[gf] = std::make_pair(AsyncChecksum::create(linearGame), StateHash::create(linearGame.world_));
+        }
+        BOOST_TEST(!nextGF);
+    }
+
+    Replay::Snapshot snapshot;
+    // Nothing before the first snapshot
+    BOOST_TEST(!loadReplay.ReadSnapshot(expectedSnapshotGFs[0] - 1, snapshot));
+    for(const unsigned gf : seekGFs)
+    {
+        BOOST_TEST_CONTEXT("Seek to GF " << gf)
+        {
+            BOOST_TEST_REQUIRE(loadReplay.ReadSnapshot(gf, snapshot));
+            BOOST_TEST(snapshot.gf <= gf);
+            BOOST_TEST(gf - snapshot.gf < snapshotInterval);
+
+            Game seekGame(loadReplay.ggs, snapshot.gf, players);
+            MockLocalGameState localGameState;
+            snapshot.sgd.ReadSnapshot(seekGame, localGameState);
+            RANDOM.ResetState(snapshot.rngState);
+            seekGame.world_.InitAfterLoad();
+            auto nextGF = loadReplay.ReadGF();
+            runReplayTill(loadReplay, nextGF, seekGame, gf);
+            BOOST_TEST(AsyncChecksum::create(seekGame) == expectedStates[gf].first);
+            BOOST_TEST(StateHash::create(seekGame.world_).describeDifference(expectedStates[gf].second) == "");
+        }
+    }
+}
+
 BOOST_FIXTURE_TEST_CASE(SerializeHunter, EmptyWorldFixture1P)
 {
     SerializedGameData sgd;
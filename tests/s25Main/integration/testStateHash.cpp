@@ -0,0 +1,47 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GamePlayer.h"
+#include "StateHash.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "worldFixtures/WorldFixture.h"
+#include "s25util/Serializer.h"
+#include <boost/test/unit_test.hpp>
+
+BOOST_AUTO_TEST_SUITE(StateHashTests)
+
+namespace {
+// 3x2 regions
+using StateHashFixture = WorldFixture<CreateEmptyWorld, 2, 80, 40>;
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(FindsFirstDifference, StateHashFixture)
+{
+    const StateHash hash = StateHash::create(world);
+    BOOST_TEST(hash.playerHashes.size() == 2u);
+    BOOST_TEST(hash.numRegionsX == 3u);
+    BOOST_TEST(hash.regionHashes.size() == 6u);
+    BOOST_TEST((StateHash::create(world) == hash));
+    BOOST_TEST(hash.describeDifference(hash).empty());
+    // Not compared if not available
+    BOOST_TEST(hash.describeDifference(StateHash()).empty());
+
+    Serializer ser;
+    hash.Serialize(ser);
+    StateHash deserializedHash;
+    deserializedHash.Deserialize(ser);
+    BOOST_TEST((deserializedHash == hash));
+
+    const MapPoint pt(70, 35);
+    world.SetOwner(pt, world.GetNode(pt).owner == 0 ? 1 : 0);
+    const StateHash changedHash = StateHash::create(world);
+    BOOST_TEST(changedHash.playerHashes == hash.playerHashes, boost::test_tools::per_element());
+    BOOST_TEST(changedHash.describeDifference(hash) == "Map nodes in (64, 32) - (95, 63)");
+
+    // Players are checked first
+    world.GetPlayer(1).IncreaseInventoryWare(GoodType::Wood, 1);
+    BOOST_TEST(StateHash::create(world).describeDifference(hash) == "Inventory or buildings of player 1");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
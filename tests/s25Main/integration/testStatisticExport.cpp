@@ -0,0 +1,86 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GamePlayer.h"
+#include "StatisticExport.h"
+#include "worldFixtures/CreateEmptyWorld.h"
+#include "worldFixtures/WorldFixture.h"
+#include "gameTypes/StatisticTypes.h"
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+BOOST_AUTO_TEST_SUITE(StatisticExportTests)
+
+namespace {
+using StatisticFixture = WorldFixture<CreateEmptyWorld, 2, 32, 32>;
+
+/// Record 8 statistic steps with increasing country sizes and one wood ware each
+void recordSteps(GamePlayer& player)
+{
+    for(unsigned i = 1; i <= 8; i++)
+    {
+        player.SetStatisticValue(StatisticType::Country, i * 10);
+        player.IncreaseMerchandiseStatistic(GoodType::Wood);
+        player.StatisticStep();
+    }
+}
+} // namespace
+
+BOOST_FIXTURE_TEST_CASE(ValuesByAge, StatisticFixture)
+{
+    GamePlayer& player = world.GetPlayer(1);
+    recordSteps(player);
+
+    const GamePlayer::Statistic& stat = player.GetStatistic(StatisticTime::T15Minutes);
+    BOOST_TEST(stat.GetValue(StatisticType::Country, 0) == 80u);
+    BOOST_TEST(stat.GetValue(StatisticType::Country, 7) == 10u);
+    BOOST_TEST(stat.GetValue(StatisticType::Country, 8) == 0u);
+    BOOST_TEST(stat.GetMerchandiseValue(0, 0) == 1u);
+    BOOST_TEST(stat.GetMerchandiseValue(1, 0) == 0u);
+    // Every 4th value is used for the next time range
+    const GamePlayer::Statistic& hourStat = player.GetStatistic(StatisticTime::T1Hour);
+    BOOST_TEST(hourStat.GetValue(StatisticType::Country, 0) == 80u);
+    BOOST_TEST(hourStat.GetValue(StatisticType::Country, 1) == 40u);
+    BOOST_TEST(hourStat.GetValue(StatisticType::Country, 2) == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(WriteCSV, StatisticFixture)
+{
+    recordSteps(world.GetPlayer(1));
+
+    std::stringstream ss;
+    statisticExport::writeCSV(ss, world);
+    const std::string csv = ss.str();
+    // Header and one line per player, time range and step
+    BOOST_TEST(static_cast<unsigned>(std::count(csv.begin(), csv.end(), '\n')) == 1u + 2u * 4u * NUM_STAT_STEPS);
+    BOOST_TEST(csv.find("Player,TimeRange,StepDuration,StepsAgo,Country,Buildings,") == 0u);
+    BOOST_TEST(csv.find(",MerchandiseWood,MerchandiseBoards,") != std::string::npos);
+    BOOST_TEST(csv.find("\n1,15m,30,7,10,") != std::string::npos);
+    BOOST_TEST(csv.find("\n1,15m,30,0,80,") != std::string::npos);
+    BOOST_TEST(csv.find("\n1,1h,120,1,40,") != std::string::npos);
+    // Oldest value first
+    BOOST_TEST(csv.find("\n1,15m,30,7,") < csv.find("\n1,15m,30,0,"));
+}
+
+BOOST_FIXTURE_TEST_CASE(WriteJSON, StatisticFixture)
+{
+    GamePlayer& player = world.GetPlayer(1);
+    player.name = "Player \"2\"";
+    recordSteps(player);
+
+    std::stringstream ss;
+    statisticExport::writeJSON(ss, world);
+    const std::string json = ss.str();
+    BOOST_TEST(json.find("{\"players\":[") == 0u);
+    BOOST_TEST(json.find("\"id\":1,\"name\":\"Player \\\"2\\\"\"") != std::string::npos);
+    BOOST_TEST(json.find("\"15m\":{\"stepDuration\":30,\"values\":{\"Country\":[") != std::string::npos);
+    BOOST_TEST(json.find(",0,10,20,30,40,50,60,70,80],\"Buildings\":[") != std::string::npos);
+    BOOST_TEST(json.find("\"16h\":{\"stepDuration\":1920,") != std::string::npos);
+    BOOST_TEST(std::count(json.begin(), json.end(), '{') == std::count(json.begin(), json.end(), '}'));
+    BOOST_TEST(std::count(json.begin(), json.end(), '[') == std::count(json.begin(), json.end(), ']'));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
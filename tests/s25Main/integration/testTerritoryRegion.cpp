@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -13,6 +13,7 @@
 #include "worldFixtures/CreateEmptyWorld.h"
 #include "worldFixtures/WorldFixture.h"
 #include "world/GameWorld.h"
+#include "world/TerritoryClaims.h"
 #include "world/TerritoryRegion.h"
 #include <boost/range/algorithm_ext/push_back.hpp>
 #include <boost/test/unit_test.hpp>
@@ -311,6 +312,81 @@ BOOST_FIXTURE_TEST_CASE(CreateTerritoryRegion, WorldFixtureEmpty2P)
     }
 }
 
+BOOST_FIXTURE_TEST_CASE(TerritoryClaimsMatchRegion, WorldFixtureEmpty2P)
+{
+    // The owners from the claims must be the same as when adding all buildings to a region
+    const auto checkOwners = [this](const noBaseBuilding* excludedBld) {
+        TerritoryRegion region(Position(0, 0), Extent(world.GetSize()), world);
+        for(const nobBaseMilitary* bld : world.LookForMilitaryBuildings(MapPoint(0, 0), 99))
+        {
+            if(bld != excludedBld)
+                region.CalcTerritoryOfBuilding(*bld);
+        }
+        RTTR_FOREACH_PT(MapPoint, world.GetSize())
+        {
+            BOOST_TEST_INFO(pt);
+            BOOST_TEST_REQUIRE(world.GetTerritoryClaims().GetOwner(world, pt, excludedBld)
+                               == region.GetOwner(Position(pt)));
+        }
+    };
+    checkOwners(nullptr);
+
+    const MapPoint hqPos = world.GetPlayer(1).GetHQPos();
+    std::array<MapPoint, 3> milBldPos;
+    milBldPos[0] = world.MakeMapPoint(world.GetPlayer(0).GetHQPos() + Position(2, 0));
+    milBldPos[1] = world.MakeMapPoint(milBldPos[0] + Position(5, 4));
+    milBldPos[2] = world.MakeMapPoint(milBldPos[0] + Position(5, -4));
+    // Different sizes as the military radius depends on it
+    const std::array<BuildingType, 3> milBldTypes = {BuildingType::Guardhouse, BuildingType::Watchtower,
+                                                     BuildingType::Barracks};
+    std::array<nobMilitary*, 3> milBlds;
+    for(unsigned i = 0; i < milBlds.size(); i++)
+    {
+        milBlds[i] = static_cast<nobMilitary*>(BuildingFactory::CreateBuilding(
+          world, milBldTypes[i], milBldPos[i], (i == 0) ? 0 : 1, Nation::Africans));
+    }
+    // Not occupied buildings have no territory yet
+    checkOwners(nullptr);
+    // Occupy all but the last
+    for(unsigned i = 0; i + 1 < milBlds.size(); i++)
+    {
+        const MapPoint flagPt = milBlds[i]->GetFlagPos();
+        auto sld =
+          std::make_unique<nofPassiveSoldier>(flagPt, milBlds[i]->GetPlayer(), milBlds[i], milBlds[i], 0);
+        world.AddFigure(flagPt, std::move(sld)).ActAtFirst();
+    }
+    RTTR_SKIP_GFS(30);
+    BOOST_TEST_REQUIRE(!milBlds[0]->IsNewBuilt());
+    BOOST_TEST_REQUIRE(milBlds[2]->IsNewBuilt());
+    checkOwners(nullptr);
+    checkOwners(world.GetSpecObj<noBaseBuilding>(hqPos));
+    checkOwners(milBlds[1]);
+
+    // Only part of the map is allowed for player 2
+    world.GetPlayer(1).GetRestrictedArea() = {MapPoint(0, 0), MapPoint(20, 0), MapPoint(20, 6), MapPoint(0, 6)};
+    checkOwners(nullptr);
+    world.GetPlayer(1).GetRestrictedArea().clear();
+
+    // Claims of destroyed buildings are removed
+    world.DestroyNO(milBldPos[1]);
+    checkOwners(nullptr);
+    world.DestroyNO(hqPos);
+    checkOwners(nullptr);
+
+    // Same for a building built afterwards
+    auto* fortress = static_cast<nobMilitary*>(
+      BuildingFactory::CreateBuilding(world, BuildingType::Fortress, milBldPos[1], 1, Nation::Africans));
+    const MapPoint fortressFlagPt = fortress->GetFlagPos();
+    world.AddFigure(fortressFlagPt, std::make_unique<nofPassiveSoldier>(fortressFlagPt, 1, fortress, fortress, 0))
+      .ActAtFirst();
+    RTTR_SKIP_GFS(30);
+    BOOST_TEST_REQUIRE(!fortress->IsNewBuilt());
+    checkOwners(nullptr);
+    checkOwners(fortress);
+    world.DestroyNO(milBldPos[1]);
+    checkOwners(nullptr);
+}
+
 BOOST_FIXTURE_TEST_CASE(CreateTerritoryRegionForHQs, WorldFixtureEmpty2P)
 {
     // All points should belong to the HQ closest with and without improved alliances
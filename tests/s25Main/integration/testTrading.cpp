@@ -351,6 +351,7 @@ BOOST_AUTO_TEST_CASE(GetWarehousesForTrading)
             // Poison the tradepath cache with invalid entries. This is possible if e.g. a route is no longer possible
             // or a wh was destroyed
             TradePathCache& cache = world.GetTradePathCache();
+            cache.setMaxSize(10);
             const unsigned oldCacheSize = cache.size();
             // The above should have added 1 entry for the connection of player 1 and 2 whs
             BOOST_TEST(oldCacheSize == 1u);
@@ -383,4 +384,77 @@ BOOST_AUTO_TEST_CASE(GetWarehousesForTrading)
     }
 }
 
+BOOST_AUTO_TEST_CASE(TradePathCacheStatistics)
+{
+    TradePathCache cache(world, 2);
+    const MapPoint flagPos0 = world.GetPlayer(0).GetFirstWH()->GetFlagPos();
+    const MapPoint flagPos1 = world.GetPlayer(1).GetFirstWH()->GetFlagPos();
+    BOOST_TEST(cache.pathExists(flagPos1, flagPos0, 1));
+    BOOST_TEST(cache.getStatistics().misses == 1u);
+    BOOST_TEST(cache.getStatistics().hits == 0u);
+    // Reverse direction from ally uses the same path
+    BOOST_TEST(cache.pathExists(flagPos0, flagPos1, 0));
+    BOOST_TEST(cache.getStatistics().misses == 1u);
+    BOOST_TEST(cache.getStatistics().hits == 1u);
+    BOOST_TEST(cache.getStatistics().getHitRate() == 0.5);
+    BOOST_TEST(cache.size() == 1u);
+
+    // Invalid path (through the HQ) is detected and replaced
+    cache.addEntry(TradePath(flagPos1, flagPos0, std::vector<Direction>(2, Direction::NorthWest)), 1);
+    BOOST_TEST(cache.pathExists(flagPos1, flagPos0, 1));
+    BOOST_TEST(cache.getStatistics().invalidPaths == 1u);
+    BOOST_TEST(cache.size() == 1u);
+
+    // Least recently used is replaced
+    const MapPoint pt(2, 2);
+    cache.addEntry(TradePath(pt, MapPoint(4, 2), std::vector<Direction>(2, Direction::East)), 0);
+    BOOST_TEST(cache.pathExists(flagPos0, flagPos1, 0));
+    cache.addEntry(TradePath(pt, MapPoint(5, 2), std::vector<Direction>(3, Direction::East)), 0);
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST(cache.getStatistics().evictions == 1u);
+    BOOST_TEST(cache.pathExists(flagPos0, flagPos1, 0));
+    BOOST_TEST(cache.getStatistics().hits == 3u);
+    cache.setMaxSize(1);
+    BOOST_TEST(cache.size() == 1u);
+    BOOST_TEST(cache.getStatistics().evictions == 2u);
+
+    cache.resetStatistics();
+    BOOST_TEST(cache.getStatistics().hits == 0u);
+    BOOST_TEST(cache.getStatistics().getHitRate() == 0.);
+}
+
+BOOST_AUTO_TEST_CASE(TradePathCacheTerritoryChange)
+{
+    TradePathCache cache(world);
+    const MapPoint start(2, 2);
+    cache.addEntry(TradePath(start, MapPoint(6, 2), std::vector<Direction>(4, Direction::East)), 0);
+    cache.addEntry(TradePath(start, MapPoint(7, 2), std::vector<Direction>(5, Direction::East)), 2);
+    BOOST_TEST_REQUIRE(cache.size() == 2u);
+
+    const auto setOwner = [this](MapPoint pt, unsigned char owner) {
+        world.GetNodeWriteable(pt).owner = owner;
+        return std::vector<MapPoint>(1, pt);
+    };
+    // Unrelated point, point without owner and goal point
+    cache.onOwnerChanged(setOwner(MapPoint(4, 3), 3));
+    cache.onOwnerChanged(setOwner(MapPoint(4, 2), 0));
+    cache.onOwnerChanged(setOwner(MapPoint(6, 2), 3));
+    BOOST_TEST(cache.size() == 2u);
+    BOOST_TEST(cache.getStatistics().invalidations == 0u);
+
+    // Territory of player 2 -> Only the path of player 0 is removed
+    cache.onOwnerChanged(setOwner(MapPoint(5, 2), 3));
+    BOOST_TEST(cache.size() == 1u);
+    BOOST_TEST(cache.getStatistics().invalidations == 1u);
+    // Territory of player 0
+    cache.onOwnerChanged(setOwner(MapPoint(3, 2), 1));
+    BOOST_TEST(cache.size() == 0u);
+    BOOST_TEST(cache.getStatistics().invalidations == 2u);
+
+    // Territory of an ally
+    cache.addEntry(TradePath(start, MapPoint(6, 2), std::vector<Direction>(4, Direction::East)), 0);
+    cache.onOwnerChanged(setOwner(MapPoint(4, 2), 2));
+    BOOST_TEST(cache.size() == 1u);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,6 +6,7 @@
 #include "Loader.h"
 #include "PointOutput.h"
 #include "RttrForeachPt.h"
+#include "SerializedGameData.h"
 #include "buildings/noBuildingSite.h"
 #include "buildings/nobHQ.h"
 #include "enum_cast.hpp"
@@ -32,6 +33,7 @@
 #include <boost/test/unit_test.hpp>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -857,6 +859,91 @@ BOOST_AUTO_TEST_CASE(onExplored)
     }
 }
 
+BOOST_AUTO_TEST_CASE(onExploredAndOccupiedBatch)
+{
+    executeLua("explored = {}\n\
+    occupied = {}\n\
+    numCalls = 0\n\
+    function onExplored(player_id, x, y)\n\
+        error('Should not be called')\n\
+    end\n\
+    function onExploredBatch(player_id, points)\n\
+        numCalls = numCalls + 1\n\
+        for _, pt in ipairs(points) do\n\
+            local pts = explored[player_id] or {}\n\
+            table.insert(pts, {pt[1], pt[2]})\n\
+            explored[player_id] = pts\n\
+        end\n\
+    end\n\
+    function onOccupiedBatch(player_id, points)\n\
+        numCalls = numCalls + 1\n\
+        occupied[player_id] = points\n\
+    end");
+    initWorld();
+    // Delivered in the next GF only
+    BOOST_TEST_REQUIRE(isLuaEqual("numCalls", "0"));
+    world.GetLua().EventGameFrame(0);
+    using Points = std::vector<std::pair<int, int>>;
+    std::map<int, Points> exploredPtsPerPlayer, occupiedPtsPerPlayer;
+    RTTR_FOREACH_PT(MapPoint, world.GetSize())
+    {
+        const MapNode& node = world.GetNode(pt);
+        for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+        {
+            if(node.fow[i].visibility == Visibility::Visible)
+                exploredPtsPerPlayer[i].push_back(std::pair<int, int>(pt.x, pt.y));
+        }
+        if(node.owner)
+            occupiedPtsPerPlayer[node.owner - 1].push_back(std::pair<int, int>(pt.x, pt.y));
+    }
+    // One call per player and event type
+    const std::string numCalls = std::to_string(exploredPtsPerPlayer.size() + occupiedPtsPerPlayer.size());
+    BOOST_TEST_REQUIRE(isLuaEqual("numCalls", numCalls));
+    std::map<int, Points> luaExploredPts = getLuaState()["explored"];
+    std::map<int, Points> luaOccupiedPts = getLuaState()["occupied"];
+    BOOST_TEST_REQUIRE(luaExploredPts.size() == exploredPtsPerPlayer.size());
+    BOOST_TEST_REQUIRE(luaOccupiedPts.size() == occupiedPtsPerPlayer.size());
+    for(unsigned i = 0; i < world.GetNumPlayers(); i++)
+    {
+        for(auto* ptsPerPlayer : {&exploredPtsPerPlayer, &luaExploredPts, &occupiedPtsPerPlayer, &luaOccupiedPts})
+            helpers::sort((*ptsPerPlayer)[i]);
+        BOOST_TEST_REQUIRE(luaExploredPts[i] == exploredPtsPerPlayer[i], boost::test_tools::per_element());
+        BOOST_TEST_REQUIRE(luaOccupiedPts[i] == occupiedPtsPerPlayer[i], boost::test_tools::per_element());
+    }
+    // Nothing left to deliver
+    world.GetLua().EventGameFrame(1);
+    BOOST_TEST_REQUIRE(isLuaEqual("numCalls", numCalls));
+}
+
+BOOST_AUTO_TEST_CASE(BatchedEventsAreSaved)
+{
+    executeLua("numExplored = 0\n\
+    numOccupied = 0\n\
+    function onExploredBatch(player_id, points)\n\
+        numExplored = numExplored + #points\n\
+    end\n\
+    function onOccupiedBatch(player_id, points)\n\
+        numOccupied = numOccupied + #points\n\
+    end");
+    initWorld();
+    // Points which are not delivered yet when saving are delivered after loading
+    SerializedGameData sgd;
+    world.GetLua().SerializeBatchedEvents(sgd);
+    world.GetLua().EventGameFrame(0);
+    const int numExplored = getLuaState()["numExplored"];
+    const int numOccupied = getLuaState()["numOccupied"];
+    BOOST_TEST_REQUIRE(numExplored > 0);
+    BOOST_TEST_REQUIRE(numOccupied > 0);
+    world.GetLua().DeserializeBatchedEvents(sgd);
+    world.GetLua().EventGameFrame(1);
+    BOOST_TEST(isLuaEqual("numExplored", std::to_string(2 * numExplored)));
+    BOOST_TEST(isLuaEqual("numOccupied", std::to_string(2 * numOccupied)));
+    // Nothing saved if all were delivered
+    SerializedGameData sgdEmpty;
+    world.GetLua().SerializeBatchedEvents(sgdEmpty);
+    BOOST_TEST(sgdEmpty.GetLength() == 2u * world.GetNumPlayers());
+}
+
 BOOST_AUTO_TEST_CASE(LuaPacts)
 {
     initWorld();
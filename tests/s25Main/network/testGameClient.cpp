@@ -11,6 +11,7 @@
 #include "network/GameClient.h"
 #include "network/GameMessage.h"
 #include "network/GameMessages.h"
+#include "gameTypes/CompressedData.h"
 #include "gameTypes/GameTypesOutput.h"
 #include "gameData/GameConsts.h"
 #include "test/testConfig.h"
@@ -28,6 +29,8 @@
 #include <boost/pointer_cast.hpp>
 #include <boost/test/data/test_case.hpp>
 #include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <array>
 
 namespace bfs = boost::filesystem;
 
@@ -79,6 +82,45 @@ public:
     }
 };
 
+/// Connect the client and send the info for a map without lua script so the client expects the map data
+void startMapTransfer(GameClient& client, int serverPort, const std::string& mapName, const CompressedData& mapData)
+{
+    GameMessageInterface& clientMsgInterface = client;
+    BOOST_TEST_REQUIRE(client.Connect("localhost", rttr::test::randString(10), rttr::test::randomEnum<ServerType>(),
+                                      serverPort, false, false));
+    clientMsgInterface.OnGameMessage(GameMessage_Player_Id(1));
+    clientMsgInterface.OnGameMessage(GameMessage_Server_TypeOK(GameMessage_Server_TypeOK::StatusCode::Ok, ""));
+    clientMsgInterface.OnGameMessage(GameMessage_Server_Password("true"));
+    clientMsgInterface.OnGameMessage(GameMessage_Map_Info(mapName, MapType::OldMap, mapData.uncompressedLength,
+                                                          mapData.data.size(), 0, 0));
+    client.GetMainPlayer().sendQueue.clear();
+    BOOST_TEST_REQUIRE(client.GetState() == ClientState::Connect);
+}
+
+/// Send the part of the map data, the map is split into numParts
+void sendMapPart(GameClient& client, const std::vector<char>& mapData, unsigned part, unsigned numParts)
+{
+    const unsigned partSize = (mapData.size() + numParts - 1) / numParts;
+    const unsigned offset = part * partSize;
+    const unsigned size = std::min<unsigned>(partSize, mapData.size() - offset);
+    static_cast<GameMessageInterface&>(client).OnGameMessage(
+      GameMessage_Map_Data(true, offset, mapData.data() + offset, size));
+}
+
+/// Check that the client sent the checksum of the map and stored it
+void checkMapReceived(GameClient& client, const std::string& mapName, unsigned expectedChecksum)
+{
+    const auto msg = boost::dynamic_pointer_cast<GameMessage_Map_Checksum>(client.GetMainPlayer().sendQueue.pop());
+    BOOST_TEST_REQUIRE(msg);
+    BOOST_TEST(msg->mapChecksum == expectedChecksum);
+    BOOST_TEST(msg->luaChecksum == 0u);
+    CompressedData storedMap;
+    unsigned storedChecksum;
+    BOOST_TEST_REQUIRE(
+      storedMap.CompressFromFile(RTTRCONFIG.ExpandPath(s25::folders::mapsPlayed) / mapName, &storedChecksum));
+    BOOST_TEST(storedChecksum == expectedChecksum);
+}
+
 } // namespace
 
 BOOST_FIXTURE_TEST_SUITE(GameClientTests, CustomUserMapFolderFixture)
@@ -317,6 +359,83 @@ BOOST_AUTO_TEST_CASE(ClientDetectsMapBufferOverflow)
     BOOST_TEST(client.GetState() == ClientState::Stopped);
 }
 
+BOOST_AUTO_TEST_CASE(ClientDecompressesMapWhileReceiving)
+{
+    rttr::test::LogAccessor _suppressLogOutput;
+    TestServer server;
+    const auto serverPort = server.tryListen();
+    BOOST_TEST_REQUIRE(serverPort >= 0);
+    const boost::filesystem::path testMapPath =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+    MapInfo mapInfo;
+    mapInfo.mapData.CompressFromFile(testMapPath, &mapInfo.mapChecksum);
+    constexpr unsigned numParts = 4;
+    BOOST_TEST_REQUIRE(mapInfo.mapData.data.size() > 10 * numParts);
+
+    {
+        GameClient client;
+        startMapTransfer(client, serverPort, "streamed.swd", mapInfo.mapData);
+        for(unsigned i = 0; i + 1 < numParts; i++)
+        {
+            sendMapPart(client, mapInfo.mapData.data, i, numParts);
+            BOOST_TEST(client.GetMainPlayer().sendQueue.empty());
+        }
+        sendMapPart(client, mapInfo.mapData.data, numParts - 1, numParts);
+        checkMapReceived(client, "streamed.swd", mapInfo.mapChecksum);
+    }
+
+    // Parts received in order are decompressed right away, so invalid data is detected before the end
+    {
+        GameClient client;
+        startMapTransfer(client, serverPort, "invalid.swd", mapInfo.mapData);
+        std::vector<char> invalidData = mapInfo.mapData.data;
+        invalidData[0] = static_cast<char>(~invalidData[0]);
+        sendMapPart(client, invalidData, 0, numParts);
+        BOOST_TEST(client.GetState() == ClientState::Stopped);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ClientDecompressesOutOfOrderMapAtEnd)
+{
+    rttr::test::LogAccessor _suppressLogOutput;
+    TestServer server;
+    const auto serverPort = server.tryListen();
+    BOOST_TEST_REQUIRE(serverPort >= 0);
+    const boost::filesystem::path testMapPath =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+    MapInfo mapInfo;
+    mapInfo.mapData.CompressFromFile(testMapPath, &mapInfo.mapChecksum);
+    constexpr unsigned numParts = 4;
+    BOOST_TEST_REQUIRE(mapInfo.mapData.data.size() > 10 * numParts);
+    const std::array<unsigned, numParts> partOrder{1, 0, 2, 3};
+
+    {
+        GameClient client;
+        startMapTransfer(client, serverPort, "unordered.swd", mapInfo.mapData);
+        for(unsigned part : partOrder)
+        {
+            BOOST_TEST_REQUIRE(client.GetMainPlayer().sendQueue.empty());
+            sendMapPart(client, mapInfo.mapData.data, part, numParts);
+        }
+        checkMapReceived(client, "unordered.swd", mapInfo.mapChecksum);
+    }
+
+    // Invalid data is only detected when everything was received
+    {
+        GameClient client;
+        startMapTransfer(client, serverPort, "invalid.swd", mapInfo.mapData);
+        std::vector<char> invalidData = mapInfo.mapData.data;
+        invalidData[0] = static_cast<char>(~invalidData[0]);
+        for(unsigned i = 0; i + 1 < numParts; i++)
+        {
+            sendMapPart(client, invalidData, partOrder[i], numParts);
+            BOOST_TEST_REQUIRE(client.GetState() == ClientState::Connect);
+        }
+        sendMapPart(client, invalidData, partOrder.back(), numParts);
+        BOOST_TEST(client.GetState() == ClientState::Stopped);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(ClientReportsWrongPasswordResponse)
 {
     GameClient client;
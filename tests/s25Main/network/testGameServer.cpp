@@ -0,0 +1,604 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "GameCommands.h"
+#include "JoinPlayerInfo.h"
+#include "RTTR_Version.h"
+#include "helpers/chronoIO.h"
+#include "factories/GameCommandFactory.h"
+#include "network/CreateServerInfo.h"
+#include "network/GameMessageInterface.h"
+#include "network/GameMessage_GameCommand.h"
+#include "network/GameMessages.h"
+#include "network/GameServer.h"
+#include "network/NetworkPlayer.h"
+#include "gameTypes/CompressedData.h"
+#include "gameTypes/InventorySetting.h"
+#include "gameTypes/MapCoordinates.h"
+#include "gameTypes/MapDescription.h"
+#include "test/testConfig.h"
+#include "libsiedler2/ArchivItem_Map.h"
+#include "libsiedler2/ArchivItem_Map_Header.h"
+#include "libsiedler2/libsiedler2.h"
+#include "rttr/test/TmpFolder.hpp"
+#include "rttr/test/random.hpp"
+#include "s25util/Serializer.h"
+#include "s25util/SocketSet.h"
+#include <boost/optional.hpp>
+#include <boost/test/unit_test.hpp>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <numeric>
+#include <set>
+#include <vector>
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+struct StoreGCFactory : public GameCommandFactory
+{
+    std::vector<gc::GameCommandPtr> gcs;
+
+protected:
+    bool AddGC(gc::GameCommandPtr gc) override
+    {
+        gcs.push_back(gc);
+        return true;
+    }
+};
+
+size_t getSerializedSize(const GameMessage& msg)
+{
+    Serializer ser;
+    msg.Serialize(ser);
+    return ser.GetLength();
+}
+
+/// Client that follows the connect and NWF protocol without running a game
+class ScriptedClient : public GameMessageInterface
+{
+public:
+    ScriptedClient(std::string password) : player_(GameMessageWithPlayer::NO_PLAYER_ID), password_(std::move(password))
+    {}
+
+    bool connect(uint16_t port)
+    {
+        connectTime_ = Clock::now();
+        return player_.socket.Connect("localhost", port, false);
+    }
+
+    /// Receive, handle and send messages
+    void run()
+    {
+        SocketSet set;
+        set.Add(player_.socket);
+        if(set.Select(0, 0) > 0)
+            BOOST_TEST_REQUIRE(player_.receiveMsgs());
+        player_.executeMsgs(*this);
+        BOOST_TEST_REQUIRE(player_.sendMsgs(-1));
+    }
+
+    void setReady() { player_.sendMsgAsync(new GameMessage_Player_Ready(GameMessageWithPlayer::NO_PLAYER_ID, true)); }
+    /// Let an AI (controlled by this client which must be the host) take the slot
+    void setAI(unsigned playerId)
+    {
+        player_.sendMsgAsync(new GameMessage_Player_State(playerId, PlayerState::AI, AI::Info(AI::Type::Dummy)));
+    }
+    /// Set the commands sent for this player and each AI in each NWF
+    void setCommands(std::vector<gc::GameCommandPtr> gcs) { gcs_ = std::move(gcs); }
+    void startCountdown() { player_.sendMsgAsync(new GameMessage_Countdown(0)); }
+
+    bool isJoined() const { return isJoined_; }
+    bool isKicked() const { return isKicked_; }
+    unsigned getPlayerId() const { return player_.playerId; }
+    unsigned getNumSlots() const { return numSlots_; }
+    unsigned getNumReadyPlayers() const
+    {
+        return static_cast<unsigned>(std::count(readyPlayers_.begin(), readyPlayers_.end(), true));
+    }
+    Clock::duration getJoinTime() const { return joinTime_; }
+    size_t getNumMapBytes() const { return receivedMapBytes_; }
+    unsigned getNumMapParts() const { return numMapParts_; }
+    /// Time between consecutive NWFDone messages
+    const std::vector<Clock::duration>& getNWFIntervals() const { return nwfIntervals_; }
+    /// GF of each NWFDone message received
+    const std::vector<unsigned>& getNWFs() const { return nwfs_; }
+    unsigned getNWFLength() const { return nwfLength_; }
+    unsigned getGFLength() const { return gfLength_; }
+    unsigned getNumAIs() const { return static_cast<unsigned>(aiPlayers_.size()); }
+    /// Number of messages with commands and their size received
+    unsigned getNumCmdMsgs() const { return numCmdMsgs_; }
+    size_t getNumCmdBytes() const { return numCmdBytes_; }
+    /// Number and size of the messages if each players commands were sent individually
+    unsigned getNumSingleCmdMsgs() const { return numSingleCmdMsgs_; }
+    size_t getNumSingleCmdBytes() const { return numSingleCmdBytes_; }
+
+private:
+    bool OnGameMessage(const GameMessage_Ping&) override
+    {
+        player_.sendMsgAsync(new GameMessage_Pong());
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Player_Id& msg) override
+    {
+        BOOST_TEST_REQUIRE(msg.player != GameMessageWithPlayer::NO_PLAYER_ID);
+        player_.playerId = msg.player;
+        player_.sendMsgAsync(new GameMessage_Server_Type(ServerType::Direct, rttr::version::GetRevision()));
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Server_TypeOK& msg) override
+    {
+        BOOST_TEST_REQUIRE(msg.err_code == GameMessage_Server_TypeOK::StatusCode::Ok);
+        player_.sendMsgAsync(new GameMessage_Server_Password(password_));
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Server_Password& msg) override
+    {
+        BOOST_TEST_REQUIRE(msg.password == "true");
+        player_.sendMsgAsync(new GameMessage_MapRequest(true));
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Map_Info& msg) override
+    {
+        mapSize_ = msg.mapCompressedLen;
+        luaSize_ = msg.luaCompressedLen;
+        mapStream_ = std::make_unique<DecompressionStream>(msg.mapLen);
+        if(luaSize_)
+            luaStream_ = std::make_unique<DecompressionStream>(msg.luaLen);
+        player_.sendMsgAsync(new GameMessage_MapRequest(false));
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Map_Data& msg) override
+    {
+        // Decompress while receiving as the GameClient does. The server sends the data in order
+        const std::unique_ptr<DecompressionStream>& stream = msg.isMapData ? mapStream_ : luaStream_;
+        BOOST_TEST_REQUIRE(stream);
+        stream->add(msg.data.data(), msg.data.size());
+        receivedMapBytes_ += msg.data.size();
+        numMapParts_++;
+        if(receivedMapBytes_ == mapSize_ + luaSize_)
+        {
+            BOOST_TEST_REQUIRE(mapStream_->isDone());
+            const unsigned luaChecksum = luaStream_ ? luaStream_->getChecksum() : 0u;
+            player_.sendMsgAsync(new GameMessage_Map_Checksum(mapStream_->getChecksum(), luaChecksum));
+        }
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Map_ChecksumOK& msg) override
+    {
+        BOOST_TEST_REQUIRE(msg.correct);
+        joinTime_ = Clock::now() - connectTime_;
+        isJoined_ = true;
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Player_List& msg) override
+    {
+        numSlots_ = msg.playerInfos.size();
+        readyPlayers_.resize(numSlots_);
+        for(unsigned i = 0; i < numSlots_; i++)
+            readyPlayers_[i] = msg.playerInfos[i].isReady;
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Player_Ready& msg) override
+    {
+        if(msg.player < readyPlayers_.size())
+            readyPlayers_[msg.player] = msg.ready;
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Player_State& msg) override
+    {
+        if(msg.ps == PlayerState::AI)
+            aiPlayers_.insert(msg.player);
+        else
+            aiPlayers_.erase(msg.player);
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Player_Kicked& msg) override
+    {
+        if(msg.player == player_.playerId)
+            isKicked_ = true;
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Server_Start&) override
+    {
+        // Commands for the first NWF. Must be empty
+        sendCommands({});
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_GameCommand& msg) override
+    {
+        numCmdMsgs_++;
+        numCmdBytes_ += getSerializedSize(msg);
+        numSingleCmdMsgs_++;
+        numSingleCmdBytes_ += getSerializedSize(msg);
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_GameCommandBatch& msg) override
+    {
+        // State hashes are only for the server
+        BOOST_TEST(msg.stateHash.empty());
+        numCmdMsgs_++;
+        numCmdBytes_ += getSerializedSize(msg);
+        for(const GameMessage_GameCommandBatch::Entry& entry : msg.entries)
+        {
+            BOOST_TEST(entry.cmds.checksum.stateHash.empty());
+            numSingleCmdMsgs_++;
+            numSingleCmdBytes_ +=
+              getSerializedSize(GameMessage_GameCommand(entry.player, entry.cmds.checksum, entry.cmds.gcs));
+        }
+        return true;
+    }
+    bool OnGameMessage(const GameMessage_Server_NWFDone& msg) override
+    {
+        const Clock::time_point now = Clock::now();
+        if(lastNWFDone_)
+            nwfIntervals_.push_back(now - *lastNWFDone_);
+        lastNWFDone_ = now;
+        nwfs_.push_back(msg.gf);
+        nwfLength_ = msg.nextNWF - msg.gf;
+        gfLength_ = msg.gf_length;
+        // Reply with the commands for the NWF cmdDelay frames in the future
+        sendCommands(gcs_);
+        return true;
+    }
+
+    void sendCommands(const std::vector<gc::GameCommandPtr>& gcs)
+    {
+        // Same as the GameClient: Own commands and those of the AIs in one message
+        auto* msg = new GameMessage_GameCommandBatch();
+        for(unsigned aiPlayer : aiPlayers_)
+            msg->add(aiPlayer, AsyncChecksum(), gcs);
+        msg->add(GameMessageWithPlayer::NO_PLAYER_ID, AsyncChecksum(), gcs);
+        // Same for all clients, so no async
+        msg->stateHash.playerHashes = {1, 2, 3};
+        player_.sendMsgAsync(msg);
+    }
+
+    NetworkPlayer player_;
+    std::string password_;
+    Clock::time_point connectTime_;
+    Clock::duration joinTime_{};
+    bool isJoined_ = false, isKicked_ = false;
+    std::unique_ptr<DecompressionStream> mapStream_, luaStream_;
+    size_t mapSize_ = 0, luaSize_ = 0, receivedMapBytes_ = 0;
+    unsigned numMapParts_ = 0;
+    unsigned numSlots_ = 0;
+    std::vector<bool> readyPlayers_;
+    boost::optional<Clock::time_point> lastNWFDone_;
+    std::vector<Clock::duration> nwfIntervals_;
+    std::vector<unsigned> nwfs_;
+    unsigned nwfLength_ = 0, gfLength_ = 0;
+    std::set<unsigned> aiPlayers_;
+    std::vector<gc::GameCommandPtr> gcs_;
+    unsigned numCmdMsgs_ = 0, numSingleCmdMsgs_ = 0;
+    size_t numCmdBytes_ = 0, numSingleCmdBytes_ = 0;
+};
+
+/// Run the server in its own loop (as the dedicated server does) and all clients till the predicate is true
+template<class T_Pred>
+bool runUntil(std::vector<ScriptedClient>& clients, T_Pred&& pred,
+              std::chrono::seconds timeout = std::chrono::seconds(30))
+{
+    const Clock::time_point endTime = Clock::now() + timeout;
+    while(!pred())
+    {
+        if(Clock::now() > endTime || !GAMESERVER.IsRunning())
+            return false;
+        GAMESERVER.WaitForEvents(std::chrono::milliseconds(1));
+        GAMESERVER.Run();
+        for(ScriptedClient& client : clients)
+        {
+            client.run();
+            BOOST_TEST_REQUIRE(!client.isKicked());
+        }
+    }
+    return true;
+}
+
+template<class T_Duration>
+auto toMs(const T_Duration& duration)
+{
+    return std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(duration);
+}
+
+/// Start the server on a random port, retrying with another one if it is in use. Returns the port or 0 on failure
+uint16_t startServer(const boost::filesystem::path& mapPath, const std::string& hostPw)
+{
+    for(unsigned i = 0; i < 10 && !GAMESERVER.IsRunning(); i++)
+    {
+        const auto port = static_cast<uint16_t>(rttr::test::randomValue(1024, 49151));
+        if(GAMESERVER.Start(CreateServerInfo(ServerType::Direct, port, "Test"),
+                            MapDescription(mapPath, MapType::OldMap), hostPw))
+            return port;
+    }
+    return 0;
+}
+
+/// Write a map of the given size with random terrain to the file
+void writeRandomMap(const boost::filesystem::path& filePath, const MapExtent& size)
+{
+    auto header = std::make_unique<libsiedler2::ArchivItem_Map_Header>();
+    header->setName("Large");
+    header->setAuthor("Test");
+    header->setWidth(size.x);
+    header->setHeight(size.y);
+    header->setNumPlayers(2);
+    header->setGfxSet(0);
+    header->setPlayerHQ(0, size.x / 4, size.y / 4);
+    header->setPlayerHQ(1, size.x * 3 / 4, size.y * 3 / 4);
+
+    auto map = std::make_unique<libsiedler2::ArchivItem_Map>();
+    map->init(std::move(header));
+    using libsiedler2::MapLayer;
+    // Random heights and terrain so the map does not compress to nearly nothing
+    for(MapLayer layer : {MapLayer::Altitude, MapLayer::Terrain1, MapLayer::Terrain2})
+    {
+        for(uint8_t& value : map->getLayer(layer))
+            value = static_cast<uint8_t>(rttr::test::randomValue(0, 15));
+    }
+    libsiedler2::Archiv archiv;
+    archiv.push(std::move(map));
+    BOOST_TEST_REQUIRE(libsiedler2::Write(filePath, archiv) == 0);
+}
+
+struct StopServer
+{
+    ~StopServer()
+    {
+        GAMESERVER.Stop();
+        GAMESERVER.SetRunSettings(GameServer::RunSettings());
+    }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(GameServerTests, StopServer)
+
+BOOST_AUTO_TEST_CASE(WaitForEventsRespectsTimeout)
+{
+    // Not started -> Nothing to wait for
+    BOOST_TEST(!GAMESERVER.WaitForEvents(std::chrono::hours(1)));
+
+    const boost::filesystem::path testMapPath =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+    const uint16_t port = startServer(testMapPath, "hostPw");
+    BOOST_TEST_REQUIRE(port != 0u);
+    // Nothing to do -> Times out
+    BOOST_TEST(!GAMESERVER.WaitForEvents(std::chrono::milliseconds(50)));
+
+    // Incoming connection wakes the server. Would block the test if not
+    Socket socket;
+    BOOST_TEST_REQUIRE(socket.Connect("localhost", port, false));
+    BOOST_TEST(GAMESERVER.WaitForEvents(std::chrono::hours(1)));
+}
+
+BOOST_AUTO_TEST_CASE(LoopbackGameWithScriptedClients)
+{
+    GameServer::RunSettings runSettings;
+    runSettings.maxMsgsPerRun = -1;
+    runSettings.mapBytesPerSecond = 1024 * 1024;
+    GAMESERVER.SetRunSettings(runSettings);
+
+    const boost::filesystem::path testMapPath =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+    const uint16_t port = startServer(testMapPath, "hostPw");
+    BOOST_TEST_REQUIRE(port != 0u);
+
+    // Map has 3 player slots
+    constexpr unsigned numClients = 3;
+    std::vector<ScriptedClient> clients;
+    clients.reserve(numClients);
+    clients.emplace_back("hostPw");
+    for(unsigned i = 1; i < numClients; i++)
+        clients.emplace_back("");
+    for(ScriptedClient& client : clients)
+        BOOST_TEST_REQUIRE(client.connect(port));
+
+    const auto allJoined = [&clients]() {
+        return std::all_of(clients.begin(), clients.end(), [](const auto& client) { return client.isJoined(); });
+    };
+    BOOST_TEST_REQUIRE(runUntil(clients, allJoined));
+    BOOST_TEST_REQUIRE(GAMESERVER.GetNumConnectedPlayers() == numClients);
+    BOOST_TEST_REQUIRE(clients.front().getNumSlots() == numClients);
+    for(const ScriptedClient& client : clients)
+        BOOST_TEST_MESSAGE("Player " << client.getPlayerId() << " joined after "
+                                   << helpers::withUnit(toMs(client.getJoinTime())));
+
+    for(ScriptedClient& client : clients)
+        client.setReady();
+    ScriptedClient& host = clients.front();
+    BOOST_TEST_REQUIRE(runUntil(clients, [&host]() { return host.getNumReadyPlayers() == numClients; }));
+    host.startCountdown();
+    BOOST_TEST_REQUIRE(runUntil(clients, []() { return GAMESERVER.IsInGame(); }));
+
+    // Run some NWFs. The clients reply immediately, so no NWF may be skipped or repeated
+    constexpr unsigned numNWFs = 30;
+    const auto nwfsDone = [&clients]() {
+        return std::all_of(clients.begin(), clients.end(),
+                           [](const auto& client) { return client.getNWFIntervals().size() >= numNWFs; });
+    };
+    BOOST_TEST_REQUIRE(runUntil(clients, nwfsDone));
+
+    for(const ScriptedClient& client : clients)
+    {
+        const std::vector<unsigned>& nwfs = client.getNWFs();
+        for(unsigned i = 1; i < nwfs.size(); i++)
+            BOOST_TEST(nwfs[i] == nwfs[i - 1] + client.getNWFLength());
+        // All clients got the same NWFs
+        BOOST_TEST(nwfs.front() == clients.front().getNWFs().front());
+
+        const auto& intervals = client.getNWFIntervals();
+        // Skip the first cmdDelay NWFs which are sent at once
+        const auto first = intervals.begin() + runSettings.cmdDelay;
+        const Clock::duration total = std::accumulate(first, intervals.end(), Clock::duration::zero());
+        const auto avgInterval = toMs(total / std::distance(first, intervals.end()));
+        const auto expectedInterval =
+          std::chrono::duration<double, std::milli>(client.getNWFLength() * client.getGFLength());
+        BOOST_TEST_MESSAGE("Player " << client.getPlayerId() << ": Avg NWF interval " << helpers::withUnit(avgInterval)
+                                     << ", expected " << helpers::withUnit(expectedInterval) << ", latency "
+                                     << helpers::withUnit(avgInterval - expectedInterval));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RedundantCommandsAreRemoved)
+{
+    const MapPoint pt(5, 6);
+    StoreGCFactory factory;
+    factory.SetInventorySetting(pt, GoodType::Wood, EInventorySetting::Stop);
+    factory.SetInventorySetting(pt, GoodType::Boards, EInventorySetting::Stop);
+    // Redundant: Same state again
+    factory.SetInventorySetting(pt, GoodType::Wood, EInventorySetting::Stop);
+    // Not redundant: Changing the state has side effects, even when it is changed back later
+    factory.SetInventorySetting(pt, GoodType::Wood, EInventorySetting::Send);
+    factory.SetInventorySetting(MapPoint(1, 2), GoodType::Wood, EInventorySetting::Send);
+    factory.SetInventorySetting(pt, GoodType::Wood, EInventorySetting::Stop);
+    factory.SetCoinsAllowed(pt, false);
+    // Not redundant as something else happened in between
+    factory.SetInventorySetting(pt, GoodType::Wood, EInventorySetting::Stop);
+    factory.SetInventorySetting(pt, Job::Woodcutter, EInventorySetting::Stop);
+    // Redundant: Only the latest command for the same setting counts
+    factory.SetInventorySetting(pt, GoodType::Wood, InventorySetting(EInventorySetting::Stop));
+    std::vector<gc::GameCommandPtr> gcs = factory.gcs;
+    gc::removeRedundantCommands(gcs);
+    BOOST_TEST_REQUIRE(gcs.size() == 8u);
+    // Order is kept
+    BOOST_TEST(gcs[0].get() == factory.gcs[0].get());
+    BOOST_TEST(gcs[1].get() == factory.gcs[1].get());
+    BOOST_TEST(gcs[2].get() == factory.gcs[3].get());
+    BOOST_TEST(gcs[3].get() == factory.gcs[4].get());
+    BOOST_TEST(gcs[4].get() == factory.gcs[5].get());
+    BOOST_TEST(gcs[5].get() == factory.gcs[6].get());
+    BOOST_TEST(gcs[6].get() == factory.gcs[7].get());
+    BOOST_TEST(gcs[7].get() == factory.gcs[8].get());
+}
+
+BOOST_AUTO_TEST_CASE(SerializeGameCommandBatch)
+{
+    StoreGCFactory factory;
+    // Enough commands to require multiple bytes for the count
+    for(unsigned i = 0; i < 200; i++)
+        factory.SetCoinsAllowed(MapPoint(i, i + 1), i % 2 == 0);
+    const AsyncChecksum checksum1(1, 2, 3, 4, 5), checksum2(6, 7, 8, 9, 10);
+
+    GameMessage_GameCommandBatch msg;
+    msg.add(1, checksum1, factory.gcs);
+    msg.add(2, checksum1, {});
+    msg.add(GameMessageWithPlayer::NO_PLAYER_ID, checksum2, {factory.gcs[0]});
+    msg.add(3, checksum2, {});
+    msg.stateHash.playerHashes = {11, 12};
+    msg.stateHash.regionHashes = {13, 14, 15, 16};
+    msg.stateHash.numRegionsX = 2;
+    Serializer ser;
+    msg.Serialize(ser);
+
+    GameMessage_GameCommandBatch msgOut;
+    msgOut.Deserialize(ser);
+    BOOST_TEST((msgOut.stateHash == msg.stateHash));
+    BOOST_TEST_REQUIRE(msgOut.entries.size() == 4u);
+    BOOST_TEST(msgOut.entries[0].player == 1u);
+    BOOST_TEST(msgOut.entries[1].player == 2u);
+    BOOST_TEST(msgOut.entries[2].player == GameMessageWithPlayer::NO_PLAYER_ID);
+    BOOST_TEST((msgOut.entries[0].cmds.checksum == checksum1));
+    BOOST_TEST((msgOut.entries[1].cmds.checksum == checksum1));
+    BOOST_TEST((msgOut.entries[2].cmds.checksum == checksum2));
+    BOOST_TEST((msgOut.entries[3].cmds.checksum == checksum2));
+    for(const GameMessage_GameCommandBatch::Entry& entry : msgOut.entries)
+        BOOST_TEST(entry.cmds.checksum.stateHash.empty());
+
+    // Without the state hash
+    msg.stateHash = StateHash();
+    Serializer serNoHash;
+    msg.Serialize(serNoHash);
+    BOOST_TEST(serNoHash.GetLength() < ser.GetLength());
+    msgOut.Deserialize(serNoHash);
+    BOOST_TEST(msgOut.stateHash.empty());
+    BOOST_TEST(msgOut.entries.size() == 4u);
+    BOOST_TEST(msgOut.entries[0].cmds.gcs.size() == 200u);
+    BOOST_TEST(msgOut.entries[1].cmds.gcs.empty());
+    BOOST_TEST(msgOut.entries[2].cmds.gcs.size() == 1u);
+    for(unsigned i = 0; i < msg.entries.size(); i++)
+    {
+        for(unsigned j = 0; j < msg.entries[i].cmds.gcs.size(); j++)
+        {
+            Serializer expected, actual;
+            msg.entries[i].cmds.gcs[j]->Serialize(expected);
+            msgOut.entries[i].cmds.gcs[j]->Serialize(actual);
+            BOOST_TEST(std::vector<uint8_t>(expected.GetData(), expected.GetData() + expected.GetLength())
+                         == std::vector<uint8_t>(actual.GetData(), actual.GetData() + actual.GetLength()),
+                       boost::test_tools::per_element());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(AIGameCommandsAreBatched)
+{
+    GameServer::RunSettings runSettings;
+    runSettings.maxMsgsPerRun = -1;
+    GAMESERVER.SetRunSettings(runSettings);
+
+    const boost::filesystem::path testMapPath =
+      rttr::test::rttrBaseDir / "tests" / "testData" / "maps" / "LuaFunctions.SWD";
+    const uint16_t port = startServer(testMapPath, "hostPw");
+    BOOST_TEST_REQUIRE(port != 0u);
+
+    // The host and 2 AIs
+    std::vector<ScriptedClient> clients;
+    clients.emplace_back("hostPw");
+    ScriptedClient& host = clients.front();
+    BOOST_TEST_REQUIRE(host.connect(port));
+    BOOST_TEST_REQUIRE(runUntil(clients, [&host]() { return host.isJoined(); }));
+    const unsigned numPlayers = host.getNumSlots();
+    for(unsigned i = 0; i < numPlayers; i++)
+    {
+        if(i != host.getPlayerId())
+            host.setAI(i);
+    }
+    BOOST_TEST_REQUIRE(runUntil(clients, [&]() { return host.getNumAIs() + 1u == numPlayers; }));
+    host.setReady();
+    BOOST_TEST_REQUIRE(runUntil(clients, [&]() { return host.getNumReadyPlayers() == numPlayers; }));
+
+    // Some typical AI commands
+    StoreGCFactory factory;
+    factory.SetInventorySetting(MapPoint(10, 10), GoodType::Wood, EInventorySetting::Stop);
+    factory.SetCoinsAllowed(MapPoint(20, 20), false);
+    factory.SetFlag(MapPoint(30, 30));
+    host.setCommands(factory.gcs);
+
+    host.startCountdown();
+    BOOST_TEST_REQUIRE(runUntil(clients, []() { return GAMESERVER.IsInGame(); }));
+    constexpr unsigned numNWFs = 30;
+    BOOST_TEST_REQUIRE(runUntil(clients, [&host]() { return host.getNWFIntervals().size() >= numNWFs; }));
+
+    const unsigned numCmdMsgs = host.getNumCmdMsgs();
+    BOOST_TEST_MESSAGE("Command messages: " << host.getNumSingleCmdMsgs() << " -> " << numCmdMsgs);
+    BOOST_TEST_MESSAGE("Command bytes: " << host.getNumSingleCmdBytes() << " -> " << host.getNumCmdBytes());
+    // At most one message per NWF with the commands of all players
+    BOOST_TEST(host.getNumSingleCmdMsgs() >= numPlayers * numCmdMsgs);
+    BOOST_TEST(host.getNumCmdBytes() < host.getNumSingleCmdBytes());
+}
+
+BOOST_AUTO_TEST_CASE(LargeMapTransferOverLoopback)
+{
+    // Default settings, i.e. limited number of messages per run as in a regular hosted game
+    rttr::test::TmpFolder tmpFolder;
+    const boost::filesystem::path mapPath = tmpFolder / "large.swd";
+    writeRandomMap(mapPath, MapExtent(1024, 1024));
+    const uint16_t port = startServer(mapPath, "hostPw");
+    BOOST_TEST_REQUIRE(port != 0u);
+
+    std::vector<ScriptedClient> clients;
+    clients.emplace_back("hostPw");
+    BOOST_TEST_REQUIRE(clients.front().connect(port));
+    const ScriptedClient& client = clients.front();
+    BOOST_TEST_REQUIRE(runUntil(clients, [&client]() { return client.isJoined(); }));
+
+    const auto joinTime = toMs(client.getJoinTime());
+    BOOST_TEST_MESSAGE("Transferred " << client.getNumMapBytes() << " compressed bytes in " << client.getNumMapParts()
+                                      << " parts, joined after " << helpers::withUnit(joinTime));
+    // Sent in full parts and in order as the client decompresses while receiving
+    BOOST_TEST(client.getNumMapParts() > 1u);
+    BOOST_TEST(client.getNumMapParts() == (client.getNumMapBytes() + MAP_PART_SIZE - 1) / MAP_PART_SIZE);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
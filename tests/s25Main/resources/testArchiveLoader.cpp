@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -17,6 +17,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/nowide/fstream.hpp>
 #include <boost/test/unit_test.hpp>
+#include <vector>
 
 namespace fs = boost::filesystem;
 
@@ -142,6 +143,45 @@ BOOST_FIXTURE_TEST_CASE(Overrides, CreateTestData)
     logAcc.clearLog();
 }
 
+BOOST_FIXTURE_TEST_CASE(DeferredLog, CreateTestData)
+{
+    rttr::test::LogAccessor logAcc;
+    ArchiveLoader loader(LOG);
+
+    std::vector<LoadMessage> deferredLog;
+    const auto archive =
+      loader.load(ResolvedFile{mainFile, overrideFolder1 / mainFile.filename()}, nullptr, &deferredLog);
+    BOOST_TEST_REQUIRE(compareTxts(archive, "1|10|20"));
+    // Nothing logged directly
+    BOOST_TEST(logAcc.getLog().empty());
+    loader.writeLog(deferredLog);
+    std::string log = logAcc.getLog();
+    BOOST_TEST(log.find(mainFile.filename().string()) != std::string::npos);
+    BOOST_TEST(log.find("done in") != std::string::npos);
+
+    // Errors are also deferred
+    deferredLog.clear();
+    BOOST_CHECK_THROW(loader.load(ResolvedFile{resourceFolder / fs::path("missing.GER")}, nullptr, &deferredLog),
+                      LoadError);
+    BOOST_TEST(logAcc.getLog().empty());
+    loader.writeLog(deferredLog);
+    log = logAcc.getLog();
+    BOOST_TEST(log.find("File or directory does not exist") != std::string::npos);
+    BOOST_TEST(log.find("missing.GER") != std::string::npos);
+}
+
+BOOST_AUTO_TEST_CASE(FormatLoadMessage)
+{
+    const LoadMessage text(std::string("Plain %1%"));
+    BOOST_TEST(text.str() == "Plain %1%");
+    const LoadMessage inner("Inner %1%", 42);
+    const LoadMessage msg("Outer %1% %2%", inner, "arg");
+    BOOST_TEST(msg.str() == "Outer Inner 42 arg");
+    BOOST_TEST(msg.translate() == "Outer Inner 42 arg");
+    BOOST_TEST(!msg.empty());
+    BOOST_TEST(LoadMessage().empty());
+}
+
 BOOST_AUTO_TEST_CASE(BobOverrides)
 {
     rttr::test::LogAccessor logAcc;
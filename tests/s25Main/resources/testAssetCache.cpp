@@ -0,0 +1,129 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "resources/AssetCache.h"
+#include "resources/ResolvedFile.h"
+#include "rttr/test/TmpFolder.hpp"
+#include <boost/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <boost/test/unit_test.hpp>
+#include <string>
+
+namespace fs = boost::filesystem;
+
+namespace {
+AssetCache::Writer createPayload()
+{
+    AssetCache::Writer writer;
+    writer.push<uint32_t>(42);
+    const std::string text = "Hello World";
+    writer.push<uint32_t>(text.size());
+    writer.pushRaw(text.data(), text.size());
+    return writer;
+}
+
+void writeFile(const fs::path& path, const std::string& content)
+{
+    boost::nowide::ofstream file(path, std::ios::binary);
+    file << content;
+}
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(AssetCacheSuite)
+
+BOOST_AUTO_TEST_CASE(ReadWrittenEntry)
+{
+    const rttr::test::TmpFolder tmpFolder;
+    // Folder is created on write
+    const AssetCache cache(tmpFolder.get() / "cache");
+    BOOST_TEST(!cache.read("test", 1234));
+    BOOST_TEST_REQUIRE(cache.write("test", 1234, createPayload()));
+
+    const auto entry = cache.read("test", 1234);
+    BOOST_TEST_REQUIRE(!!entry);
+    AssetCache::Reader reader = entry->getReader();
+    BOOST_TEST(reader.pop<uint32_t>() == 42u);
+    const auto textSize = reader.pop<uint32_t>();
+    const uint8_t* text = reader.popRaw(textSize);
+    BOOST_TEST(std::string(text, text + textSize) == "Hello World");
+    BOOST_TEST(reader.getBytesLeft() == 0u);
+    BOOST_CHECK_THROW(reader.pop<uint8_t>(), std::runtime_error);
+
+    // Other key or name
+    BOOST_TEST(!cache.read("test", 1235));
+    BOOST_TEST(!cache.read("test2", 1234));
+}
+
+BOOST_AUTO_TEST_CASE(CorruptEntryIsIgnored)
+{
+    const rttr::test::TmpFolder tmpFolder;
+    const AssetCache cache(tmpFolder.get());
+    BOOST_TEST_REQUIRE(cache.write("test", 1, createPayload()));
+    const fs::path entryPath = cache.getEntryPath("test", 1);
+    BOOST_TEST(entryPath == tmpFolder.get() / "test_0000000000000001.cache");
+    BOOST_TEST_REQUIRE(fs::exists(entryPath));
+    // Corrupt header (version)
+    {
+        boost::nowide::fstream file(entryPath, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(9);
+        file.put('X');
+    }
+    BOOST_TEST(!cache.read("test", 1));
+    // Truncated
+    fs::resize_file(entryPath, 10);
+    BOOST_TEST(!cache.read("test", 1));
+    // Can be replaced
+    BOOST_TEST_REQUIRE(cache.write("test", 1, createPayload()));
+    BOOST_TEST(!!cache.read("test", 1));
+}
+
+BOOST_AUTO_TEST_CASE(EntriesWithDifferentKeysAreKept)
+{
+    const rttr::test::TmpFolder tmpFolder;
+    const AssetCache cache(tmpFolder.get());
+    for(uint64_t key = 1; key <= AssetCache::maxEntriesPerName; key++)
+        BOOST_TEST_REQUIRE(cache.write("test", key, createPayload()));
+    BOOST_TEST_REQUIRE(cache.write("test2", 1, createPayload()));
+    for(uint64_t key = 1; key <= AssetCache::maxEntriesPerName; key++)
+        BOOST_TEST(!!cache.read("test", key));
+
+    // Least recently used entry is removed when there are too many
+    fs::last_write_time(cache.getEntryPath("test", 2), fs::last_write_time(cache.getEntryPath("test", 1)) - 10);
+    BOOST_TEST_REQUIRE(cache.write("test", 42, createPayload()));
+    BOOST_TEST(!cache.read("test", 2));
+    BOOST_TEST(!!cache.read("test", 1));
+    BOOST_TEST(!!cache.read("test", 42));
+    // Other names are not affected
+    BOOST_TEST(!!cache.read("test2", 1));
+}
+
+BOOST_AUTO_TEST_CASE(KeyChangesWithFiles)
+{
+    const rttr::test::TmpFolder tmpFolder;
+    const fs::path file = tmpFolder.get() / "file.dat";
+    const fs::path folder = tmpFolder.get() / "folder";
+    fs::create_directories(folder / "sub");
+    writeFile(file, "content");
+    writeFile(folder / "sub" / "file2.dat", "content");
+    const ResolvedFile files{file, folder};
+
+    const uint64_t key = AssetCache::Key().addFiles(files).get();
+    BOOST_TEST(AssetCache::Key().addFiles(files).get() == key);
+    BOOST_TEST(AssetCache::Key().addFiles(files).addValue(1).get() != key);
+    BOOST_TEST(AssetCache::Key().addFile(file).get() != key);
+
+    // Modified file in folder
+    writeFile(folder / "sub" / "file2.dat", "changed content");
+    const uint64_t key2 = AssetCache::Key().addFiles(files).get();
+    BOOST_TEST(key2 != key);
+    // New file in folder
+    writeFile(folder / "file3.dat", "");
+    const uint64_t key3 = AssetCache::Key().addFiles(files).get();
+    BOOST_TEST(key3 != key2);
+    // Modification time only
+    fs::last_write_time(file, fs::last_write_time(file) - 10);
+    BOOST_TEST(AssetCache::Key().addFiles(files).get() != key3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
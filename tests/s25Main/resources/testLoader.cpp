@@ -0,0 +1,90 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "Loader.h"
+#include "RttrConfig.h"
+#include "resources/ResourceId.h"
+#include "libsiedler2/Archiv.h"
+#include "libsiedler2/ArchivItem_Text.h"
+#include "libsiedler2/libsiedler2.h"
+#include "rttr/test/TmpFolder.hpp"
+#include "s25util/Log.h"
+#include <rttr/test/LogAccessor.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/nowide/fstream.hpp>
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fs = boost::filesystem;
+
+namespace {
+struct LoaderFixture
+{
+    rttr::test::LogAccessor logAcc;
+    const rttr::test::TmpFolder tmpFolder;
+    Loader loader;
+    LoaderFixture() : loader(LOG, RTTRCONFIG) {}
+
+    /// Create a text archive with the given text and return its path
+    std::string createTxtFile(const std::string& name, const std::string& text)
+    {
+        const fs::path filePath = tmpFolder.get() / (name + ".GER");
+        libsiedler2::Archiv txt;
+        auto txtItem = std::make_unique<libsiedler2::ArchivItem_Text>();
+        txtItem->setText(text);
+        txt.push(std::move(txtItem));
+        BOOST_TEST_REQUIRE(libsiedler2::Write(filePath, txt) == 0);
+        return filePath.string();
+    }
+};
+} // namespace
+
+BOOST_FIXTURE_TEST_SUITE(LoaderSuite, LoaderFixture)
+
+BOOST_AUTO_TEST_CASE(LoadFilesLogsInOrder)
+{
+    std::vector<std::string> files;
+    for(unsigned i = 0; i < 8; i++)
+        files.push_back(createTxtFile("file" + std::to_string(i), std::to_string(i)));
+    BOOST_TEST_REQUIRE(loader.LoadFiles(files));
+    const std::string log = logAcc.getLog();
+    size_t lastPos = 0;
+    for(unsigned i = 0; i < files.size(); i++)
+    {
+        BOOST_TEST(loader.GetTextN(ResourceId::make(fs::path(files[i])), 0) == std::to_string(i));
+        // Files are loaded concurrently but the messages are in the order of the files
+        const size_t pos = log.find("file" + std::to_string(i) + ".GER");
+        BOOST_TEST_REQUIRE(pos != std::string::npos);
+        BOOST_TEST(pos >= lastPos);
+        lastPos = pos;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LoadFilesStopsAtFailedFile)
+{
+    const std::string brokenFile = (tmpFolder.get() / "broken.lst").string();
+    {
+        boost::nowide::ofstream file(brokenFile, std::ios::binary);
+        file << "invalid";
+    }
+    const std::vector<std::string> files{createTxtFile("file0", "0"), brokenFile, createTxtFile("file2", "2")};
+    BOOST_TEST(!loader.LoadFiles(files));
+    std::string log = logAcc.getLog();
+    BOOST_TEST(log.find("file0.GER") != std::string::npos);
+    BOOST_TEST(log.find("Failed to load broken\n") != std::string::npos);
+    // Nothing is logged after the failed file
+    BOOST_TEST(log.find("file2.GER") == std::string::npos);
+
+    // Files before the failed one were stored and are not loaded again, the others are
+    BOOST_TEST_REQUIRE(loader.LoadFiles({files[0], files[2]}));
+    log = logAcc.getLog();
+    BOOST_TEST(log.find("file0.GER") == std::string::npos);
+    BOOST_TEST(log.find("file2.GER") != std::string::npos);
+    BOOST_TEST(loader.GetTextN("file0", 0) == "0");
+    BOOST_TEST(loader.GetTextN("file2", 0) == "2");
+}
+
+BOOST_AUTO_TEST_SUITE_END()
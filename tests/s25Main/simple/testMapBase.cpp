@@ -1,4 +1,4 @@
-// Copyright (C) 2005 - 2021 Settlers Freaks (sf-team at siedler25.org)
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
 //
 // SPDX-License-Identifier: GPL-2.0-or-later
 
@@ -12,6 +12,8 @@
 #include <rttr/test/random.hpp>
 #include <boost/test/unit_test.hpp>
 #include <array>
+#include <utility>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(WorldCreationSuite)
 
@@ -152,6 +154,47 @@ BOOST_AUTO_TEST_CASE(GetMatchingPointsInRadius)
     BOOST_TEST(firstEvenPt.front() == evenPts.front());
 }
 
+BOOST_AUTO_TEST_CASE(ForEachPointInRadius)
+{
+    using PtWithRadius = std::pair<MapPoint, unsigned>;
+    MapBase world;
+    // Small sizes wrap the radius several times around the map
+    for(const MapExtent size : {MapExtent(20, 30), MapExtent(5, 4)})
+    {
+        world.Resize(size);
+        const MapPoint center(rttr::test::randomValue<MapCoord>(0, size.x - 1),
+                              rttr::test::randomValue<MapCoord>(0, size.y - 1));
+        for(const bool includePt : {false, true})
+        {
+            const std::vector<PtWithRadius> expectedPts =
+              world.GetPointsInRadius(center, 4, [](const MapPoint pt, unsigned r) { return PtWithRadius(pt, r); },
+                                      AlwaysTrue{}, includePt);
+            std::vector<PtWithRadius> pts;
+            const auto addPt = [&pts](const MapPoint pt, unsigned r) { pts.emplace_back(pt, r); };
+            world.ForEachPointInRadius(center, 4, addPt, includePt);
+            BOOST_TEST((pts == expectedPts));
+            pts.clear();
+            world.ForEachPointInRadius<4>(center, addPt, includePt);
+            BOOST_TEST((pts == expectedPts));
+        }
+    }
+
+    // Stops at the first match
+    world.Resize(MapExtent(20, 30));
+    const MapPoint center = rttr::test::randomPoint<MapPoint>(0, 19);
+    const MapPoint expectedPt = world.GetNeighbour2(center, 5);
+    unsigned numChecked = 0;
+    const auto isExpectedPt = [&](const MapPoint pt, unsigned r) {
+        ++numChecked;
+        return pt == expectedPt && r == 2u;
+    };
+    BOOST_TEST(world.CheckPointsInRadius<3>(center, isExpectedPt, true));
+    BOOST_TEST(numChecked == 1u + 6u + 6u);
+    numChecked = 0;
+    BOOST_TEST(!world.CheckPointsInRadius<1>(center, isExpectedPt, true));
+    BOOST_TEST(numChecked == 1u + 6u);
+}
+
 BOOST_AUTO_TEST_CASE(GetIdx)
 {
     MapBase world;
@@ -0,0 +1,53 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "reachabilityHelpers.h"
+#include "PointOutput.h"
+#include "world/GameWorldBase.h"
+#include "nodeObjs/noGranite.h"
+#include <boost/test/unit_test.hpp>
+
+ReachabilityCounts CheckReachability(const GameWorldBase& world, const MapPoint center, const unsigned maxLength,
+                                     const bool fromCenter, const std::function<bool(MapPoint)>& isReachable)
+{
+    ReachabilityCounts counts;
+    for(const MapPoint pt : world.GetPointsInRadius(center, maxLength + 2))
+    {
+        unsigned length = 0;
+        // Search one step further to find the points just beyond the maximum length
+        const auto firstDir = fromCenter ? world.FindHumanPath(center, pt, maxLength + 1, false, &length) :
+                                           world.FindHumanPath(pt, center, maxLength + 1, false, &length);
+        const bool found = firstDir.has_value();
+        const bool expected = found && length <= maxLength;
+        BOOST_TEST_INFO("Center " << center << " point " << pt);
+        BOOST_TEST(isReachable(pt) == expected);
+        if(expected)
+            counts.numReachable++;
+        if(found && length == maxLength)
+            counts.numAtMaxLength++;
+        else if(found && length == maxLength + 1)
+            counts.numBeyondMaxLength++;
+    }
+    return counts;
+}
+
+std::vector<MapPoint> BlockPointsAround(GameWorldBase& world, const MapPoint center)
+{
+    std::vector<MapPoint> blockedPts;
+    for(const MapPoint pt : world.GetPointsInRadius(center, 4))
+    {
+        if(world.CalcDistance(pt, center) >= 3 && !world.GetNode(pt).obj)
+        {
+            world.SetNO(pt, new noGranite(GraniteType::One, 5));
+            blockedPts.push_back(pt);
+        }
+    }
+    return blockedPts;
+}
+
+void UnblockPoints(GameWorldBase& world, const std::vector<MapPoint>& blockedPts)
+{
+    for(const MapPoint pt : blockedPts)
+        world.DestroyNO(pt);
+}
@@ -0,0 +1,31 @@
+// Copyright (C) 2005 - 2026 Settlers Freaks (sf-team at siedler25.org)
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gameTypes/MapCoordinates.h"
+#include <functional>
+#include <vector>
+
+class GameWorldBase;
+
+struct ReachabilityCounts
+{
+    /// Points figures can walk to
+    unsigned numReachable = 0;
+    /// Reachable points with a shortest path of exactly the maximum length
+    unsigned numAtMaxLength = 0;
+    /// Points with a shortest path one step longer than the maximum length
+    unsigned numBeyondMaxLength = 0;
+};
+
+/// Check that isReachable(pt) is true exactly for the points around center for which the human path finder finds a path
+/// of at most maxLength (from the center if fromCenter is set, else to the center)
+ReachabilityCounts CheckReachability(const GameWorldBase& world, MapPoint center, unsigned maxLength, bool fromCenter,
+                                     const std::function<bool(MapPoint)>& isReachable);
+/// Put granite on all free points with a distance of 3 or 4 to the center, so figures can't walk around it.
+/// Return the blocked points
+std::vector<MapPoint> BlockPointsAround(GameWorldBase& world, MapPoint center);
+/// Remove the granite put by BlockPointsAround
+void UnblockPoints(GameWorldBase& world, const std::vector<MapPoint>& blockedPts);